@@ -0,0 +1,66 @@
+/*--------------------------------------------------------------------------------
+Heap allocations on the measurement path
+
+The sample stage of loop() and the record writes of the SD writer run for
+weeks, they must not allocate: every malloc there fragments the heap a
+little more. Build with -DALLOC_WATCH=1 and the linker wraps malloc, calloc
+and realloc; an allocation made by a task between alloc_watch_begin() and
+alloc_watch_end() is counted, with the size and the caller of the first one.
+The count is in the health line of metrics.h ("allocs 0"), it has to stay 0.
+With -DALLOC_WATCH=2 the first such allocation aborts, the panic backtrace
+shows where it came from.
+
+Every allocation after setup() is counted as well, by any task and inside or
+outside the watched sections ("since setup 412"). The network, the web
+server and every new log file allocate once, after that the number the
+health line prints once a minute has to stay flat.
+
+  PLATFORMIO_BUILD_FLAGS="-DALLOC_WATCH=1 -Wl,--wrap=malloc -Wl,--wrap=calloc -Wl,--wrap=realloc" \
+    pio run -e esp32-c3-devkitm-1 -t upload
+
+Opening files and starting tasks or the network allocate, they happen once
+per session or at boot and are outside the watched sections. Without
+ALLOC_WATCH, alloc_watch_begin() and alloc_watch_end() compile to nothing.
+--------------------------------------------------------------------------------*/
+
+#ifndef ALLOC_WATCH_H
+#define ALLOC_WATCH_H
+
+#include <Arduino.h>
+
+#ifndef ALLOC_WATCH
+#define ALLOC_WATCH 0
+#endif
+
+#define ALLOC_WATCH_TASKS 2 // loop() and the SD writer
+
+struct alloc_watch_stats
+{
+  uint32_t count;    // allocations in the watched sections
+  uint32_t first_size;
+  void *first_caller; // return address of the first one, for addr2line
+  uint32_t after_setup; // allocations of all tasks since alloc_watch_setup_done()
+};
+
+void alloc_watch_enter();
+void alloc_watch_leave();
+void alloc_watch_setup_done(); // end of setup(), starts after_setup
+alloc_watch_stats alloc_watch_read();
+
+inline void alloc_watch_begin()
+{
+  if (ALLOC_WATCH)
+  {
+    alloc_watch_enter();
+  }
+}
+
+inline void alloc_watch_end()
+{
+  if (ALLOC_WATCH)
+  {
+    alloc_watch_leave();
+  }
+}
+
+#endif
@@ -0,0 +1,51 @@
+/*--------------------------------------------------------------------------------
+Frame layout of the binary USB CDC stream, little endian:
+
+  0xA5 0x5A                  sync
+  uint8_t  type              1 = sample, 2 = text
+  uint8_t  length            of the payload
+  sample payload:
+    uint32_t seq             gaps mean frames were lost
+    uint32_t time_us         low 32 bits of the sample timebase (us)
+    uint8_t  channel_mask    bit 0..2 for channel 1..3
+    per enabled channel: float V, mA, mWh, mAh
+  text payload:
+    console output and command replies sent while streaming, a piece of the
+    text without terminator, consecutive frames continue it
+  uint16_t crc               CRC-16/CCITT-FALSE over type, length and payload
+
+Plain C++ without Arduino dependencies, src/cdc_stream.cpp writes the frames,
+tools/cdc_receiver.cpp and tools/trace_replay.cpp read them.
+--------------------------------------------------------------------------------*/
+
+#ifndef CDC_FRAME_H
+#define CDC_FRAME_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define CDC_SYNC_1 0xA5
+#define CDC_SYNC_2 0x5A
+#define CDC_TYPE_SAMPLE 1
+#define CDC_TYPE_TEXT 2
+#define CDC_HEADER 4           // sync, type and length
+#define CDC_CRC 2              // after the payload
+#define CDC_SAMPLE_PAYLOAD 9   // seq, time_us and channel_mask
+#define CDC_CHANNEL_PAYLOAD 16 // V, mA, mWh, mAh of one enabled channel
+#define CDC_TEXT_PAYLOAD 128   // at most per text frame, longer text is split
+
+inline uint16_t cdc_crc16(const uint8_t *data, size_t len)
+{
+  uint16_t crc = 0xFFFF;
+  while (len--)
+  {
+    crc ^= (uint16_t)*data++ << 8;
+    for (int bit = 0; bit < 8; bit++)
+    {
+      crc = crc & 0x8000 ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+  }
+  return crc;
+}
+
+#endif
@@ -0,0 +1,35 @@
+/*--------------------------------------------------------------------------------
+Binary sample stream over USB CDC
+
+Started and stopped with the serial commands "stream on [interval ms]" and
+"stream off". Every sample becomes one frame, the layout is in cdc_frame.h.
+
+Console text goes through cdc_console instead of Serial: plain text while
+idle, text frames while streaming, so it never lands inside a sample frame.
+
+tools/cdc_receiver.cpp is the matching host receiver.
+--------------------------------------------------------------------------------*/
+
+#ifndef CDC_STREAM_H
+#define CDC_STREAM_H
+
+#include <Arduino.h>
+#include "cdc_frame.h"
+#include "log_sample.h"
+
+void cdc_stream_start();
+void cdc_stream_stop();
+bool cdc_streaming();
+void cdc_stream_sample(const log_sample &sample); // drops the frame if the USB buffer is full
+uint32_t cdc_stream_dropped();
+
+class cdc_console_print : public Print
+{
+public:
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t *buffer, size_t size) override;
+  using Print::write;
+};
+extern cdc_console_print cdc_console; // use instead of Serial for text
+
+#endif
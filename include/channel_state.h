@@ -0,0 +1,51 @@
+/*--------------------------------------------------------------------------------
+State and integration of one measurement channel
+
+measure_values() feeds every enabled channel with the INA3221 readings of a
+sample. tools/trace_replay.cpp feeds it with readings rebuilt from a log file
+or a stream capture, so a change of the math can be checked against field
+data on the host. Energy and capacity are integrated over the sample
+interval, not over the measured time between two samples.
+
+The current is the shunt voltage over the shunt resistor of the channel
+(shunt_mohm in main.cpp, the physical value, 100mOhm on the board). It is
+not taken from getCurrent() of the library, which divides in integers and
+would round to 1mA with 100mOhm.
+--------------------------------------------------------------------------------*/
+
+#ifndef CHANNEL_STATE_H
+#define CHANNEL_STATE_H
+
+#include <stdint.h>
+
+#define CHANNEL_SHUNT_MOHM 100 // shunt resistors on the board
+
+struct channel_state
+{
+  float shunt_voltage; // uV
+  float bus_voltage;   // V
+  float current_mA;
+  float load_voltage; // V, bus plus shunt
+  float energy;       // mWh
+  float capacity;     // mAh
+};
+
+inline void channel_integrate(channel_state &ch, float shunt_uV, float bus_V, uint32_t shunt_mohm,
+                              unsigned long interval_ms)
+{
+  ch.shunt_voltage = shunt_uV;
+  ch.bus_voltage = bus_V;
+  ch.current_mA = shunt_uV / shunt_mohm; // uV / mOhm = mA
+  ch.load_voltage = bus_V + (shunt_uV / 1000000);
+  ch.energy = ch.energy + (ch.load_voltage * ch.current_mA * interval_ms) / 3600000;
+  ch.capacity = ch.capacity + (ch.current_mA * interval_ms) / 3600000;
+}
+
+// Readings that give a logged load voltage and current again, for the replay
+inline void channel_readings(float load_voltage, float current_mA, float &shunt_uV, float &bus_V)
+{
+  shunt_uV = current_mA * CHANNEL_SHUNT_MOHM; // mA * mOhm = uV
+  bus_V = load_voltage - (shunt_uV / 1000000);
+}
+
+#endif
@@ -0,0 +1,55 @@
+/*--------------------------------------------------------------------------------
+Running statistics of a measurement channel, updated with every sample
+
+Min, max, mean, RMS and standard deviation of the load voltage, current and
+power (Welford's algorithm), and streaming estimates of the median, 90th and
+99th percentile of the current with the P-square algorithm of Jain and
+Chlamtac: five markers per percentile, adjusted with a parabolic fit, so the
+memory stays the same however long the measurement runs. The C3 has no FPU,
+the percentiles are kept for the current only to bound the cost per sample.
+
+The statistics cover a session, from the start or reset of a measurement to
+its end; a zeroed struct is an empty session.
+--------------------------------------------------------------------------------*/
+
+#ifndef CHANNEL_STATS_H
+#define CHANNEL_STATS_H
+
+#include <Arduino.h>
+#include "channel_state.h"
+
+#define STATS_QUANTILES 3 // p50, p90, p99 of the current
+
+struct p2_quantile
+{
+  float height[5];      // marker heights, the first five samples until the markers are set up
+  int32_t position[5];  // marker positions, 0 based
+  float desired[5];     // desired marker positions
+};
+
+struct running_stats
+{
+  uint32_t count;
+  float min;
+  float max;
+  double mean;
+  double m2; // sum of the squared differences from the mean
+};
+
+struct channel_stats
+{
+  running_stats load_voltage;
+  running_stats current_mA;
+  running_stats power_mW;
+  p2_quantile current_quantile[STATS_QUANTILES];
+};
+
+extern const float stats_quantile_p[STATS_QUANTILES]; // 0.5, 0.9, 0.99
+
+void stats_add(channel_stats &stats, const channel_state &ch);
+float stats_mean(const running_stats &s);
+float stats_stddev(const running_stats &s);
+float stats_rms(const running_stats &s);
+float stats_quantile(const channel_stats &stats, int i); // current in mA, 0 before the first sample
+
+#endif
@@ -0,0 +1,139 @@
+/*--------------------------------------------------------------------------------
+Wall clock model of the NTP client and the peer time sync
+
+Maps the 64 bit microsecond timebase to the wall clock. Every reference time
+(an NTP answer, the master logger) measures the offset of the model and the
+drift of the crystal since an earlier reference. The drift is applied as a
+rate correction, the offset is slewed out at no more than CLOCK_MAX_SLEW_PPM
+instead of jumping, so the wall clock always increases. Only a forward error
+larger than CLOCK_STEP_US is stepped, the drift is then measured anew from
+the step on.
+
+Plain C++ without Arduino dependencies, the host tools use the same model.
+The caller serialises access (see ntp_sync.cpp). Tested on the host by
+test/test_clock_model.
+--------------------------------------------------------------------------------*/
+
+#ifndef CLOCK_MODEL_H
+#define CLOCK_MODEL_H
+
+#include <stdint.h>
+
+#define CLOCK_MAX_SLEW_PPM 500               // fastest offset correction, 0.5ms per second
+#define CLOCK_STEP_US 1000000LL              // forward errors above 1s are stepped
+#define CLOCK_MIN_DRIFT_BASE_US 60000000LL   // drift is measured over at least a minute
+#define CLOCK_MAX_DRIFT_BASE_US 14400000000LL // and over at most 4 hours, so it follows the temperature
+#define CLOCK_MAX_DRIFT_PPB 500000           // anything faster is not a crystal
+
+// ----- wall = wall_us + dt + dt * rate + slew spread over slew_len ----- //
+struct clock_segment
+{
+  uint64_t mono_us; // start of the segment on the timebase
+  int64_t wall_us;  // wall clock at mono_us
+  int32_t rate_ppb;
+  int64_t slew_us;  // offset correction, applied linearly over slew_len_us
+  int64_t slew_len_us;
+};
+
+struct clock_model
+{
+  bool valid;
+  clock_segment current;  // valid from current.mono_us on
+  clock_segment previous; // for stamps taken before the last reference
+  uint64_t base_mono;     // earlier reference the drift is measured against
+  int64_t base_wall;
+  bool drift_settled;     // a full CLOCK_MAX_DRIFT_BASE_US measurement was done
+  int32_t offset_us;      // error of the model found by the last reference
+};
+
+inline int64_t clock_segment_at(const clock_segment &segment, uint64_t mono_us)
+{
+  int64_t dt = (int64_t)(mono_us - segment.mono_us);
+  int64_t wall = segment.wall_us + dt + dt * segment.rate_ppb / 1000000000LL;
+  if (dt <= 0)
+  {
+    return wall;
+  }
+  if (dt >= segment.slew_len_us)
+  {
+    return wall + segment.slew_us;
+  }
+  // slew_us * dt overflows 64 bit for slews of more than a minute
+  return wall + (int64_t)((double)segment.slew_us * dt / segment.slew_len_us);
+}
+
+// ----- Wall clock for a timebase stamp, the timebase itself while no reference was applied ----- //
+inline int64_t clock_model_at(const clock_model &model, uint64_t mono_us)
+{
+  if (!model.valid)
+  {
+    return mono_us;
+  }
+  return clock_segment_at(mono_us >= model.current.mono_us ? model.current : model.previous, mono_us);
+}
+
+// ----- A reference says the wall clock was wall_us at mono_us (mono_us must not go backwards) ----- //
+inline void clock_model_apply(clock_model &model, uint64_t mono_us, int64_t wall_us)
+{
+  if (!model.valid)
+  {
+    model.current = {mono_us, wall_us, 0, 0, 0};
+    model.previous = model.current;
+    model.base_mono = mono_us;
+    model.base_wall = wall_us;
+    model.drift_settled = false;
+    model.offset_us = 0;
+    model.valid = true;
+    return;
+  }
+
+  // A forward error above CLOCK_STEP_US is stepped: the model starts over from the reference,
+  // the drift measured so far stays, a new measurement starts at the step
+  int64_t estimate = clock_segment_at(model.current, mono_us);
+  int64_t error = wall_us - estimate;
+  model.offset_us = error > INT32_MAX ? INT32_MAX : (error < INT32_MIN ? INT32_MIN : error);
+  model.previous = model.current;
+  if (error > CLOCK_STEP_US)
+  {
+    model.current = {mono_us, wall_us, model.previous.rate_ppb, 0, 0};
+    model.base_mono = mono_us;
+    model.base_wall = wall_us;
+    model.drift_settled = false;
+    return;
+  }
+
+  // Drift of the crystal against the reference since the base. The base stays put until the
+  // measurement spans CLOCK_MAX_DRIFT_BASE_US, the jitter of single references then hardly
+  // matters. Later measurements are weighted by their length.
+  int32_t rate = model.previous.rate_ppb;
+  int64_t base = (int64_t)(mono_us - model.base_mono);
+  if (base >= CLOCK_MIN_DRIFT_BASE_US)
+  {
+    // in double, the error times 10^9 overflows 64 bit above 9200s
+    double measured = (double)((wall_us - model.base_wall) - base) * 1e9 / base;
+    if (measured > CLOCK_MAX_DRIFT_PPB || measured < -CLOCK_MAX_DRIFT_PPB)
+    {
+      measured = measured > 0 ? CLOCK_MAX_DRIFT_PPB : -CLOCK_MAX_DRIFT_PPB;
+    }
+    if (model.drift_settled == false)
+    {
+      rate = measured;
+    }
+    else
+    {
+      rate = rate + ((int32_t)measured - rate) * (base < CLOCK_MAX_DRIFT_BASE_US ? base : CLOCK_MAX_DRIFT_BASE_US) / CLOCK_MAX_DRIFT_BASE_US;
+    }
+    if (base >= CLOCK_MAX_DRIFT_BASE_US)
+    {
+      model.drift_settled = true;
+      model.base_mono = mono_us;
+      model.base_wall = wall_us;
+    }
+  }
+
+  // Continue the current model without a jump and slew out its error
+  int64_t slew_len = (error < 0 ? -error : error) * (1000000 / CLOCK_MAX_SLEW_PPM);
+  model.current = {mono_us, estimate, rate, error, slew_len > 1000000 ? slew_len : 1000000};
+}
+
+#endif
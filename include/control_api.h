@@ -0,0 +1,102 @@
+/*--------------------------------------------------------------------------------
+JSON command API
+
+One JSON object per command, sent as the body of POST /api or as one line on
+the USB serial port:
+
+  {"cmd":"status"}
+  {"cmd":"start"}                  leave the setup menu and start measuring
+  {"cmd":"stop"}                   stop and go back to the setup menu
+  {"cmd":"reset"}                  zero energy and capacity, start a new log file
+  {"cmd":"config","channels":[1,3],"avg":16,"interval":200,"shunt":[10,10,100]}
+  {"cmd":"stream","on":true,"interval":2}   binary USB stream, see cdc_stream.h
+
+All fields of "config" are optional: channels by number, INA3221 averaging
+(1, 4, 16, 64 or 128 samples), sample interval in ms, the shunt resistors in
+mOhm (the physical resistors, 100 on the board), the filter resistors in
+Ohm, the log file format ("separator" ",", ";" or "\t" and "decimals"
+0..6), "low_power", and the load phase thresholds "sleep_mA" and
+"active_mA" of every channel (see load_segment.h, an active_mA of 0 switches
+the segmentation of a channel off). Every command is answered with the
+status
+
+  {"ok":true,"running":true,"channels":[1,3],"avg":16,"interval":200,
+   "shunt":[100,100,100],"filter":[10,10,10],"separator":",","decimals":2,
+   "low_power":false,"sleep_mA":[0,0.5,0],"active_mA":[0,5,0],
+   "samples":1234,"late":0,"late_worst_ms":0,"heap_min":171232,
+   "stream_dropped":0}
+
+or {"ok":false,"error":"..."}. The plain serial commands "stream on [ms]"
+and "stream off" are still understood.
+
+Commands are parsed into a control_command in the task they arrive in, with
+a StaticJsonDocument and without allocating, and executed by loop() or the
+setup menu, which wake up on a CONTROL event in their event queue.
+
+/config.json on the SD card holds the same fields as "config" plus
+"autostart", it is applied at boot before the setup menu (see
+load_config_file() in main.cpp):
+
+  {"channels":[1,2],"avg":64,"interval":100,"shunt":[100,100,10],
+   "separator":";","decimals":4,"autostart":true}
+--------------------------------------------------------------------------------*/
+
+#ifndef CONTROL_API_H
+#define CONTROL_API_H
+
+#include <Arduino.h>
+#include "log_sample.h"
+
+#define CONTROL_JSON_SIZE 768  // capacity of the StaticJsonDocument of a command or reply
+#define CONTROL_REPLY_SIZE 384
+#define CONTROL_LINE_SIZE 256  // longest serial command line
+#define CONTROL_TIMEOUT_MS 2000
+
+enum control_action : uint8_t
+{
+  CONTROL_STATUS,
+  CONTROL_START,
+  CONTROL_STOP,
+  CONTROL_RESET,
+  CONTROL_CONFIG,
+  CONTROL_STREAM
+};
+
+// ----- Fields of a command that were given ----- //
+#define CONTROL_SET_CHANNELS 0x01
+#define CONTROL_SET_AVERAGING 0x02
+#define CONTROL_SET_INTERVAL 0x04
+#define CONTROL_SET_SHUNT 0x08
+#define CONTROL_SET_FILTER 0x10
+#define CONTROL_SET_FORMAT 0x20
+#define CONTROL_SET_LOW_POWER 0x40
+#define CONTROL_SET_PHASES 0x80
+
+struct control_command
+{
+  control_action action;
+  uint8_t fields;       // CONTROL_SET_*
+  uint8_t channel_mask; // bit 0..2 for channel 1..3
+  uint8_t averaging;    // 1..5 for 1, 4, 16, 64, 128 samples, like the setup menu
+  uint32_t interval_ms;
+  uint32_t shunt_mohm[CHANNELS];
+  uint16_t filter_ohm[CHANNELS];
+  char separator;       // of the log file columns: ',' ';' or '\t'
+  uint8_t decimals;     // of the values in the log file
+  bool low_power;
+  float sleep_mA[CHANNELS];  // load phase thresholds
+  float active_mA[CHANNELS];
+  bool stream_on;
+};
+
+extern const uint8_t control_averaging_samples[5];
+
+bool control_parse(const char *json, size_t len, control_command &command, char *error, size_t size);
+bool control_parse_config(const char *json, size_t len, control_command &command, bool &autostart, char *error,
+                          size_t size); // /config.json: the fields of "config" plus "autostart", no "cmd"
+void control_begin(QueueHandle_t event_queue, uint8_t wake_event); // also starts reading the serial port
+bool control_submit(const control_command &command, char *reply, size_t size); // any task but loop(), waits for the reply
+bool control_next(control_command &command); // loop(): the waiting command, if any
+void control_done(const char *reply);        // loop(): answers it
+
+#endif
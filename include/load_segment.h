@@ -0,0 +1,68 @@
+/*--------------------------------------------------------------------------------
+Load state segmentation of a measurement channel
+
+A DUT that cycles between sleep and active bursts is split into phases by
+two current thresholds with hysteresis: a channel in sleep turns active when
+the current reaches active_mA, an active channel goes back to sleep when the
+current falls below sleep_mA. Samples in between keep the state, so the
+noise of a sleep current or the dips of a burst do not start new phases.
+
+Each phase is integrated over the sample interval like channel_state, and
+ends as a load_phase when the state changes or the session ends. The totals
+per state (phases, time, charge, energy) cover the session, like the
+statistics in channel_stats.h; a zeroed struct is an empty session.
+--------------------------------------------------------------------------------*/
+
+#ifndef LOAD_SEGMENT_H
+#define LOAD_SEGMENT_H
+
+#include <stdint.h>
+
+#define LOAD_STATES 2
+
+enum load_state : uint8_t
+{
+  LOAD_SLEEP,
+  LOAD_ACTIVE
+};
+
+extern const char *const load_state_names[LOAD_STATES]; // "sleep", "active"
+
+struct load_phase
+{
+  unsigned long session_ms; // millis() of the first sample of the session
+  uint8_t channel;          // 0 based
+  load_state state;
+  unsigned long start_ms;   // millis() of the first sample of the phase
+  uint32_t duration_ms;
+  float charge;             // mAh
+  float energy;             // mWh
+  float peak_mA;
+};
+
+struct phase_totals
+{
+  uint32_t phases;
+  uint32_t time_ms;
+  float charge; // mAh
+  float energy; // mWh
+};
+
+struct load_segmenter
+{
+  bool started;
+  load_state state;
+  unsigned long start_ms; // of the open phase
+  float charge;
+  float energy;
+  float peak_mA;
+  phase_totals totals[LOAD_STATES];
+};
+
+// A sample taken at time_ms; true if it ended a phase, which is then in ended
+bool segment_add(load_segmenter &seg, float sleep_mA, float active_mA, float load_voltage, float current_mA,
+                 unsigned long time_ms, unsigned long interval_ms, load_phase &ended);
+// Ends the open phase at end_ms, the end of the last sample interval; false if there is none
+bool segment_end(load_segmenter &seg, unsigned long end_ms, load_phase &ended);
+
+#endif
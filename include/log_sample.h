@@ -0,0 +1,29 @@
+/*--------------------------------------------------------------------------------
+One sample of all channels, as handed from loop() to the log file and the
+streaming outputs. Values of disabled channels are undefined.
+--------------------------------------------------------------------------------*/
+
+#ifndef LOG_SAMPLE_H
+#define LOG_SAMPLE_H
+
+#include <Arduino.h>
+
+#define CHANNELS 3
+
+struct log_sample
+{
+  uint32_t seq;          // running sample number, restarts with every measurement
+  unsigned long time_ms; // millis() when the sample was taken
+  unsigned long session_ms;  // millis() of the first sample of the measurement
+  unsigned long interval_ms; // sample interval when the sample was taken
+  uint64_t time_us;      // timebase (ntp_mono_us()) when the sample was taken
+  uint8_t channel_mask;  // bit 0..2 set for the enabled channels 1..3
+  char separator;        // log file format when the sample was taken, a file keeps the one of its first sample
+  uint8_t decimals;
+  float load_voltage[CHANNELS];
+  float current_mA[CHANNELS];
+  float energy[CHANNELS];
+  float capacity[CHANNELS];
+};
+
+#endif
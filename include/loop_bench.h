@@ -0,0 +1,64 @@
+/*--------------------------------------------------------------------------------
+Cycle counts of the loop() stages, reported as percentiles
+
+Build with -DLOOP_BENCH=1 (e.g. PLATFORMIO_BUILD_FLAGS=-DLOOP_BENCH=1) and
+every timed stage keeps the CPU cycles of its last LOOP_BENCH_SAMPLES runs.
+Every LOOP_BENCH_REPORT_MS loop() prints them to the serial port:
+
+  bench 160MHz  stage       n     p50     p90     p99     max  cycles
+  bench 160MHz  sample    300  129536  131712  140224  151680  (809.6us p50)
+  ...
+
+  sample    the whole sample stage of loop(), idle time excluded
+  measure   measure_values(), the INA3221 reads
+  display   displaydata(), includes battery
+  battery   get_battery_voltage(), the ADC reads
+  sd_write  write_file() in the SD writer task
+
+The cycles come from the CPU cycle counter (ESP.getCycleCount()), the us are
+converted with the current CPU frequency, which low power mode lowers. In the
+native build (sim/) the counter runs on host time at the same frequency, so
+the report of a host run reads like one from the target.
+
+Without LOOP_BENCH, bench_begin() and bench_end() compile to nothing.
+--------------------------------------------------------------------------------*/
+
+#ifndef LOOP_BENCH_H
+#define LOOP_BENCH_H
+
+#include <Arduino.h>
+
+#ifndef LOOP_BENCH
+#define LOOP_BENCH 0
+#endif
+
+#define LOOP_BENCH_SAMPLES 512     // runs per stage the percentiles are taken over
+#define LOOP_BENCH_REPORT_MS 60000
+
+enum bench_stage
+{
+  BENCH_SAMPLE,
+  BENCH_MEASURE,
+  BENCH_DISPLAY,
+  BENCH_BATTERY,
+  BENCH_SD_WRITE,
+  BENCH_STAGES
+};
+
+void bench_record(bench_stage stage, uint32_t cycles);
+void bench_report(); // loop(): prints the percentiles once LOOP_BENCH_REPORT_MS have passed
+
+inline uint32_t bench_begin()
+{
+  return LOOP_BENCH ? ESP.getCycleCount() : 0;
+}
+
+inline void bench_end(bench_stage stage, uint32_t begin)
+{
+  if (LOOP_BENCH)
+  {
+    bench_record(stage, ESP.getCycleCount() - begin);
+  }
+}
+
+#endif
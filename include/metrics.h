@@ -0,0 +1,72 @@
+/*--------------------------------------------------------------------------------
+Runtime metrics, served in the Prometheus text format at /metrics
+
+loop() and the SD writer task update the counters, the web task formats a
+consistent snapshot into a caller supplied buffer. Formatting uses fixed
+templates and snprintf only, a scrape allocates nothing.
+
+The runtime health is cheap enough to stay on: a sample is late when it is
+taken more than METRICS_DEADLINE_SLACK_MS after previousMillis + interval,
+counted with the worst and the summed delay (the schedule slips by that much,
+the next sample is due an interval after this one). The free heap low-water
+mark and the stack high-water marks of the registered tasks are read when a
+report is made, not per sample. metrics_health() formats all of it as one
+line for the serial port and the session summary:
+
+  late 3 worst 41ms slip 57ms heap min 171232 stack loop:5120 log:2312 web:3140
+--------------------------------------------------------------------------------*/
+
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <Arduino.h>
+#include "log_sample.h"
+
+#define METRICS_BUFFER_SIZE 6144 // enough for all metrics of three channels
+#define METRICS_DEADLINE_SLACK_MS 1 // millis() resolution, a sample this late is on time
+#define METRICS_TASKS 8             // tasks whose stack high-water mark is reported
+#define METRICS_HEALTH_SIZE 256     // metrics_health() line
+
+struct stage_timing
+{
+  uint32_t count;
+  uint64_t sum_us;
+  uint32_t max_us; // since boot
+};
+
+struct deadline_misses
+{
+  uint32_t count;    // samples taken late
+  uint32_t worst_ms; // since boot
+  uint32_t slip_ms;  // sum of the delays
+};
+
+struct logger_metrics
+{
+  log_sample last;       // most recent sample
+  bool running;          // a measurement is in progress
+  float battery_voltage;
+  uint32_t samples;      // since boot, across measurements
+  uint32_t log_dropped;  // samples the SD writer queue had no room for
+  stage_timing loop;     // sample stage of loop(): measure, display, hand over
+  stage_timing measure;  // INA3221 reads and integration
+  stage_timing display;  // display refresh
+  deadline_misses late;  // samples taken after their deadline
+  stage_timing sd_write; // one record written to the log file
+  stage_timing sd_flush; // log file flushed to the card
+};
+
+void metrics_sample(const log_sample &sample, float battery_voltage, uint32_t loop_us);
+void metrics_running(bool running);
+void metrics_log_dropped();
+void metrics_sd_write(uint32_t us);
+void metrics_sd_flush(uint32_t us);
+void metrics_measure(uint32_t us);
+void metrics_display(uint32_t us);
+void metrics_deadline(uint32_t late_ms); // every sample: how long after previousMillis + interval it was taken
+void metrics_task(const char *name, TaskHandle_t task); // report the stack high-water mark of a task
+deadline_misses metrics_late();
+size_t metrics_health(char *buffer, size_t size); // the line above, also reads the high-water marks
+size_t metrics_format(char *buffer, size_t size); // returns the length, 0 if the buffer was too small
+
+#endif
@@ -0,0 +1,60 @@
+/*--------------------------------------------------------------------------------
+MQTT telemetry
+
+A task averages the samples of every enabled channel over interval_ms and
+publishes `batch` of these points per message, one message per channel. When
+a measurement stops or restarts, its last points go out in a shorter message:
+
+  topic   <topic template>, {id} is replaced by the device id (pl-xxxxxx)
+          and {ch} by the channel number 1..3
+  payload {"t":[ms since 1970,...],"v":[V],"i":[mA],"p":[mW],"e":[mWh],
+           "c":[mAh],"dropped":n,"lost":n}
+
+While the broker is unreachable the points are kept in a bounded queue
+(MQTT_OFFLINE_POINTS), the oldest are dropped and counted once it is full
+("dropped", in points). Samples the task is too busy to take are counted as
+"lost". If a publish fails, the retry resumes with the channel that failed.
+Broker, topic, interval and batch are build flags (MQTT_HOST, MQTT_PORT,
+MQTT_TOPIC, MQTT_INTERVAL_MS, MQTT_BATCH).
+--------------------------------------------------------------------------------*/
+
+#ifndef MQTT_PUBLISHER_H
+#define MQTT_PUBLISHER_H
+
+#include <Arduino.h>
+#include "log_sample.h"
+
+#ifndef MQTT_HOST
+#define MQTT_HOST "" // no broker, publishing is disabled
+#endif
+#ifndef MQTT_PORT
+#define MQTT_PORT 1883
+#endif
+#ifndef MQTT_TOPIC
+#define MQTT_TOPIC "powerlogger/{id}/ch{ch}"
+#endif
+#ifndef MQTT_INTERVAL_MS
+#define MQTT_INTERVAL_MS 10000 // averaging interval of one point
+#endif
+#ifndef MQTT_BATCH
+#define MQTT_BATCH 6 // points per message, 1..MQTT_MAX_BATCH
+#endif
+
+#define MQTT_OFFLINE_POINTS 256 // 42 minutes at the default 10s interval
+#define MQTT_MAX_BATCH 12       // points per message, limited by the message buffer
+
+struct mqtt_settings
+{
+  char host[64];
+  uint16_t port;
+  char topic[64];
+  uint32_t interval_ms; // averaging interval of one point
+  uint8_t batch;        // points per message
+};
+
+extern mqtt_settings mqtt_config;
+
+void mqtt_begin(); // call once WiFi is connected, does nothing without a broker
+void mqtt_publish(const log_sample &sample); // never blocks
+
+#endif
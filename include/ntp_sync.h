@@ -0,0 +1,37 @@
+/*--------------------------------------------------------------------------------
+Non blocking NTP client with drift compensation
+
+All timestamps are taken from one 64 bit microsecond timebase (ntp_mono_us(),
+esp_timer, never wraps). ntp_epoch_us() maps it to the local wall clock.
+
+The server is asked again every NTP_RESYNC_MS, right after boot more often
+(from NTP_FIRST_RESYNC_MS on, doubled with every answer) to learn the crystal
+drift quickly. Every answer is fed into the clock model (clock_model.h), which
+corrects the drift as a rate and slews the offset out, timestamps always
+increase.
+
+A task sends the requests and blocks in recv(), so an answer is stamped when
+it arrives, not when loop() or the menu get around to it. ntp_sync_poll()
+only reports new answers, the caller never waits for the network.
+--------------------------------------------------------------------------------*/
+
+#ifndef NTP_SYNC_H
+#define NTP_SYNC_H
+
+#include <Arduino.h>
+
+#define NTP_RESYNC_MS 1024000UL  // regular resync interval (17 minutes)
+#define NTP_FIRST_RESYNC_MS 64000 // resync interval after the first answer
+
+void ntp_sync_begin(const char *server, long utc_offset_seconds);
+bool ntp_sync_poll(); // true once for every answer the task applied
+bool ntp_sync_due();  // no time yet or a resync is due, low power mode switches WiFi on for it
+void ntp_sync_reference(uint64_t mono_us, int64_t wall_us); // apply a reference time from elsewhere
+bool ntp_sync_valid();
+uint64_t ntp_mono_us();                     // the timebase, microseconds since boot
+uint64_t ntp_epoch_us(uint64_t mono_us);    // local wall clock in us since 1970 for a timebase stamp
+uint64_t ntp_epoch_ms(unsigned long at_ms); // same for a millis() stamp
+int32_t ntp_offset_us(); // error of the model found by the last answer
+int32_t ntp_drift_ppb(); // measured crystal drift, applied as rate correction
+
+#endif
@@ -0,0 +1,26 @@
+/*--------------------------------------------------------------------------------
+Fixed width numeric renderer
+
+Digits, '.', '-', ':' and ' ' of the classic 5x7 GFX font, pre-scaled to
+text size 2 (12x16 cells) into a 1 bit atlas at boot. A field is written
+through a single address window, one line buffer per pixel row, instead of
+the per pixel rectangles Adafruit_GFX::print uses at size 2.
+--------------------------------------------------------------------------------*/
+
+#ifndef NUMERIC_BLIT_H
+#define NUMERIC_BLIT_H
+
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+
+#define NUM_GLYPH_WIDTH 12
+#define NUM_GLYPH_HEIGHT 16
+#define NUM_MAX_CHARS 13 // a full line of the rotated 160px display
+
+void num_blit_init();
+// Draws text right aligned into a field of `chars` cells, unknown characters are drawn blank
+void num_blit_text(Adafruit_SPITFT &tft, int16_t x, int16_t y, const char *text, uint8_t chars, uint16_t fg, uint16_t bg);
+// Formats value right aligned into `chars` cells, dropping decimals when it does not fit
+void num_blit_float(Adafruit_SPITFT &tft, int16_t x, int16_t y, float value, uint8_t chars, uint8_t decimals, uint16_t fg, uint16_t bg);
+
+#endif
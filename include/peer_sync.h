@@ -0,0 +1,33 @@
+/*--------------------------------------------------------------------------------
+Time alignment of several loggers over the LAN
+
+One logger is built as master (-DPEER_SYNC_ROLE=PEER_SYNC_MASTER) and keeps
+using NTP, the others as peers (-DPEER_SYNC_ROLE=PEER_SYNC_PEER). Peers do not
+ask NTP, they exchange a broadcast request/response with the master once a
+second and feed the best exchange of every PEER_SYNC_WINDOW into their clock
+model, so their wall clocks follow the master's (protocol in
+peer_sync_protocol.h). The master only answers once its own clock was set by
+NTP. A task above the priority of loop() handles the packets,
+they are stamped as soon as they arrive.
+
+Every log file starts with a comment line describing the time source and the
+last offset estimate, see peer_sync_header().
+--------------------------------------------------------------------------------*/
+
+#ifndef PEER_SYNC_H
+#define PEER_SYNC_H
+
+#include <Arduino.h>
+
+#define PEER_SYNC_OFF 0
+#define PEER_SYNC_MASTER 1
+#define PEER_SYNC_PEER 2
+
+#ifndef PEER_SYNC_ROLE
+#define PEER_SYNC_ROLE PEER_SYNC_OFF
+#endif
+
+void peer_sync_begin(); // call once WiFi is connected
+void peer_sync_header(char *text, size_t size); // "# time=..." line for the log file header
+
+#endif
@@ -0,0 +1,112 @@
+/*--------------------------------------------------------------------------------
+Peer time sync protocol between loggers on one LAN
+
+All packets are UDP broadcasts to PEER_SYNC_PORT, little endian:
+
+  char     magic[2]     "PT"
+  uint8_t  version      1
+  uint8_t  type         1 = request (peer), 2 = response (master)
+  uint32_t peer_id      the requesting peer
+  uint32_t master_id    the answering master, 0 in requests
+  uint64_t t1           peer timebase when the request was sent, echoed
+  int64_t  t2           master wall clock (us) when the request arrived
+  int64_t  t3           master wall clock (us) when the response was sent
+
+With t4 the peer timebase when the response arrived, the network round trip
+is (t4 - t1) - (t3 - t2) and the master wall clock at t4 is t3 + round trip/2.
+Of every PEER_SYNC_WINDOW exchanges only the one with the shortest round trip
+is used, it has the least queueing delay and so the least asymmetry.
+
+Plain C++ without Arduino dependencies, tools/peer_sync_sim.cpp uses the same
+code.
+--------------------------------------------------------------------------------*/
+
+#ifndef PEER_SYNC_PROTOCOL_H
+#define PEER_SYNC_PROTOCOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define PEER_SYNC_PORT 5006
+#define PEER_SYNC_VERSION 1
+#define PEER_SYNC_REQUEST 1
+#define PEER_SYNC_RESPONSE 2
+#define PEER_SYNC_PACKET_SIZE 36
+#define PEER_SYNC_INTERVAL_MS 1000 // one exchange per second
+#define PEER_SYNC_WINDOW 8         // exchanges per applied offset
+
+struct peer_sync_packet
+{
+  uint8_t type;
+  uint32_t peer_id;
+  uint32_t master_id;
+  uint64_t t1;
+  int64_t t2;
+  int64_t t3;
+};
+
+// ----- Best exchange of the current window ----- //
+struct peer_sync_filter
+{
+  int count;
+  int64_t round_trip_us;
+  uint64_t mono_us;    // peer timebase at t4
+  int64_t master_us;   // master wall clock at t4
+};
+
+inline size_t peer_sync_encode(const peer_sync_packet &packet, uint8_t *buffer)
+{
+  buffer[0] = 'P';
+  buffer[1] = 'T';
+  buffer[2] = PEER_SYNC_VERSION;
+  buffer[3] = packet.type;
+  memcpy(buffer + 4, &packet.peer_id, 4); // both ends are little endian
+  memcpy(buffer + 8, &packet.master_id, 4);
+  memcpy(buffer + 12, &packet.t1, 8);
+  memcpy(buffer + 20, &packet.t2, 8);
+  memcpy(buffer + 28, &packet.t3, 8);
+  return PEER_SYNC_PACKET_SIZE;
+}
+
+inline bool peer_sync_decode(const uint8_t *buffer, size_t len, peer_sync_packet &packet)
+{
+  if (len < PEER_SYNC_PACKET_SIZE || buffer[0] != 'P' || buffer[1] != 'T' || buffer[2] != PEER_SYNC_VERSION)
+  {
+    return false;
+  }
+  packet.type = buffer[3];
+  memcpy(&packet.peer_id, buffer + 4, 4);
+  memcpy(&packet.master_id, buffer + 8, 4);
+  memcpy(&packet.t1, buffer + 12, 8);
+  memcpy(&packet.t2, buffer + 20, 8);
+  memcpy(&packet.t3, buffer + 28, 8);
+  return true;
+}
+
+// ----- Adds the exchange completed at t4, true once the window is full ----- //
+inline bool peer_sync_filter_add(peer_sync_filter &filter, const peer_sync_packet &response, uint64_t t4)
+{
+  int64_t round_trip = (int64_t)(t4 - response.t1) - (response.t3 - response.t2);
+  if (round_trip < 0)
+  {
+    round_trip = 0;
+  }
+  if (filter.count == 0 || round_trip < filter.round_trip_us)
+  {
+    filter.round_trip_us = round_trip;
+    filter.mono_us = t4;
+    filter.master_us = response.t3 + round_trip / 2;
+  }
+  filter.count++;
+  return filter.count >= PEER_SYNC_WINDOW;
+}
+
+// ----- Master wall clock at now_us, carried forward from the best exchange at the given rate ----- //
+inline int64_t peer_sync_filter_master_at(const peer_sync_filter &filter, uint64_t now_us, int32_t rate_ppb)
+{
+  int64_t dt = (int64_t)(now_us - filter.mono_us);
+  return filter.master_us + dt + dt * rate_ppb / 1000000000LL;
+}
+
+#endif
@@ -0,0 +1,752 @@
+// Generated by  : tools/bmp_rle.py, do not edit
+// Generated from: assets/powerlogger_bmp.h
+// Dimensions    : 160x128 pixels
+// Size          : 11779 Bytes (raw 40960 Bytes)
+
+#include <pgmspace.h>
+
+#define powerLogger_width 160
+#define powerLogger_height 128
+
+const uint16_t powerLogger_palette[32] PROGMEM = {
+    0x0063, 0x0001, 0x0043, 0x08a4, 0x0909, 0x0022, 0x0085, 0xf820,
+    0x08a5, 0xdfa1, 0x1949, 0x0023, 0x428f, 0x00a7, 0x20a5, 0xd083,
+    0x0044, 0x0844, 0xa823, 0xaca4, 0xcf02, 0x1969, 0x6949, 0x0006,
+    0x5bd0, 0x7539, 0x19cb, 0x224e, 0x00e8, 0x016b, 0x08e6, 0x29c5,
+};
+
+const uint8_t powerLogger_rle[11715] PROGMEM = {
+    0x25, 0x00, 0x05, 0x01, 0x05, 0x01, 0x45, 0xe1, 0xa1, 0xe5, 0x25, 0x61, 0x05, 0x0b, 0x30, 0x11,
+    0x02, 0x25, 0x02, 0x11, 0x22, 0xe5, 0x65, 0x4b, 0x28, 0x06, 0x30, 0x08, 0x1e, 0x0b, 0x22, 0x25,
+    0x82, 0xa5, 0x2b, 0x45, 0x01, 0x25, 0x10, 0x06, 0x1e, 0x08, 0x10, 0x65, 0x22, 0xe5, 0x05, 0xe1,
+    0xe1, 0x81, 0x65, 0x21, 0x05, 0xe1, 0xe1, 0x01, 0x45, 0x01, 0x05, 0x01, 0x65, 0x21, 0x25, 0xe1,
+    0x01, 0xe5, 0x45, 0x21, 0x05, 0x0b, 0x30, 0x31, 0x2b, 0x10, 0x11, 0x10, 0x42, 0x40, 0x22, 0x65,
+    0x42, 0x2b, 0x10, 0x28, 0x06, 0x0b, 0x02, 0x08, 0x03, 0x0b, 0x05, 0x02, 0x20, 0x02, 0x80, 0xa2,
+    0x20, 0x25, 0x02, 0x00, 0x48, 0x03, 0x0b, 0x65, 0x00, 0x11, 0x02, 0xe5, 0xe1, 0xe1, 0xc1, 0x65,
+    0x01, 0x00, 0x05, 0xe1, 0xc1, 0x05, 0x00, 0x05, 0x01, 0x05, 0x01, 0xe5, 0x01, 0xe5, 0xc5, 0x02,
+    0x65, 0x0b, 0x02, 0x30, 0x03, 0x0b, 0x05, 0x0b, 0x28, 0x10, 0x0b, 0xe5, 0x85, 0x22, 0x30, 0x0b,
+    0x10, 0x28, 0x03, 0x10, 0x02, 0x28, 0x03, 0x02, 0x25, 0x02, 0x00, 0xe5, 0x05, 0x0b, 0x65, 0x02,
+    0x00, 0x03, 0x06, 0x00, 0x02, 0x65, 0x02, 0x03, 0x08, 0x11, 0x0b, 0x25, 0x01, 0xa5, 0xe1, 0xe1,
+    0xa1, 0x45, 0xe1, 0x01, 0xe5, 0x25, 0x00, 0x05, 0x41, 0xe5, 0xe5, 0xe5, 0x45, 0x0b, 0x10, 0x11,
+    0x08, 0x11, 0x22, 0x25, 0x10, 0x08, 0x10, 0x0b, 0xe5, 0x02, 0x85, 0x22, 0x50, 0x0b, 0x10, 0x48,
+    0x02, 0x0b, 0x68, 0xe3, 0x63, 0x28, 0x23, 0x48, 0x00, 0x85, 0x0b, 0x05, 0x02, 0x03, 0x08, 0x11,
+    0x45, 0x01, 0xe5, 0x25, 0xa1, 0x05, 0xe1, 0x61, 0x45, 0x81, 0x05, 0xe1, 0x21, 0x25, 0x00, 0x45,
+    0x01, 0x85, 0x21, 0xe5, 0xe5, 0x25, 0x21, 0x0b, 0x11, 0x28, 0x11, 0x0b, 0x01, 0x11, 0x08, 0x10,
+    0x2b, 0x02, 0x05, 0x42, 0x45, 0x22, 0x45, 0x40, 0xf0, 0x08, 0x1e, 0x06, 0x30, 0x03, 0x28, 0x26,
+    0xe3, 0x83, 0x28, 0x03, 0x85, 0x22, 0x25, 0x22, 0x0b, 0x65, 0x01, 0xe5, 0xa5, 0x01, 0x25, 0xc1,
+    0x25, 0x41, 0x25, 0xe1, 0xe1, 0xe5, 0xe5, 0xe5, 0x25, 0x42, 0x85, 0x0b, 0x11, 0x08, 0x11, 0x02,
+    0x05, 0x02, 0x23, 0x02, 0x0b, 0x22, 0x2b, 0x85, 0x02, 0x05, 0x22, 0x05, 0x42, 0x00, 0x30, 0x03,
+    0x11, 0x22, 0x10, 0x28, 0x1e, 0x08, 0x10, 0x0b, 0x25, 0x0b, 0x02, 0xe5, 0x65, 0x0b, 0x22, 0x05,
+    0x00, 0x02, 0x20, 0x22, 0x00, 0x02, 0x8b, 0x45, 0x01, 0xe5, 0xa5, 0x01, 0x25, 0xe1, 0x21, 0x05,
+    0x41, 0x25, 0xe1, 0xe1, 0xe5, 0x05, 0x22, 0xe5, 0x85, 0x42, 0xa5, 0x22, 0x2b, 0x02, 0x08, 0x10,
+    0x2b, 0x22, 0x2b, 0x22, 0x25, 0x02, 0x00, 0x22, 0x00, 0x02, 0x65, 0x02, 0x10, 0x00, 0x11, 0x00,
+    0x2b, 0x23, 0x10, 0x06, 0x3e, 0x08, 0x10, 0x06, 0x08, 0x06, 0xe3, 0x63, 0x08, 0x1e, 0x08, 0x03,
+    0x60, 0x05, 0x02, 0x00, 0x22, 0x0b, 0x02, 0x11, 0x03, 0x00, 0x02, 0x05, 0x02, 0x80, 0x22, 0x00,
+    0x82, 0x65, 0xe1, 0x21, 0x05, 0x61, 0x65, 0xe1, 0x81, 0x85, 0x01, 0x45, 0x20, 0x02, 0x05, 0x01,
+    0xe5, 0xe5, 0xa5, 0x00, 0x08, 0x30, 0x02, 0x45, 0x0b, 0x02, 0x00, 0x02, 0x45, 0x20, 0x11, 0x42,
+    0x20, 0x22, 0x00, 0x02, 0x2b, 0x22, 0x0b, 0x02, 0x08, 0x26, 0x08, 0x1e, 0x0a, 0x3e, 0x0a, 0xfe,
+    0x1e, 0x0e, 0x5e, 0x0a, 0x1e, 0x03, 0x05, 0x02, 0x20, 0x25, 0x42, 0x0b, 0x00, 0x28, 0x63, 0x48,
+    0x23, 0x20, 0xe3, 0x25, 0xe1, 0x81, 0x85, 0xe1, 0x61, 0xa5, 0x81, 0x25, 0x42, 0xe1, 0x85, 0x0b,
+    0xa5, 0x02, 0x28, 0x10, 0x05, 0x22, 0x0b, 0x05, 0x22, 0x0b, 0xf0, 0x8b, 0x42, 0x2b, 0x05, 0x0b,
+    0x10, 0x0b, 0x25, 0x08, 0x50, 0x2b, 0x30, 0xe2, 0x42, 0x0b, 0x03, 0x1e, 0x08, 0x10, 0x20, 0x45,
+    0x42, 0x10, 0x06, 0x28, 0x00, 0x01, 0x05, 0x02, 0x05, 0x02, 0x20, 0xe5, 0x85, 0x20, 0x65, 0x41,
+    0x45, 0x81, 0x85, 0x01, 0xe5, 0xa5, 0xa1, 0x25, 0x0b, 0x22, 0x40, 0x62, 0x10, 0x42, 0x10, 0x11,
+    0x10, 0x22, 0x31, 0x43, 0x02, 0x25, 0x0b, 0x02, 0x2b, 0x22, 0x0b, 0x10, 0x5e, 0x0d, 0x28, 0x03,
+    0x08, 0xcd, 0x06, 0x5e, 0x48, 0x0b, 0x06, 0x08, 0x02, 0x05, 0x02, 0x0b, 0x05, 0x70, 0x20, 0x10,
+    0x20, 0x10, 0x26, 0x70, 0x02, 0x06, 0x00, 0x05, 0x01, 0x00, 0x02, 0x10, 0x02, 0x48, 0x10, 0x02,
+    0x45, 0x02, 0x25, 0x02, 0xe5, 0xa5, 0x02, 0x20, 0x02, 0x05, 0x81, 0x05, 0xe1, 0x01, 0x25, 0x01,
+    0x25, 0xa1, 0x65, 0x81, 0x85, 0x02, 0x50, 0x20, 0x22, 0x00, 0x31, 0x22, 0x91, 0x08, 0x31, 0x00,
+    0x25, 0x01, 0x0b, 0x02, 0x00, 0x22, 0x10, 0x02, 0x0b, 0x10, 0x9e, 0x28, 0xfe, 0x04, 0x3e, 0x2e,
+    0x2a, 0x0d, 0x0b, 0x03, 0x08, 0x10, 0x05, 0x06, 0x03, 0x00, 0x70, 0x20, 0x30, 0x63, 0x06, 0x22,
+    0x03, 0x06, 0x00, 0x05, 0x03, 0x20, 0x02, 0x08, 0x0e, 0x1e, 0x10, 0x0b, 0x05, 0x02, 0x00, 0x10,
+    0x00, 0x42, 0x20, 0x02, 0x05, 0x02, 0x4b, 0x22, 0x85, 0x00, 0x03, 0x00, 0x05, 0x81, 0x65, 0x61,
+    0x45, 0xe1, 0x01, 0x85, 0x81, 0x85, 0x0b, 0xe5, 0xe5, 0x4b, 0x25, 0x21, 0x05, 0x22, 0x80, 0x02,
+    0x31, 0x28, 0x06, 0x10, 0x0b, 0xe2, 0x00, 0x30, 0x00, 0x02, 0x11, 0x10, 0x08, 0x15, 0x1e, 0x10,
+    0x02, 0x08, 0x06, 0x10, 0x03, 0x08, 0x66, 0x50, 0x06, 0x03, 0x10, 0x00, 0x26, 0x20, 0x03, 0x10,
+    0x00, 0x08, 0x00, 0x03, 0x00, 0x08, 0x1e, 0x08, 0x26, 0x3e, 0x03, 0x20, 0x05, 0x22, 0x00, 0x10,
+    0x22, 0xe5, 0x05, 0x02, 0x25, 0x02, 0x00, 0x05, 0x01, 0x65, 0x21, 0x05, 0x0b, 0x10, 0x0c, 0x1a,
+    0x08, 0x45, 0x20, 0x85, 0x41, 0xa5, 0x61, 0xa5, 0x21, 0x05, 0xe1, 0x81, 0xa5, 0x0b, 0x25, 0x0b,
+    0x22, 0x20, 0x22, 0x05, 0x0b, 0x10, 0x26, 0x70, 0xe6, 0x06, 0x30, 0x06, 0x30, 0x06, 0x1a, 0x04,
+    0x06, 0x10, 0x28, 0x06, 0x1e, 0x08, 0x1e, 0x28, 0x03, 0xe6, 0x06, 0x20, 0x02, 0x08, 0x30, 0x0b,
+    0x3e, 0x08, 0x02, 0x10, 0x5e, 0x03, 0x22, 0x05, 0x20, 0x11, 0x10, 0xe2, 0x42, 0xc5, 0x01, 0x25,
+    0x41, 0x05, 0x02, 0x08, 0x1b, 0x0a, 0x10, 0x0b, 0x02, 0x25, 0x01, 0x85, 0x41, 0xa5, 0x81, 0x85,
+    0x21, 0x05, 0x61, 0x45, 0x61, 0xa5, 0x00, 0x48, 0x0b, 0x42, 0x05, 0x4b, 0x06, 0x08, 0x5e, 0x04,
+    0x0a, 0x44, 0x8a, 0x15, 0x0a, 0x15, 0x3a, 0x3b, 0x1a, 0x26, 0x0a, 0x15, 0x08, 0x10, 0x06, 0x08,
+    0x06, 0x5e, 0x46, 0x10, 0x06, 0x00, 0x23, 0x10, 0x00, 0x10, 0x06, 0x00, 0x03, 0x02, 0x30, 0x3e,
+    0x08, 0x0b, 0x02, 0x06, 0x24, 0x1e, 0x03, 0x05, 0x01, 0x20, 0x11, 0x10, 0x42, 0x00, 0x25, 0x6b,
+    0xe5, 0x45, 0x41, 0x25, 0x10, 0x28, 0x06, 0x0b, 0x25, 0xe1, 0x41, 0x25, 0x22, 0x0b, 0xe5, 0xe5,
+    0xe5, 0x65, 0x22, 0x0b, 0x10, 0x5e, 0x10, 0x22, 0x4b, 0x10, 0x06, 0x0d, 0x28, 0x03, 0x00, 0x26,
+    0x10, 0x66, 0x23, 0x26, 0x08, 0x3e, 0x1c, 0x04, 0x1a, 0x3b, 0x26, 0x04, 0x15, 0x1e, 0x50, 0x2d,
+    0x26, 0x10, 0x00, 0x22, 0x0b, 0x00, 0x10, 0x02, 0x0b, 0x02, 0x40, 0x02, 0x10, 0x0a, 0x1e, 0x08,
+    0x0b, 0x00, 0x5e, 0x0d, 0x06, 0x10, 0x60, 0x02, 0x0b, 0x02, 0x10, 0xe2, 0x22, 0xe5, 0x25, 0x21,
+    0x20, 0x22, 0x85, 0xe1, 0x61, 0x05, 0x20, 0x02, 0xe5, 0xe5, 0x45, 0xe2, 0x05, 0x22, 0x0b, 0x10,
+    0x3e, 0x08, 0x90, 0x06, 0x0d, 0x04, 0x1e, 0x06, 0x05, 0x41, 0xe5, 0x25, 0x41, 0x05, 0x10, 0x17,
+    0x1d, 0x2c, 0x04, 0x06, 0x1e, 0x1a, 0x0a, 0x30, 0x4d, 0x26, 0x10, 0x20, 0x23, 0x11, 0x50, 0x26,
+    0x05, 0x08, 0x2a, 0x08, 0x0b, 0x11, 0x0e, 0x1e, 0x0d, 0x46, 0x02, 0x25, 0x20, 0x02, 0x11, 0x08,
+    0x1e, 0x03, 0x00, 0x25, 0x8b, 0x05, 0x02, 0xe5, 0x45, 0x20, 0x05, 0x61, 0x65, 0xe1, 0x01, 0x20,
+    0x01, 0x05, 0x10, 0x03, 0x00, 0x05, 0x22, 0xe5, 0xe5, 0xa5, 0x0b, 0x02, 0x0b, 0x05, 0x02, 0x08,
+    0x1e, 0x06, 0x50, 0x31, 0x0a, 0x1d, 0x04, 0x10, 0x08, 0x2a, 0x15, 0xca, 0x75, 0x1a, 0x1b, 0x38,
+    0x39, 0x18, 0x17, 0x1b, 0x0c, 0x15, 0x10, 0x04, 0x1a, 0x15, 0x00, 0x28, 0x10, 0x0b, 0x02, 0x00,
+    0x11, 0x03, 0x08, 0x1e, 0x46, 0x28, 0x11, 0x24, 0x1e, 0x11, 0x05, 0x10, 0x0a, 0x1e, 0x03, 0x06,
+    0x0d, 0x0a, 0x04, 0x06, 0x0b, 0x11, 0x03, 0x00, 0x0b, 0x06, 0x04, 0x15, 0x11, 0x05, 0x01, 0x05,
+    0x01, 0xe5, 0x65, 0x01, 0x25, 0x20, 0x02, 0x65, 0x02, 0x20, 0xe5, 0x61, 0x05, 0x00, 0x25, 0x0b,
+    0x02, 0x20, 0x01, 0xe5, 0xa5, 0x02, 0x00, 0xc5, 0x2b, 0x25, 0x10, 0x28, 0x06, 0x28, 0x37, 0x1b,
+    0x0a, 0x0d, 0x10, 0x04, 0xf5, 0xd5, 0x1a, 0x0c, 0x18, 0x79, 0x18, 0x06, 0x1a, 0x1b, 0x1a, 0x0b,
+    0x08, 0x3a, 0x2d, 0x06, 0x6d, 0x06, 0x02, 0x7e, 0x30, 0x1e, 0x0a, 0x1e, 0x0b, 0x05, 0x1e, 0x15,
+    0x1e, 0x08, 0x05, 0x06, 0x1e, 0x24, 0x08, 0x11, 0x00, 0x03, 0x05, 0x00, 0x03, 0x0a, 0x1e, 0x06,
+    0x45, 0x21, 0x05, 0x22, 0xc5, 0x01, 0x05, 0x02, 0x40, 0x21, 0x65, 0x22, 0xa5, 0x01, 0x45, 0x21,
+    0x45, 0x22, 0x2b, 0x20, 0x05, 0x01, 0x45, 0x21, 0xa5, 0x0b, 0x02, 0x00, 0x45, 0x02, 0x05, 0x0b,
+    0x22, 0x00, 0x25, 0x0b, 0x3e, 0x06, 0x11, 0x17, 0x1d, 0x0c, 0x04, 0x17, 0x3a, 0x1b, 0x1e, 0x10,
+    0x03, 0x48, 0x03, 0xe8, 0x08, 0x1e, 0x1b, 0x2c, 0x18, 0x39, 0x18, 0x0b, 0x15, 0x1a, 0x15, 0x10,
+    0x08, 0x0a, 0x3a, 0x75, 0x3a, 0x0a, 0x10, 0x0d, 0x1e, 0x06, 0x10, 0x15, 0x04, 0x1e, 0x0b, 0x02,
+    0x1e, 0x2a, 0x03, 0x02, 0x30, 0x0d, 0x24, 0x11, 0x05, 0x10, 0x25, 0x00, 0x05, 0x0e, 0x1e, 0x03,
+    0x0b, 0x05, 0x01, 0x05, 0x00, 0x45, 0x01, 0x85, 0x01, 0x05, 0x00, 0x03, 0x00, 0x65, 0x00, 0x05,
+    0x01, 0x85, 0x21, 0xc5, 0x01, 0x45, 0x00, 0x03, 0x02, 0x25, 0x03, 0x00, 0xe5, 0xe5, 0x65, 0x22,
+    0x00, 0x02, 0x25, 0x10, 0x1e, 0x08, 0x30, 0x1d, 0x1b, 0x3a, 0x19, 0x38, 0x0a, 0x30, 0x0b, 0x06,
+    0x10, 0x0b, 0x10, 0xcb, 0x10, 0x02, 0x0b, 0x77, 0x1a, 0x38, 0x0c, 0x01, 0x08, 0x3a, 0x10, 0x0d,
+    0x5e, 0x24, 0x1c, 0x24, 0x3a, 0x04, 0x10, 0x1e, 0x35, 0x17, 0x30, 0x0a, 0x15, 0x1e, 0x06, 0x10,
+    0x22, 0x0b, 0x06, 0x24, 0x10, 0x0d, 0x3b, 0x1c, 0x2b, 0x0a, 0x1e, 0x10, 0x05, 0x0d, 0x0b, 0x05,
+    0x0b, 0x05, 0x0b, 0x65, 0x21, 0x45, 0x20, 0x05, 0x21, 0x05, 0x00, 0x03, 0xc0, 0x02, 0x25, 0x4b,
+    0x45, 0x02, 0x01, 0x05, 0x21, 0x02, 0x03, 0x00, 0x01, 0x05, 0x23, 0x05, 0x01, 0x05, 0x02, 0x25,
+    0x21, 0x25, 0x02, 0x25, 0x01, 0x05, 0x00, 0x25, 0x02, 0x00, 0x05, 0x0b, 0x05, 0x0b, 0x0e, 0x1e,
+    0x06, 0x30, 0x1d, 0x1a, 0x1d, 0x0d, 0x18, 0x59, 0x0d, 0x1c, 0x15, 0x04, 0x2a, 0x04, 0xf5, 0x15,
+    0x0a, 0x15, 0x1a, 0x3b, 0x1a, 0x0d, 0x17, 0x1a, 0x2c, 0x05, 0x08, 0x15, 0x0c, 0x06, 0x0d, 0x86,
+    0x10, 0x0b, 0x06, 0x1a, 0x0a, 0x04, 0x1a, 0x15, 0x06, 0x10, 0x06, 0x35, 0x1e, 0x0d, 0x06, 0x10,
+    0x02, 0x0b, 0x05, 0x10, 0x1d, 0x1a, 0x06, 0x1b, 0x19, 0x18, 0x0c, 0x04, 0x0b, 0x1e, 0x0e, 0x10,
+    0x1e, 0x04, 0x0c, 0x38, 0x0d, 0x26, 0x80, 0x23, 0x20, 0x25, 0x00, 0x45, 0x20, 0xc5, 0x01, 0x05,
+    0x0b, 0x02, 0x0b, 0x45, 0x02, 0x25, 0x21, 0x05, 0x03, 0x20, 0x05, 0x02, 0x06, 0x03, 0x00, 0x25,
+    0x0b, 0xe5, 0x85, 0x00, 0x02, 0x25, 0x02, 0x08, 0x0e, 0x06, 0x10, 0x06, 0x0a, 0x1a, 0x04, 0x17,
+    0x18, 0x39, 0x18, 0x0c, 0x3a, 0x04, 0x0a, 0x04, 0x15, 0xea, 0x6a, 0x15, 0x1a, 0x1d, 0x1b, 0x1a,
+    0x04, 0x10, 0x0a, 0x1b, 0x0c, 0x1e, 0x0b, 0x15, 0x1b, 0x1a, 0x1d, 0x04, 0x1c, 0x6d, 0x1e, 0x1c,
+    0x1a, 0x1b, 0x1e, 0x06, 0x04, 0x15, 0x1a, 0x15, 0x2d, 0x26, 0x08, 0x0b, 0x02, 0x05, 0x08, 0x1a,
+    0x1d, 0x04, 0x59, 0x1b, 0x1c, 0x15, 0x04, 0x08, 0x10, 0x0d, 0x1d, 0x18, 0x19, 0x18, 0x04, 0x3e,
+    0x48, 0x63, 0x00, 0x45, 0x00, 0x02, 0x25, 0x02, 0x05, 0x01, 0x05, 0x41, 0x25, 0x01, 0xe5, 0x02,
+    0x05, 0x01, 0x05, 0x03, 0x00, 0x02, 0x23, 0x22, 0x23, 0x02, 0x05, 0x22, 0x4b, 0x22, 0x4b, 0x50,
+    0x02, 0x4b, 0x06, 0x1e, 0x0e, 0x30, 0x06, 0x04, 0x0a, 0x06, 0x1c, 0x0c, 0x39, 0x0c, 0x3b, 0x0c,
+    0x0a, 0x10, 0x11, 0x10, 0x08, 0x06, 0x10, 0xe6, 0x08, 0x06, 0x28, 0x06, 0x1e, 0x0a, 0x1a, 0x15,
+    0x10, 0x04, 0x3b, 0x15, 0x06, 0x5b, 0xba, 0x15, 0x3a, 0x15, 0x02, 0x08, 0x3a, 0x1b, 0x2d, 0x1e,
+    0x06, 0x10, 0x08, 0x0b, 0x02, 0x08, 0x35, 0x1d, 0x1b, 0x19, 0x18, 0x0c, 0x1a, 0x35, 0x2d, 0x1e,
+    0x0a, 0x04, 0x1a, 0x2c, 0x0d, 0x06, 0x10, 0x08, 0x03, 0x00, 0x22, 0x00, 0x22, 0x05, 0x02, 0x65,
+    0x02, 0x85, 0x21, 0x45, 0x61, 0x65, 0x10, 0x22, 0x03, 0x28, 0x10, 0x02, 0x06, 0x08, 0x06, 0x22,
+    0x28, 0x11, 0x68, 0x30, 0x68, 0x3e, 0x06, 0x2b, 0x08, 0x1e, 0x08, 0x30, 0x0d, 0x15, 0x04, 0x10,
+    0x1e, 0x1b, 0x18, 0x0c, 0x1d, 0x1b, 0x2c, 0x1a, 0x10, 0x0a, 0x08, 0x06, 0x0d, 0x06, 0x0d, 0xa6,
+    0x2d, 0x06, 0x2d, 0x06, 0x0a, 0x08, 0x10, 0x0a, 0x1b, 0x1a, 0x06, 0x10, 0x5b, 0x0d, 0x1a, 0x15,
+    0x64, 0x7e, 0x08, 0x11, 0x0b, 0x10, 0x35, 0x04, 0x06, 0x08, 0x11, 0x4b, 0x05, 0x1e, 0x2a, 0x1e,
+    0x1a, 0x1b, 0x1a, 0x01, 0x04, 0x1a, 0x15, 0x10, 0x0b, 0x04, 0x15, 0x0a, 0x08, 0x01, 0x25, 0x10,
+    0x08, 0x06, 0x10, 0x42, 0x06, 0x03, 0x06, 0x00, 0x06, 0x20, 0x23, 0x60, 0xe5, 0x81, 0x25, 0x00,
+    0x0b, 0x03, 0x02, 0x00, 0x03, 0x08, 0x05, 0x02, 0x11, 0x03, 0x00, 0x02, 0x0b, 0x02, 0xf0, 0x30,
+    0x08, 0x0d, 0x1e, 0x08, 0x06, 0x00, 0x4d, 0x30, 0x0d, 0x15, 0x04, 0x0b, 0x0a, 0x1a, 0x1b, 0x15,
+    0x0b, 0x1a, 0x0c, 0x3b, 0x17, 0x38, 0x1b, 0x15, 0x04, 0x0a, 0x1a, 0x15, 0x0a, 0x1a, 0x35, 0x0a,
+    0x1a, 0x0a, 0x3a, 0x35, 0x0c, 0x19, 0x18, 0x0d, 0x04, 0x1b, 0x1a, 0x1e, 0x17, 0x3b, 0x0c, 0x30,
+    0x05, 0x02, 0x17, 0x03, 0x1c, 0x15, 0x1d, 0x0a, 0x1c, 0x1e, 0x1c, 0x0a, 0x04, 0x0a, 0x04, 0x15,
+    0x04, 0x1e, 0x04, 0x1c, 0x15, 0x0a, 0x15, 0x1e, 0x04, 0x35, 0x1e, 0x0b, 0x15, 0x1a, 0x0a, 0x03,
+    0x05, 0x1e, 0x15, 0x04, 0x1c, 0x03, 0x20, 0x10, 0x03, 0x08, 0x10, 0x20, 0x10, 0x03, 0x1e, 0x08,
+    0x06, 0x03, 0x00, 0x08, 0x03, 0xa6, 0x40, 0xc5, 0x61, 0x25, 0x11, 0x08, 0x0b, 0x05, 0x1e, 0x11,
+    0x05, 0x02, 0xa5, 0x2b, 0x02, 0xab, 0x10, 0x05, 0x10, 0x05, 0x10, 0x11, 0x08, 0x0e, 0x08, 0x06,
+    0x1e, 0x04, 0x15, 0x00, 0x01, 0x1f, 0x1a, 0x15, 0x06, 0x10, 0x1d, 0x3a, 0x04, 0x0d, 0x1b, 0x38,
+    0x1a, 0x1c, 0x1d, 0x04, 0x0a, 0x24, 0x2a, 0x15, 0x0a, 0x1d, 0x0a, 0x1a, 0x04, 0x1d, 0x04, 0x1b,
+    0x18, 0x19, 0x1b, 0x17, 0x08, 0x3b, 0x04, 0x10, 0x15, 0x0c, 0x18, 0x01, 0x11, 0x1e, 0x06, 0x00,
+    0x1a, 0x5b, 0x3a, 0x15, 0x1a, 0x15, 0x5d, 0x3a, 0x55, 0x1a, 0x0e, 0x2a, 0x15, 0x10, 0x0b, 0x1a,
+    0x0a, 0x04, 0x02, 0x01, 0x15, 0x0a, 0x1c, 0x04, 0x46, 0x0d, 0x08, 0x03, 0x02, 0x00, 0x05, 0x0b,
+    0x08, 0x1e, 0x03, 0x0b, 0x06, 0x03, 0xe5, 0xe5, 0x05, 0x22, 0x25, 0x41, 0x05, 0x10, 0x08, 0x2b,
+    0x1e, 0x10, 0x0b, 0xe5, 0x05, 0xe2, 0x02, 0x10, 0x05, 0x11, 0x03, 0x0e, 0x06, 0x10, 0x04, 0x1c,
+    0x04, 0x0d, 0x10, 0x0a, 0x1a, 0x0a, 0x06, 0x00, 0x35, 0x24, 0x1d, 0x5a, 0x0a, 0x06, 0x1e, 0x1c,
+    0x1e, 0x0d, 0x7e, 0x1c, 0x0d, 0x04, 0x1d, 0x1c, 0x26, 0x1c, 0x0d, 0x1a, 0x3b, 0x1a, 0x2d, 0x3b,
+    0x15, 0x17, 0x15, 0x0c, 0x19, 0x04, 0x10, 0x1d, 0x04, 0x1d, 0x3b, 0x1d, 0x1c, 0x04, 0x1e, 0x04,
+    0x3c, 0x04, 0x1c, 0x06, 0x1e, 0x1c, 0x06, 0x08, 0x1e, 0x3a, 0x08, 0x05, 0x06, 0x1a, 0x15, 0x08,
+    0x11, 0x00, 0x1e, 0x15, 0x1e, 0x0d, 0x00, 0x11, 0x08, 0x03, 0x00, 0x10, 0x08, 0x46, 0x0a, 0x0e,
+    0x10, 0x06, 0x01, 0x05, 0x0b, 0x02, 0x45, 0xa1, 0xa5, 0x01, 0x0b, 0x02, 0x20, 0x05, 0x41, 0x11,
+    0x08, 0x10, 0x0b, 0x30, 0x0b, 0x05, 0x01, 0xe5, 0x85, 0x22, 0x00, 0x10, 0x08, 0x3e, 0x08, 0x06,
+    0x08, 0x0d, 0x35, 0x04, 0x3a, 0x04, 0x05, 0x0d, 0x3a, 0x08, 0x17, 0x1a, 0x15, 0x1a, 0x03, 0x17,
+    0x10, 0x1c, 0x3e, 0x1c, 0x0a, 0x04, 0x0d, 0x1c, 0x4d, 0x5b, 0x7a, 0x1c, 0x0d, 0x1d, 0x3b, 0x0a,
+    0x0d, 0x1a, 0x3b, 0x0d, 0x1d, 0x39, 0x0c, 0x1d, 0x04, 0x37, 0x10, 0x17, 0x05, 0x11, 0x05, 0x06,
+    0x08, 0x02, 0x06, 0x1d, 0x15, 0x10, 0x08, 0x1e, 0x15, 0x1a, 0x1d, 0x1e, 0x05, 0x08, 0x1a, 0x15,
+    0x06, 0x10, 0x17, 0x3a, 0x0d, 0x03, 0x10, 0x40, 0x06, 0x08, 0x03, 0x06, 0x00, 0x03, 0x3e, 0x03,
+    0x0b, 0x10, 0x02, 0x00, 0x10, 0x02, 0x10, 0x00, 0x42, 0x00, 0x62, 0xc5, 0x02, 0x20, 0x05, 0x41,
+    0x11, 0x08, 0x11, 0x0b, 0x1e, 0x08, 0x05, 0x02, 0x4b, 0x05, 0x4b, 0x45, 0x21, 0x45, 0x0b, 0x01,
+    0x06, 0x04, 0x1e, 0x11, 0x06, 0x10, 0x00, 0x08, 0x1e, 0x3d, 0x1b, 0x1d, 0x2d, 0x1d, 0x1a, 0x04,
+    0x06, 0x5a, 0x0a, 0x17, 0x26, 0x04, 0x1c, 0x04, 0x5c, 0x04, 0x1c, 0x0d, 0x06, 0x1e, 0x1a, 0x1b,
+    0x1a, 0x5d, 0x1b, 0x1a, 0x1d, 0x04, 0x1d, 0x1a, 0x1b, 0x1a, 0x1e, 0x1d, 0x2f, 0x32, 0x99, 0x38,
+    0x3b, 0x1a, 0x1d, 0x0f, 0x32, 0x2f, 0x1b, 0x1a, 0x1e, 0x1a, 0x1b, 0x1a, 0x04, 0x11, 0x04, 0x1a,
+    0x04, 0x03, 0x06, 0x1c, 0x1d, 0x3c, 0x06, 0x00, 0x11, 0x02, 0x06, 0x03, 0x06, 0x10, 0x0f, 0x12,
+    0x0f, 0x12, 0x0f, 0x00, 0x0b, 0x06, 0x1e, 0x0e, 0x1e, 0x03, 0x1e, 0xc8, 0x63, 0x80, 0x2b, 0x22,
+    0x05, 0x41, 0x02, 0x2b, 0x10, 0x18, 0x0c, 0x25, 0x71, 0x10, 0x11, 0x22, 0x00, 0x42, 0x00, 0x02,
+    0x00, 0x10, 0x08, 0x0d, 0x08, 0x32, 0x0f, 0xd2, 0x2f, 0x52, 0x17, 0x1a, 0x15, 0x04, 0x1e, 0x06,
+    0x32, 0x4f, 0x1c, 0x0f, 0x12, 0x06, 0x52, 0x0f, 0x12, 0x4f, 0x12, 0x0f, 0x12, 0x04, 0x3b, 0x1a,
+    0x24, 0x1b, 0x1d, 0x32, 0x87, 0x79, 0x18, 0x0c, 0x1b, 0x1a, 0x36, 0x87, 0x0f, 0x1d, 0x1c, 0x1a,
+    0x1b, 0x15, 0x0d, 0x0a, 0x1d, 0x1e, 0x12, 0x6f, 0x12, 0x11, 0x0f, 0x12, 0x03, 0x04, 0x03, 0x06,
+    0x32, 0x87, 0x12, 0x1e, 0x2e, 0x06, 0x20, 0x11, 0xe0, 0x20, 0x62, 0x20, 0x42, 0xe5, 0x06, 0x18,
+    0x0c, 0x10, 0x05, 0x88, 0x51, 0x08, 0x63, 0x48, 0x1e, 0x10, 0x05, 0xe7, 0xc7, 0x15, 0x0a, 0x1e,
+    0x10, 0x32, 0x87, 0x12, 0x27, 0x03, 0xe7, 0x47, 0x12, 0x1c, 0x3b, 0x1a, 0x1c, 0x0d, 0x16, 0x27,
+    0x32, 0x16, 0x18, 0x27, 0x18, 0x0c, 0x5b, 0x1a, 0x12, 0x27, 0x72, 0x27, 0x12, 0x0b, 0x3e, 0x0a,
+    0x1a, 0x15, 0x32, 0xa7, 0x12, 0x27, 0x03, 0x17, 0x00, 0x12, 0x27, 0x72, 0x27, 0x12, 0x00, 0x10,
+    0x25, 0x01, 0x05, 0xe1, 0xe1, 0x20, 0xa2, 0x05, 0x02, 0x05, 0x0b, 0x0c, 0x1b, 0x1e, 0x22, 0x70,
+    0x02, 0x20, 0xd0, 0x06, 0x20, 0x11, 0x52, 0x27, 0x0f, 0xb2, 0x27, 0x12, 0x1a, 0x04, 0x1c, 0x12,
+    0x27, 0x72, 0x67, 0x04, 0x52, 0x27, 0x92, 0x27, 0x12, 0x0a, 0x1a, 0x3b, 0x1a, 0x27, 0x0f, 0x1b,
+    0x04, 0x1d, 0x1b, 0x18, 0x27, 0x17, 0x1b, 0x0c, 0x1b, 0x12, 0x27, 0x0f, 0x04, 0x5d, 0x0f, 0x27,
+    0x55, 0x1a, 0x1d, 0x12, 0x27, 0x32, 0x0f, 0x32, 0x67, 0x03, 0x28, 0x27, 0x12, 0x1c, 0x03, 0x26,
+    0x0f, 0x27, 0x01, 0x08, 0x03, 0x00, 0x02, 0x00, 0x30, 0x66, 0xe0, 0x25, 0x01, 0x05, 0x22, 0x50,
+    0x02, 0x0b, 0x11, 0x00, 0x21, 0x02, 0x03, 0x08, 0x2b, 0x21, 0x45, 0x6b, 0x65, 0x0b, 0x05, 0x0d,
+    0x08, 0x10, 0x01, 0x12, 0x07, 0x12, 0x1d, 0x03, 0x06, 0x04, 0x1c, 0x04, 0x1c, 0x27, 0x1d, 0x1a,
+    0x1c, 0x12, 0x07, 0x32, 0x2d, 0x1c, 0x04, 0x12, 0x27, 0x12, 0x1c, 0x2d, 0x12, 0x07, 0x12, 0x08,
+    0x03, 0x06, 0x1e, 0x10, 0x12, 0x27, 0x1b, 0x1e, 0x04, 0x1b, 0x0c, 0x0f, 0x12, 0x1d, 0x3b, 0x04,
+    0x1e, 0x1b, 0x27, 0x04, 0x1b, 0x0c, 0x1b, 0x27, 0x0f, 0x1d, 0x7a, 0x1d, 0x27, 0x5a, 0x1d, 0x12,
+    0x27, 0x0f, 0x1d, 0x04, 0x4d, 0x12, 0x27, 0x12, 0x08, 0x1e, 0x08, 0x12, 0x0f, 0x1d, 0x08, 0x0b,
+    0x3e, 0x04, 0x27, 0x3e, 0x04, 0x3e, 0x0e, 0xbe, 0x28, 0xe3, 0x05, 0x41, 0x45, 0x02, 0x2b, 0x00,
+    0x02, 0x05, 0x01, 0x05, 0x03, 0x08, 0x11, 0x25, 0x02, 0x25, 0x11, 0x00, 0x22, 0x0b, 0x02, 0x00,
+    0x10, 0x06, 0x04, 0x00, 0x0b, 0x01, 0x10, 0x27, 0x1e, 0x10, 0x02, 0x32, 0x1a, 0x1c, 0x10, 0x27,
+    0x1d, 0x15, 0x04, 0x27, 0x1d, 0x06, 0x04, 0x28, 0x1e, 0x0d, 0x27, 0x0d, 0x06, 0x00, 0x0d, 0x27,
+    0x1e, 0x06, 0x08, 0x0d, 0x26, 0x1d, 0x27, 0x1b, 0x15, 0x17, 0x0a, 0x1a, 0x1b, 0x1d, 0x06, 0x04,
+    0x3b, 0x1d, 0x12, 0x27, 0x1b, 0x3a, 0x1b, 0x32, 0x1d, 0x0a, 0x04, 0x1d, 0x24, 0x1d, 0x27, 0x04,
+    0x1c, 0x0d, 0x12, 0x27, 0x12, 0x3a, 0x1c, 0x04, 0x5e, 0x27, 0x03, 0x10, 0x05, 0x04, 0x15, 0x04,
+    0x08, 0x11, 0x1e, 0x0a, 0x1c, 0x12, 0x27, 0x1e, 0x2d, 0x03, 0x08, 0xd0, 0xe2, 0x22, 0x20, 0x05,
+    0x01, 0x45, 0x0b, 0x10, 0x0b, 0x05, 0x02, 0x00, 0x45, 0x03, 0x08, 0x03, 0x4b, 0x02, 0x00, 0x85,
+    0x0b, 0x10, 0x08, 0x10, 0x17, 0x0c, 0x39, 0x27, 0x10, 0x0b, 0x05, 0x27, 0x1a, 0x0a, 0x08, 0x27,
+    0x3a, 0x05, 0x27, 0x17, 0x1e, 0x04, 0x08, 0x0d, 0x1e, 0x04, 0x2f, 0x1c, 0x11, 0x06, 0x0d, 0x27,
+    0x17, 0x06, 0x1c, 0x10, 0x0d, 0x1d, 0x16, 0x07, 0x12, 0x1d, 0x17, 0x06, 0x10, 0x1d, 0x1b, 0x0c,
+    0x1d, 0x24, 0x1b, 0x16, 0x27, 0x0f, 0x3b, 0x15, 0x0a, 0x1a, 0x1d, 0x1a, 0x1d, 0x1a, 0x5d, 0x12,
+    0x07, 0x12, 0x1e, 0x17, 0x1e, 0x27, 0x12, 0x1d, 0x15, 0x1e, 0x06, 0x0d, 0x04, 0x1e, 0x17, 0x12,
+    0x0f, 0x17, 0x06, 0x0a, 0x1a, 0x04, 0x17, 0x03, 0x1c, 0x1e, 0x1c, 0x12, 0x27, 0x12, 0x1e, 0x10,
+    0x0b, 0x00, 0x05, 0x00, 0xe5, 0xe5, 0x02, 0x31, 0x02, 0x05, 0x02, 0x0b, 0x05, 0x08, 0x10, 0x25,
+    0x02, 0x03, 0x02, 0x25, 0x03, 0x28, 0x10, 0x02, 0x0b, 0x65, 0x02, 0x30, 0x28, 0x05, 0x0a, 0x18,
+    0x39, 0x27, 0x52, 0x27, 0x0a, 0x06, 0x00, 0x12, 0x0f, 0x18, 0x19, 0x17, 0x27, 0x32, 0x4d, 0x1e,
+    0x1c, 0x3e, 0x1c, 0x06, 0x0d, 0x06, 0x27, 0x46, 0x1c, 0x1d, 0x16, 0x27, 0x0d, 0x10, 0x26, 0x03,
+    0x17, 0x0d, 0x1b, 0x16, 0x52, 0x27, 0x16, 0x0d, 0x04, 0x0c, 0x3b, 0x1a, 0x5b, 0x1a, 0x1d, 0x16,
+    0x0f, 0x07, 0x0f, 0x1a, 0x06, 0x04, 0x1d, 0x27, 0x3d, 0x3c, 0x0a, 0x15, 0x9c, 0x1e, 0x15, 0x1a,
+    0x0a, 0x0b, 0x11, 0x12, 0x16, 0x32, 0x27, 0x0f, 0x1e, 0x10, 0x20, 0x2b, 0x03, 0xe5, 0xe5, 0x05,
+    0x00, 0x23, 0x02, 0x45, 0x10, 0x31, 0x0b, 0x05, 0x02, 0x00, 0x02, 0x05, 0x0b, 0x10, 0x28, 0x10,
+    0x25, 0x02, 0x0b, 0x25, 0x4b, 0x05, 0x1c, 0x0c, 0x39, 0x18, 0xc7, 0x1c, 0x10, 0x00, 0x01, 0x1b,
+    0x39, 0x1d, 0x0f, 0x47, 0x72, 0x24, 0x1e, 0x04, 0x06, 0x0d, 0x08, 0x27, 0x72, 0x16, 0x27, 0x0f,
+    0x1c, 0x06, 0x1e, 0x48, 0x17, 0x10, 0xa7, 0x3b, 0x0a, 0x06, 0x0a, 0x7a, 0x0a, 0x1d, 0x16, 0x27,
+    0x12, 0x1b, 0x1a, 0x17, 0x15, 0x16, 0x07, 0x0f, 0x1d, 0x7a, 0x0a, 0x15, 0x1d, 0x3a, 0x1c, 0x3a,
+    0x1e, 0x17, 0x0e, 0x15, 0xa7, 0x08, 0x02, 0x11, 0x08, 0x11, 0x10, 0x31, 0x60, 0x02, 0x00, 0x62,
+    0xc5, 0x02, 0x20, 0x25, 0x01, 0x05, 0x0b, 0x02, 0x11, 0x10, 0x02, 0x2b, 0x11, 0x03, 0x10, 0x0b,
+    0x11, 0x28, 0x11, 0x02, 0x0b, 0x02, 0x11, 0x08, 0x1e, 0x1a, 0x0c, 0x18, 0x39, 0x0c, 0x1b, 0x12,
+    0x07, 0x4f, 0x27, 0x0f, 0x0a, 0x00, 0x30, 0x1d, 0x1b, 0x1d, 0x1a, 0x1d, 0x0f, 0x12, 0x0f, 0x67,
+    0x12, 0x04, 0x1e, 0x4d, 0x12, 0xc7, 0x2f, 0x10, 0x17, 0x0d, 0x06, 0x2d, 0x06, 0x0d, 0x06, 0x0f,
+    0x12, 0x2f, 0x27, 0x16, 0x3b, 0x04, 0x0b, 0x05, 0x10, 0x17, 0x11, 0x06, 0x12, 0x27, 0x0f, 0x1d,
+    0x0d, 0x17, 0x24, 0x27, 0x1d, 0x04, 0x5c, 0x24, 0x3c, 0x7e, 0x0d, 0x00, 0x08, 0x1a, 0x15, 0x12,
+    0x4f, 0x27, 0x12, 0x23, 0x06, 0x10, 0x11, 0x10, 0x60, 0xc2, 0xa5, 0x00, 0xc5, 0x02, 0x2b, 0x10,
+    0x11, 0x02, 0x2b, 0x28, 0x11, 0x05, 0x02, 0x03, 0x08, 0x23, 0x08, 0x0e, 0x0a, 0x1a, 0x0c, 0x59,
+    0x0c, 0x05, 0x01, 0x07, 0x0f, 0x02, 0x03, 0x10, 0x27, 0x1a, 0x0e, 0x00, 0x32, 0x10, 0x0d, 0x1b,
+    0x3d, 0x4d, 0x4f, 0x27, 0x16, 0x04, 0x1c, 0x06, 0x0d, 0x27, 0x0f, 0x12, 0x6f, 0x1c, 0x11, 0x1e,
+    0x1c, 0x0d, 0x08, 0x2d, 0x04, 0x1a, 0x4d, 0x1d, 0x1b, 0x0f, 0x27, 0x1a, 0x1b, 0x0c, 0x1b, 0x1e,
+    0x05, 0x0d, 0x32, 0x07, 0x2f, 0x1b, 0x38, 0x1a, 0x04, 0x06, 0x27, 0x04, 0x11, 0x2d, 0x04, 0x17,
+    0x05, 0x0b, 0x11, 0x0b, 0x05, 0x11, 0x10, 0x0b, 0x35, 0x04, 0x00, 0x11, 0x1c, 0x1d, 0x1c, 0x0f,
+    0x27, 0x08, 0x0b, 0x00, 0x11, 0x06, 0x80, 0x10, 0xc2, 0x2b, 0x05, 0x2b, 0xc5, 0x01, 0x03, 0x02,
+    0x0b, 0x02, 0x10, 0x11, 0x02, 0x0b, 0x10, 0x08, 0x11, 0x05, 0x01, 0x05, 0x11, 0x08, 0x43, 0x1e,
+    0x1a, 0x0c, 0x18, 0x19, 0x0c, 0x17, 0x10, 0x08, 0x27, 0x00, 0x0b, 0x11, 0x27, 0x1e, 0x0d, 0x08,
+    0x27, 0x08, 0x1a, 0x1d, 0x16, 0x12, 0x10, 0x17, 0x0d, 0x04, 0x2d, 0x0f, 0x27, 0x04, 0x1e, 0x1c,
+    0x04, 0x27, 0x1e, 0x0d, 0x06, 0x17, 0x1a, 0x1b, 0x1c, 0x15, 0x3b, 0x1d, 0x06, 0x0d, 0x1d, 0x3b,
+    0x1a, 0x0d, 0x08, 0x2d, 0x1b, 0x27, 0x0d, 0x1c, 0x0c, 0x39, 0x0c, 0x16, 0x27, 0x18, 0x1b, 0x79,
+    0x18, 0x04, 0x1a, 0x27, 0x1b, 0x0d, 0x04, 0x1b, 0x1a, 0x15, 0x04, 0x0a, 0x04, 0x1d, 0x1c, 0x04,
+    0x0a, 0x15, 0x1a, 0x0a, 0x02, 0x00, 0x2a, 0x1f, 0x17, 0x06, 0x27, 0x11, 0x06, 0x17, 0x40, 0x11,
+    0x00, 0x31, 0x30, 0xe2, 0x42, 0x05, 0x20, 0x85, 0x0b, 0x28, 0x2b, 0x10, 0x08, 0x30, 0x02, 0x4b,
+    0x05, 0x02, 0x06, 0x00, 0x25, 0x0b, 0x10, 0x57, 0x2d, 0x11, 0x10, 0x27, 0x10, 0x08, 0x15, 0x2f,
+    0x06, 0x05, 0x11, 0x27, 0x3a, 0x16, 0x27, 0x17, 0x06, 0x0d, 0x04, 0x1c, 0x0d, 0x1c, 0x27, 0x04,
+    0x1e, 0x15, 0x04, 0x27, 0x17, 0x06, 0x1e, 0x0d, 0x3b, 0x0d, 0x3b, 0x18, 0x1b, 0x1c, 0x17, 0x1a,
+    0x2c, 0x18, 0x17, 0x2d, 0x1e, 0x0d, 0x27, 0x3c, 0x17, 0x18, 0x39, 0x07, 0x2f, 0xb9, 0x18, 0x1c,
+    0x1b, 0x27, 0x16, 0x1c, 0x1a, 0x0c, 0x3b, 0x3a, 0x1d, 0x36, 0x3a, 0x1d, 0x1c, 0x0b, 0x08, 0x0a,
+    0x15, 0x1c, 0x0b, 0x00, 0x0d, 0x27, 0x03, 0x10, 0x03, 0x00, 0x11, 0x30, 0x00, 0x90, 0x40, 0xc2,
+    0xe5, 0x05, 0x0b, 0x11, 0x03, 0x02, 0x05, 0x0b, 0x03, 0x08, 0x02, 0x05, 0x0b, 0x22, 0x10, 0x08,
+    0x8d, 0x24, 0x1d, 0x0a, 0x24, 0x1c, 0x27, 0x04, 0x1c, 0x04, 0x11, 0x10, 0x06, 0x0b, 0x06, 0x27,
+    0x1a, 0x03, 0x47, 0x16, 0x03, 0x1c, 0x1d, 0x0d, 0x16, 0x12, 0x07, 0x0f, 0x06, 0x10, 0x0d, 0x04,
+    0x27, 0x2d, 0x08, 0x0d, 0x1a, 0x1b, 0x04, 0x0a, 0x1b, 0x2c, 0x1a, 0x12, 0x16, 0x5b, 0x1d, 0x1c,
+    0x03, 0x32, 0x07, 0x0f, 0x1d, 0x15, 0x1c, 0x12, 0x27, 0x12, 0x3c, 0x10, 0x17, 0x04, 0x1d, 0x39,
+    0x1b, 0x0d, 0x1a, 0x0f, 0x27, 0x12, 0x0d, 0x1d, 0x1b, 0x0d, 0x06, 0x03, 0x12, 0x27, 0x06, 0x08,
+    0x32, 0x1e, 0x3d, 0x06, 0x17, 0x0d, 0x32, 0x07, 0x12, 0x11, 0x10, 0x20, 0x0b, 0x60, 0x22, 0x60,
+    0xc2, 0x00, 0xe5, 0x00, 0x25, 0x23, 0x25, 0x02, 0x23, 0x02, 0x25, 0x0b, 0x10, 0x08, 0x2d, 0x08,
+    0x0d, 0x1e, 0x0a, 0x35, 0x1a, 0x56, 0x27, 0x36, 0xb2, 0x07, 0x0f, 0x1c, 0x06, 0x67, 0x76, 0x27,
+    0x0f, 0x1c, 0x06, 0x32, 0x16, 0x27, 0x72, 0x3b, 0x1c, 0x17, 0x2d, 0x1b, 0x0c, 0x27, 0x12, 0x36,
+    0x18, 0x16, 0x12, 0x27, 0x0f, 0x1d, 0x06, 0x1d, 0x16, 0x47, 0x16, 0x32, 0x76, 0x27, 0x0d, 0x1e,
+    0x0d, 0x04, 0x0f, 0x27, 0xb2, 0x27, 0x0f, 0x0b, 0x00, 0x27, 0x56, 0x32, 0x16, 0x27, 0x0f, 0x00,
+    0x0b, 0x10, 0x03, 0x31, 0x23, 0x62, 0x40, 0xe5, 0x65, 0x00, 0x65, 0x03, 0x00, 0x25, 0x02, 0x03,
+    0x00, 0x05, 0x0b, 0x23, 0x02, 0x25, 0x02, 0x10, 0x02, 0x0b, 0x05, 0x41, 0x25, 0x01, 0xe7, 0xa7,
+    0x2d, 0x0a, 0x27, 0x0f, 0xa7, 0x0f, 0x1c, 0x1e, 0x04, 0xe7, 0x07, 0x3b, 0x04, 0x0d, 0x1c, 0x37,
+    0x1b, 0x0f, 0xc7, 0x2f, 0x3b, 0x1c, 0x04, 0xe7, 0x87, 0x0d, 0x06, 0x08, 0x1a, 0x1d, 0x0f, 0xc7,
+    0x2f, 0x1c, 0x0a, 0x1c, 0x0f, 0xc7, 0x2f, 0x08, 0x02, 0x0b, 0x03, 0x28, 0x06, 0x00, 0x05, 0x2b,
+    0x02, 0x00, 0x03, 0x00, 0x05, 0x21, 0xe5, 0xe5, 0x02, 0x11, 0x02, 0x0b, 0x02, 0x23, 0x42, 0x23,
+    0x02, 0x0b, 0x08, 0x10, 0x0b, 0x30, 0x11, 0x48, 0x02, 0xef, 0x12, 0x8f, 0x03, 0x1c, 0x03, 0x2f,
+    0x1c, 0xaf, 0x0d, 0x1e, 0x1d, 0x04, 0xef, 0x0f, 0x3b, 0x1c, 0x8d, 0x1b, 0xcf, 0x0d, 0x1b, 0x2c,
+    0x1d, 0x1c, 0xef, 0x8f, 0x1c, 0x06, 0x0a, 0x1b, 0x0c, 0x1b, 0xcf, 0x3d, 0x15, 0x3a, 0x1d, 0x0f,
+    0x07, 0x8f, 0x08, 0x00, 0x17, 0x10, 0x00, 0x03, 0x11, 0x06, 0x03, 0x62, 0x00, 0x11, 0x03, 0x00,
+    0x25, 0x21, 0xe5, 0xe5, 0x02, 0x03, 0x11, 0x05, 0x0b, 0x23, 0x02, 0x05, 0x02, 0x28, 0x30, 0xbe,
+    0x2d, 0x04, 0x0a, 0x04, 0x1d, 0x1e, 0x11, 0x06, 0x10, 0x0b, 0x1c, 0x3d, 0x0d, 0x10, 0x2d, 0x1e,
+    0x0d, 0x1e, 0x0d, 0x06, 0x3e, 0x0d, 0x04, 0x06, 0x1c, 0x0a, 0x2d, 0x24, 0x1c, 0x04, 0x1c, 0x44,
+    0x2d, 0x1a, 0x1b, 0x15, 0x06, 0x1c, 0x04, 0x17, 0x04, 0x0c, 0x1a, 0x17, 0x04, 0x0d, 0x1c, 0x3b,
+    0x0d, 0x2c, 0x18, 0x1a, 0x1c, 0x04, 0x06, 0x0d, 0x1c, 0x1d, 0x04, 0x1c, 0x08, 0x1c, 0x1d, 0x9b,
+    0x04, 0x1a, 0x1b, 0x1a, 0x15, 0x04, 0x1d, 0x1a, 0x04, 0x1c, 0x04, 0x15, 0x6a, 0x03, 0x4d, 0x08,
+    0x06, 0x00, 0x1e, 0x0d, 0x11, 0x00, 0x02, 0x20, 0x0b, 0x02, 0x03, 0x08, 0x03, 0x00, 0x42, 0x20,
+    0x25, 0x21, 0xe5, 0xa5, 0x02, 0x0b, 0x05, 0x02, 0x11, 0x02, 0x2b, 0x28, 0x02, 0x0b, 0x02, 0x11,
+    0x70, 0xa6, 0x2d, 0x04, 0x0a, 0x08, 0x17, 0x10, 0x06, 0x0d, 0x1a, 0x04, 0x08, 0x06, 0x30, 0x06,
+    0x10, 0x06, 0x17, 0x00, 0x08, 0x10, 0x0d, 0x06, 0x3e, 0x24, 0x0d, 0x08, 0x00, 0x0d, 0x1c, 0x24,
+    0x4a, 0x08, 0x06, 0x3b, 0x1c, 0x2d, 0x06, 0x0d, 0x1c, 0x2c, 0x17, 0x1c, 0x3e, 0x1b, 0x0c, 0x1c,
+    0x1d, 0x1b, 0x15, 0x1d, 0x0a, 0x0d, 0x04, 0x06, 0x1e, 0x0d, 0x04, 0x2d, 0x1d, 0x1b, 0x19, 0x2c,
+    0x19, 0x0c, 0x1c, 0x0d, 0x1e, 0x03, 0x17, 0x0d, 0x06, 0x77, 0x00, 0x37, 0x10, 0x26, 0x0d, 0x3e,
+    0x00, 0x17, 0x2d, 0x26, 0x10, 0x11, 0x05, 0x30, 0x00, 0x03, 0x06, 0x00, 0x22, 0x4b, 0x22, 0x65,
+    0x06, 0x03, 0x10, 0x2b, 0xe5, 0x23, 0x02, 0x05, 0x02, 0x23, 0x05, 0x0b, 0x28, 0x03, 0x02, 0x2b,
+    0x10, 0x06, 0xd0, 0x0b, 0x10, 0x06, 0x0b, 0x06, 0x00, 0x02, 0x04, 0x15, 0x04, 0x10, 0x00, 0x06,
+    0x11, 0x10, 0x08, 0x06, 0x10, 0x03, 0x0e, 0x17, 0x03, 0x02, 0x0d, 0x1e, 0x1c, 0x1e, 0x1c, 0x04,
+    0x0d, 0x3c, 0x15, 0x04, 0x3c, 0x2d, 0x06, 0x0d, 0x3b, 0x04, 0x6d, 0x04, 0x0c, 0x1b, 0x10, 0x1c,
+    0x0d, 0x1c, 0x1b, 0x0c, 0x2d, 0x1c, 0x15, 0x1a, 0x1e, 0x0d, 0x03, 0x1c, 0x24, 0x1d, 0x04, 0x1d,
+    0x04, 0x1b, 0x18, 0x3d, 0x0c, 0x1b, 0x04, 0x17, 0x06, 0x10, 0x17, 0x06, 0x1e, 0x0a, 0x1e, 0x08,
+    0x03, 0x0d, 0x03, 0x06, 0x0d, 0x03, 0x0d, 0x1e, 0x03, 0x11, 0x23, 0x10, 0x1e, 0x0d, 0x11, 0x05,
+    0x00, 0x02, 0x17, 0x06, 0x05, 0x11, 0x06, 0x00, 0xe2, 0x25, 0x02, 0x08, 0x3e, 0x28, 0xc3, 0x00,
+    0x02, 0x31, 0x02, 0x0b, 0x02, 0x11, 0x08, 0x25, 0x02, 0x08, 0x03, 0x0b, 0x10, 0x1e, 0x1c, 0x2d,
+    0x7c, 0x4d, 0x24, 0x1c, 0x04, 0x3a, 0x04, 0x06, 0x10, 0x06, 0x11, 0x86, 0x08, 0x50, 0x28, 0x1e,
+    0x06, 0x1c, 0x64, 0x35, 0x24, 0x6d, 0x04, 0x3b, 0x04, 0x6d, 0x1c, 0x1b, 0x0c, 0x17, 0x1c, 0x0d,
+    0x1c, 0x1b, 0x0c, 0x0d, 0x1c, 0x1a, 0x1d, 0x2d, 0x1c, 0x0d, 0x04, 0x1d, 0x1b, 0x2c, 0x1b, 0x1d,
+    0x0c, 0x19, 0x3b, 0x18, 0x0c, 0x04, 0x66, 0x1c, 0xe4, 0x04, 0x3e, 0x03, 0x00, 0x26, 0x10, 0x06,
+    0x1e, 0x08, 0x30, 0x80, 0x42, 0x0b, 0x22, 0x2b, 0x42, 0x00, 0x01, 0x05, 0x08, 0x1e, 0x08, 0x10,
+    0xe0, 0x00, 0x05, 0x0b, 0x11, 0x08, 0x03, 0x2b, 0x03, 0x08, 0x02, 0x05, 0x02, 0x23, 0x06, 0x08,
+    0xfe, 0x9e, 0x0a, 0x04, 0x1e, 0x50, 0x51, 0x30, 0x06, 0x11, 0x22, 0x03, 0x30, 0x11, 0x08, 0x3e,
+    0x04, 0x1c, 0x06, 0x2d, 0x84, 0x1a, 0x3b, 0x0c, 0x1b, 0x04, 0x6d, 0x04, 0x2c, 0x17, 0x1c, 0x0d,
+    0x1c, 0x1b, 0x0c, 0x24, 0x1a, 0x3c, 0x1a, 0x1b, 0x1a, 0x1d, 0x1b, 0x79, 0x1b, 0x39, 0x58, 0x0c,
+    0x04, 0x06, 0x08, 0x26, 0x8d, 0xe6, 0x00, 0x26, 0x10, 0x06, 0x08, 0x10, 0x22, 0x20, 0x02, 0x20,
+    0xa2, 0x2b, 0x22, 0x0b, 0x05, 0x00, 0x05, 0x02, 0x10, 0x22, 0xe1, 0x05, 0x02, 0x0b, 0x02, 0x03,
+    0x08, 0x02, 0x2b, 0x11, 0x23, 0x2b, 0x28, 0x03, 0xe5, 0x02, 0x10, 0x08, 0x06, 0x02, 0x05, 0x0b,
+    0x10, 0x3e, 0x08, 0x30, 0xc6, 0x2d, 0x26, 0x17, 0x0d, 0x1e, 0x24, 0x3c, 0x06, 0x1d, 0x7b, 0x2c,
+    0x1b, 0x2d, 0x06, 0x0d, 0x3c, 0x0d, 0x04, 0x2c, 0x17, 0x3c, 0x04, 0x1b, 0x0c, 0x2d, 0x1a, 0x1c,
+    0x1d, 0x0c, 0x18, 0x0c, 0x3b, 0x79, 0x3b, 0x3d, 0x1a, 0x15, 0x0d, 0xe6, 0xe6, 0x26, 0x03, 0xb0,
+    0x02, 0x10, 0x00, 0xe2, 0x22, 0x2b, 0x22, 0x2b, 0x02, 0x0b, 0x42, 0x05, 0x01, 0xe5, 0x11, 0x00,
+    0x02, 0x0b, 0x02, 0x10, 0x2b, 0x05, 0x11, 0x08, 0x03, 0x0b, 0x02, 0x11, 0x03, 0x48, 0x3e, 0x48,
+    0x1e, 0x0a, 0x35, 0x1e, 0x10, 0x06, 0x15, 0x1d, 0x1a, 0x1d, 0x24, 0x15, 0x04, 0x3d, 0x04, 0x3a,
+    0x3d, 0x3a, 0x04, 0x10, 0x0d, 0x04, 0x1c, 0x15, 0x04, 0x1c, 0x1b, 0x4c, 0x1b, 0x0d, 0x37, 0x4d,
+    0x1c, 0x0d, 0x1c, 0x0d, 0x1c, 0x2c, 0x17, 0x3c, 0x04, 0x3b, 0x0d, 0x1c, 0x1a, 0x24, 0x1b, 0x18,
+    0x5b, 0x79, 0x0c, 0x1d, 0x0d, 0x17, 0x10, 0x46, 0x4d, 0xa6, 0x08, 0xe6, 0x06, 0xb0, 0x06, 0x20,
+    0xe2, 0xa2, 0x0b, 0x05, 0x02, 0x08, 0x1e, 0x08, 0x06, 0x00, 0x22, 0x20, 0x22, 0x25, 0x02, 0x20,
+    0x02, 0x25, 0x0b, 0x02, 0x0b, 0x05, 0x02, 0x28, 0x2b, 0x11, 0xe8, 0x1e, 0x04, 0x35, 0x1e, 0x10,
+    0x0d, 0x15, 0x5a, 0x15, 0xfa, 0x3d, 0x1a, 0x3b, 0x04, 0x26, 0x0d, 0x0a, 0x24, 0x1a, 0x3b, 0x1c,
+    0x17, 0x6d, 0x1c, 0x04, 0x1c, 0x0d, 0x1c, 0x0d, 0x04, 0x2c, 0x17, 0x0d, 0x1c, 0x04, 0x3b, 0x3c,
+    0x1a, 0x1c, 0x17, 0x1a, 0x3b, 0x1c, 0x1b, 0x0c, 0x39, 0x18, 0x1b, 0x1d, 0x1c, 0x2d, 0x1e, 0x0d,
+    0x46, 0x2d, 0xe6, 0xa6, 0x08, 0x70, 0x00, 0x22, 0x20, 0xe2, 0x42, 0x4b, 0x05, 0x01, 0x00, 0x1e,
+    0x0a, 0x1e, 0x08, 0x03, 0x48, 0x83, 0x01, 0x05, 0x02, 0x11, 0x00, 0x25, 0x0b, 0x02, 0x0b, 0x05,
+    0x02, 0x23, 0x02, 0x0b, 0xe5, 0x0b, 0x10, 0x06, 0x10, 0x02, 0x0b, 0x10, 0x08, 0x1c, 0x1e, 0x0d,
+    0x66, 0x0d, 0x46, 0x0d, 0x1a, 0x04, 0x0d, 0x1c, 0x1a, 0x0c, 0x15, 0x2d, 0x1c, 0x44, 0x1c, 0x04,
+    0x3d, 0x04, 0x1c, 0x04, 0x35, 0x3a, 0x04, 0x2d, 0x04, 0x2c, 0x17, 0x2d, 0x04, 0x3b, 0x3c, 0x1d,
+    0x1c, 0x10, 0x1d, 0x0c, 0x1b, 0x17, 0x04, 0x1d, 0x18, 0x19, 0x5c, 0xed, 0x0d, 0xe6, 0xc6, 0x70,
+    0x22, 0x00, 0x02, 0x10, 0x00, 0xe2, 0x42, 0x4b, 0x45, 0x03, 0x08, 0x30, 0x0b, 0x42, 0x8b, 0x05,
+    0x21, 0x02, 0x03, 0x00, 0x0b, 0x25, 0x22, 0x25, 0x23, 0x22, 0xc5, 0x0b, 0x02, 0x10, 0x02, 0x05,
+    0x02, 0x70, 0x06, 0x10, 0x06, 0x7e, 0x04, 0x0a, 0x1a, 0x1b, 0x1a, 0x1c, 0x06, 0x10, 0x1a, 0x1b,
+    0x1a, 0x1c, 0x17, 0x0d, 0x24, 0x4d, 0x7c, 0x44, 0x15, 0x04, 0x2d, 0x04, 0x2c, 0x17, 0x1c, 0x0d,
+    0x04, 0x3b, 0x1c, 0x1d, 0x1a, 0x04, 0x0d, 0x1d, 0x3b, 0x06, 0x0d, 0x17, 0x0c, 0x19, 0x17, 0x0d,
+    0x06, 0x0d, 0x1e, 0x0d, 0x26, 0x0d, 0xe6, 0x86, 0xd0, 0x28, 0x22, 0x03, 0x08, 0x30, 0xe2, 0x00,
+    0x30, 0x62, 0x00, 0x25, 0x0b, 0x25, 0x01, 0xe5, 0x01, 0x25, 0x01, 0x05, 0x00, 0x02, 0xa5, 0x02,
+    0x03, 0x08, 0x22, 0x0b, 0x02, 0x30, 0x02, 0x0b, 0x10, 0x06, 0x3e, 0x08, 0x10, 0x26, 0x0d, 0x46,
+    0x1e, 0x1a, 0x1b, 0x5a, 0x7b, 0x1a, 0x2d, 0x10, 0x1a, 0x0c, 0x1a, 0x1c, 0x06, 0x08, 0x04, 0x0a,
+    0x0d, 0x46, 0x4d, 0x3c, 0x24, 0x5c, 0x2c, 0x17, 0x1c, 0x0d, 0x04, 0x1b, 0x0c, 0x0d, 0x3a, 0x04,
+    0x0d, 0x1d, 0x3b, 0x17, 0x04, 0x17, 0x1b, 0x18, 0x17, 0x0d, 0x04, 0x0d, 0x5c, 0x2d, 0x06, 0x08,
+    0x0d, 0xe6, 0x86, 0x30, 0x06, 0x08, 0x3e, 0x22, 0x08, 0x1e, 0x30, 0xe2, 0x00, 0x43, 0x31, 0x10,
+    0x03, 0x20, 0x02, 0x25, 0x21, 0x45, 0x01, 0x25, 0xa1, 0x05, 0x00, 0x03, 0x00, 0x0b, 0x30, 0x02,
+    0x25, 0x0b, 0x68, 0x5e, 0x08, 0x0d, 0x04, 0x0a, 0x15, 0x0a, 0x64, 0x15, 0x24, 0x1a, 0x15, 0x06,
+    0x77, 0x1c, 0x1a, 0x3b, 0x1a, 0x2d, 0x10, 0x04, 0x0c, 0x1b, 0x2d, 0x06, 0x24, 0x1e, 0xad, 0x06,
+    0x2d, 0x5c, 0x2c, 0x17, 0x0d, 0x1c, 0x04, 0x1b, 0x0c, 0x0d, 0x04, 0x1a, 0x0a, 0x0d, 0x1a, 0x3b,
+    0x37, 0x04, 0x0c, 0x19, 0x04, 0x17, 0x24, 0x1a, 0x15, 0x04, 0x0d, 0x06, 0x0d, 0x06, 0x2d, 0xe6,
+    0x66, 0x30, 0x08, 0x0a, 0x35, 0x06, 0x0b, 0x10, 0x0e, 0x90, 0xe2, 0x22, 0x25, 0x62, 0x20, 0xe5,
+    0xe5, 0x00, 0x03, 0x00, 0x2b, 0x02, 0x25, 0x0b, 0x02, 0x10, 0x03, 0xa8, 0xde, 0x0a, 0x1e, 0x04,
+    0x15, 0x1e, 0x02, 0x10, 0x04, 0x3a, 0x04, 0x06, 0x30, 0x1a, 0x3b, 0x0d, 0x0b, 0x06, 0x1d, 0x1b,
+    0x1a, 0x17, 0x4d, 0x04, 0x0a, 0x6d, 0x06, 0x2d, 0x06, 0x1c, 0x0d, 0x1c, 0x0c, 0x1b, 0x17, 0x2d,
+    0x04, 0x1b, 0x0c, 0x17, 0x4d, 0x17, 0x1d, 0x0c, 0x1b, 0x17, 0x04, 0x1d, 0x39, 0x1d, 0x2d, 0x1a,
+    0x04, 0x0a, 0x1c, 0x06, 0x2d, 0xe6, 0xc6, 0x30, 0x1e, 0x4a, 0x30, 0x03, 0x1e, 0x90, 0xe2, 0x42,
+    0x05, 0x02, 0x25, 0x62, 0xe5, 0x25, 0x02, 0x23, 0x45, 0x00, 0x03, 0x10, 0x2b, 0x22, 0x0b, 0x25,
+    0x2b, 0x45, 0x4b, 0x62, 0x2b, 0x05, 0x02, 0x2b, 0x02, 0x10, 0x06, 0x1a, 0x3b, 0x1a, 0x10, 0x0b,
+    0x08, 0x06, 0x04, 0x1b, 0x1a, 0x1e, 0x17, 0x1c, 0x1b, 0x1a, 0x17, 0x46, 0x1e, 0x0a, 0x04, 0x1c,
+    0x8d, 0x3c, 0x17, 0x04, 0x3b, 0x0d, 0x1c, 0x2d, 0x1b, 0x0c, 0x0d, 0x3c, 0x0d, 0x17, 0x1d, 0x3b,
+    0x0d, 0x04, 0x1b, 0x39, 0x1b, 0x1d, 0x1a, 0x04, 0x2d, 0x26, 0x0d, 0x06, 0x4d, 0x26, 0x0d, 0xe6,
+    0x06, 0x30, 0x08, 0x0a, 0x15, 0x0a, 0x06, 0x10, 0x08, 0x1e, 0x90, 0xe2, 0x42, 0xe5, 0x62, 0x85,
+    0x0b, 0x11, 0x08, 0x03, 0x02, 0x05, 0x02, 0x05, 0x02, 0x23, 0x02, 0x0b, 0x62, 0x0b, 0x05, 0x4b,
+    0x05, 0x42, 0x0b, 0x02, 0x4b, 0x02, 0x03, 0x70, 0x06, 0x1a, 0x1b, 0x1d, 0x1b, 0x04, 0x0b, 0x46,
+    0x1c, 0x1b, 0x1a, 0x06, 0x04, 0x1b, 0x1a, 0x17, 0x06, 0x6d, 0x24, 0x1c, 0x0d, 0x26, 0x6d, 0x1c,
+    0x2c, 0x0d, 0x5c, 0x1b, 0x0c, 0x0d, 0x3c, 0x2d, 0x1d, 0x0c, 0x1b, 0x17, 0x1d, 0x59, 0x3b, 0x1c,
+    0x06, 0x2d, 0x26, 0x0d, 0xe6, 0xe6, 0x30, 0x08, 0x0a, 0x15, 0x0a, 0x06, 0x10, 0x08, 0x1e, 0x03,
+    0x70, 0xe2, 0x42, 0xe5, 0xe5, 0x02, 0x31, 0x02, 0x2b, 0x02, 0x00, 0x45, 0x23, 0x2b, 0x10, 0x22,
+    0xb0, 0x40, 0x30, 0x43, 0x08, 0x03, 0x3e, 0x06, 0x04, 0x3a, 0x26, 0x15, 0x1b, 0x15, 0x26, 0x11,
+    0x06, 0x3a, 0x0d, 0x1e, 0x1b, 0x1a, 0x06, 0x4d, 0x24, 0x1c, 0x04, 0x1c, 0x26, 0x0d, 0x06, 0x2d,
+    0x1c, 0x0c, 0x1b, 0x1a, 0x0d, 0x17, 0x04, 0x1b, 0x18, 0x1d, 0x3c, 0x04, 0x1c, 0x1d, 0x2c, 0x1c,
+    0x06, 0x18, 0x39, 0x3b, 0x3a, 0x04, 0x2d, 0x04, 0x0d, 0x06, 0x0d, 0x26, 0x4d, 0xe6, 0x26, 0x30,
+    0x08, 0x2a, 0x1e, 0x26, 0x08, 0x1e, 0x03, 0x70, 0xe2, 0x42, 0xe5, 0xe5, 0x00, 0x11, 0x02, 0x25,
+    0x02, 0x23, 0x11, 0x05, 0x01, 0x05, 0x10, 0x03, 0x10, 0x0b, 0x05, 0x0b, 0x50, 0x22, 0x10, 0x66,
+    0x03, 0x48, 0x26, 0x2d, 0x04, 0x1a, 0x15, 0x17, 0x10, 0x26, 0x04, 0x1b, 0x1a, 0x10, 0x08, 0x06,
+    0x3a, 0x2d, 0x1b, 0x1a, 0x10, 0x0d, 0x06, 0x1e, 0x35, 0x24, 0x1c, 0x0d, 0x26, 0x1c, 0x0d, 0x04,
+    0x18, 0x1b, 0x1d, 0x0d, 0x17, 0x04, 0x0c, 0x18, 0x1d, 0x5c, 0x0d, 0x1d, 0x18, 0x0c, 0x17, 0x0d,
+    0x38, 0x1a, 0x7d, 0x44, 0x1c, 0x15, 0x04, 0x46, 0x6d, 0xe6, 0x46, 0x10, 0x08, 0x15, 0x1a, 0x15,
+    0x06, 0x10, 0x06, 0x1e, 0x03, 0x70, 0x22, 0x0b, 0x42, 0x0b, 0x62, 0xe5, 0x00, 0x22, 0xe5, 0x05,
+    0x0b, 0x00, 0x23, 0x11, 0x05, 0x21, 0x02, 0x08, 0x03, 0x02, 0x0b, 0x02, 0x30, 0x42, 0x00, 0x22,
+    0x8b, 0x02, 0x46, 0x0d, 0x1a, 0x0a, 0x46, 0x0b, 0x26, 0x0a, 0x1b, 0x26, 0x10, 0x1b, 0x1a, 0x0d,
+    0x1e, 0x1b, 0x1a, 0x26, 0x0d, 0x04, 0x0a, 0x04, 0x2a, 0x0d, 0x1c, 0x17, 0x04, 0x0d, 0x1d, 0x18,
+    0x0c, 0x1c, 0x17, 0x0d, 0x1d, 0x0c, 0x18, 0x17, 0x2d, 0x04, 0x1c, 0x1b, 0x18, 0x1b, 0x10, 0x04,
+    0x38, 0x1a, 0x0d, 0x1d, 0x64, 0x1d, 0x3b, 0x44, 0x1e, 0x86, 0x2d, 0x3e, 0xc6, 0x10, 0x08, 0x0a,
+    0x35, 0x06, 0x10, 0x06, 0x1e, 0x03, 0x70, 0x22, 0x0b, 0x42, 0x0b, 0x25, 0x22, 0x05, 0x22, 0x45,
+    0x22, 0x03, 0x00, 0x02, 0x65, 0x02, 0x41, 0x05, 0x00, 0x11, 0x02, 0x0b, 0x02, 0x21, 0x23, 0x2b,
+    0x08, 0x00, 0x02, 0x25, 0x62, 0x30, 0x22, 0x30, 0x11, 0x03, 0x08, 0x06, 0x10, 0x06, 0x1a, 0x04,
+    0x10, 0x06, 0x10, 0x03, 0x02, 0x06, 0x04, 0x1b, 0x46, 0x1b, 0x1a, 0x1c, 0x0d, 0x1b, 0x1a, 0x10,
+    0x0d, 0x44, 0x2d, 0x04, 0x1c, 0x06, 0x1c, 0x1a, 0x1b, 0x0c, 0x1b, 0x4d, 0x1a, 0x2c, 0x17, 0x2d,
+    0x3c, 0x1b, 0x0c, 0x1a, 0x17, 0x1a, 0x38, 0x3d, 0x3b, 0xcc, 0x1b, 0xe4, 0x04, 0x2a, 0x04, 0xc6,
+    0x10, 0x06, 0x08, 0x70, 0x08, 0x1e, 0x03, 0x70, 0x22, 0x0b, 0x22, 0x0b, 0x45, 0x22, 0x00, 0x03,
+    0x08, 0x03, 0x00, 0x42, 0x00, 0x02, 0x25, 0x02, 0x00, 0x23, 0x21, 0x0b, 0x28, 0x05, 0x21, 0x05,
+    0x10, 0x23, 0x10, 0x11, 0x30, 0x03, 0x08, 0x05, 0x01, 0x45, 0x42, 0x00, 0x03, 0x06, 0x10, 0x06,
+    0x2d, 0x06, 0x0d, 0x35, 0x0d, 0x1e, 0x0d, 0x10, 0x26, 0x0d, 0x1a, 0x1b, 0x0d, 0x06, 0x10, 0x1b,
+    0x1a, 0x2d, 0x1b, 0x1a, 0x10, 0x0d, 0x04, 0x2d, 0x26, 0x04, 0x0d, 0x10, 0x1d, 0x0c, 0x18, 0x1b,
+    0x1c, 0x17, 0x0d, 0x1b, 0x2c, 0x17, 0x4d, 0x04, 0x0c, 0x18, 0x15, 0x10, 0x0c, 0x18, 0x0c, 0x3d,
+    0x1a, 0x2c, 0x04, 0x1c, 0x1a, 0x04, 0x1a, 0x3b, 0x1a, 0x1c, 0xed, 0x0d, 0x3e, 0xe6, 0x10, 0x28,
+    0x5e, 0x00, 0x08, 0x10, 0x06, 0x00, 0x02, 0x30, 0x02, 0x0b, 0x62, 0x00, 0x02, 0x05, 0x00, 0x06,
+    0x1e, 0x04, 0x3e, 0x0d, 0x06, 0x1e, 0x46, 0x28, 0x23, 0x11, 0x05, 0x20, 0x85, 0x02, 0x11, 0x00,
+    0x2b, 0x11, 0x08, 0x10, 0x0b, 0x08, 0x03, 0x02, 0x30, 0x02, 0x05, 0x02, 0x0b, 0x02, 0x0b, 0x08,
+    0x1e, 0x46, 0x04, 0x15, 0x1a, 0x04, 0x0d, 0x1e, 0x08, 0x26, 0x0d, 0x1a, 0x3b, 0x17, 0x08, 0x10,
+    0x3a, 0x2d, 0x1b, 0x1a, 0x10, 0x0d, 0x04, 0x2d, 0x06, 0x0d, 0x15, 0x04, 0x0d, 0x1c, 0x1b, 0x0c,
+    0x1a, 0x2d, 0x2c, 0x1a, 0x17, 0x1c, 0x04, 0x0d, 0x0a, 0x2c, 0x0d, 0x17, 0x38, 0x0c, 0x3c, 0x1b,
+    0x18, 0x1b, 0x17, 0x0d, 0x1c, 0x17, 0x6d, 0xe6, 0x46, 0x0d, 0x86, 0x10, 0x26, 0x10, 0x06, 0x9e,
+    0x06, 0x08, 0x06, 0x10, 0x02, 0x0b, 0x02, 0x0b, 0x02, 0x10, 0x2b, 0xc2, 0x08, 0x1e, 0x08, 0x06,
+    0x10, 0x06, 0x03, 0x06, 0x30, 0x02, 0x00, 0x02, 0x25, 0x11, 0x00, 0x05, 0x41, 0x0b, 0x11, 0x00,
+    0x02, 0x05, 0x0b, 0x28, 0x10, 0x0b, 0x10, 0x1e, 0x06, 0x10, 0x06, 0x3e, 0x06, 0x0b, 0x25, 0x03,
+    0x30, 0x1e, 0x06, 0x3a, 0x15, 0x0a, 0x1e, 0x0d, 0x1e, 0x11, 0x10, 0x04, 0x1a, 0x35, 0x1b, 0x0d,
+    0x06, 0x10, 0x3a, 0x0d, 0x1c, 0x1b, 0x1a, 0x17, 0x0d, 0x1e, 0x0d, 0x06, 0x0d, 0x04, 0x15, 0x04,
+    0x2d, 0x1c, 0x0d, 0x10, 0x04, 0x1b, 0x0c, 0x1a, 0x17, 0x04, 0x0d, 0x17, 0x1a, 0x0c, 0x1b, 0x37,
+    0x38, 0x1b, 0x1d, 0x1c, 0x1b, 0x0c, 0x1a, 0x4d, 0x17, 0xed, 0xe6, 0xa6, 0x70, 0x06, 0x9e, 0x06,
+    0x08, 0x06, 0x00, 0x22, 0x00, 0x02, 0x0b, 0x02, 0x10, 0x02, 0x00, 0x02, 0x05, 0x0b, 0x02, 0x0b,
+    0x02, 0x30, 0x0b, 0x65, 0x2b, 0xa5, 0x10, 0x0b, 0x05, 0x21, 0x05, 0x02, 0x11, 0x25, 0x0b, 0x28,
+    0x10, 0x0b, 0x10, 0x08, 0x03, 0x0b, 0x10, 0x08, 0x3e, 0x06, 0x05, 0x0b, 0x10, 0x0b, 0x10, 0x26,
+    0x15, 0x5c, 0x04, 0x08, 0x10, 0x11, 0x0b, 0x1e, 0x35, 0x0d, 0x04, 0x1b, 0x26, 0x10, 0x3a, 0x0d,
+    0x1c, 0x1b, 0x1a, 0x17, 0x0d, 0x1e, 0x0d, 0x06, 0x0d, 0x1c, 0x0a, 0x24, 0x0d, 0x06, 0x1a, 0x2c,
+    0x1b, 0x1c, 0x2d, 0x37, 0x1b, 0x18, 0x1d, 0x0d, 0x17, 0x19, 0x18, 0x1d, 0x1c, 0x04, 0x2c, 0x04,
+    0x4d, 0x06, 0x2d, 0x10, 0x6d, 0xe6, 0xe6, 0x70, 0x08, 0x0a, 0x1e, 0x0a, 0x1e, 0x0a, 0x0b, 0x03,
+    0x20, 0x2b, 0x20, 0x42, 0x05, 0x22, 0x0b, 0x08, 0x0a, 0x1e, 0x02, 0x2b, 0x22, 0xe5, 0x45, 0x01,
+    0x65, 0x03, 0x00, 0x45, 0x11, 0x08, 0x10, 0x0b, 0x10, 0x08, 0x02, 0x05, 0x0b, 0x08, 0x1e, 0x08,
+    0x06, 0x02, 0x0b, 0x02, 0x0b, 0x30, 0x1e, 0x15, 0x4d, 0x06, 0x10, 0x0b, 0x02, 0x11, 0x05, 0x0a,
+    0x1a, 0x0d, 0x06, 0x15, 0x1a, 0x06, 0x03, 0x10, 0x3a, 0x0d, 0x1c, 0x1b, 0x1a, 0x17, 0x0d, 0x1e,
+    0x0d, 0x26, 0x0d, 0x1e, 0x0d, 0x08, 0x10, 0x1a, 0x2c, 0x1b, 0x1a, 0x4d, 0x04, 0x1b, 0x0c, 0x04,
+    0x17, 0x04, 0x19, 0x0c, 0x1a, 0x04, 0x1d, 0x18, 0x1b, 0x04, 0x8d, 0x37, 0xad, 0xe6, 0xc6, 0x70,
+    0x3e, 0x10, 0x28, 0x1e, 0x10, 0x0a, 0x1e, 0x0a, 0x08, 0x22, 0x20, 0x02, 0x03, 0x00, 0x10, 0x00,
+    0x02, 0x08, 0xaa, 0x08, 0x02, 0xe5, 0x25, 0x01, 0x25, 0x0b, 0x02, 0x00, 0x05, 0x01, 0x05, 0x00,
+    0x02, 0x2b, 0x10, 0x11, 0x02, 0x05, 0x02, 0x03, 0x08, 0x02, 0x05, 0x02, 0x05, 0x2b, 0x02, 0x0b,
+    0x1e, 0x15, 0x1e, 0x28, 0x06, 0x10, 0x08, 0x31, 0x02, 0x05, 0x04, 0x1a, 0x1c, 0x10, 0x1e, 0x1a,
+    0x26, 0x10, 0x3a, 0x0d, 0x1e, 0x1b, 0x1a, 0x17, 0x0d, 0x04, 0x0d, 0x46, 0x2d, 0x1e, 0x06, 0x04,
+    0x1b, 0x0c, 0x1b, 0x2d, 0x17, 0x04, 0x1b, 0x18, 0x04, 0x0d, 0x1b, 0x18, 0x1b, 0x04, 0x1c, 0x1d,
+    0x18, 0x1b, 0xad, 0x26, 0x2d, 0x06, 0x0d, 0xe6, 0xe6, 0x26, 0x50, 0x06, 0x03, 0x08, 0x1e, 0x28,
+    0x06, 0x08, 0x1a, 0x55, 0x08, 0x62, 0x2b, 0x42, 0x08, 0x0e, 0x1e, 0x50, 0x11, 0x28, 0x03, 0x0b,
+    0x01, 0x65, 0x0b, 0x02, 0x10, 0x25, 0x0b, 0x11, 0x02, 0x45, 0x00, 0x02, 0x05, 0x0b, 0x11, 0x08,
+    0x10, 0x05, 0x06, 0x08, 0x03, 0x02, 0x21, 0x05, 0x00, 0x02, 0x0b, 0x10, 0x3e, 0x06, 0x03, 0x02,
+    0x4b, 0x10, 0x0b, 0x10, 0x0d, 0x0a, 0x15, 0x04, 0x06, 0x10, 0x1e, 0x1a, 0x06, 0x00, 0x10, 0x1a,
+    0x1d, 0x2d, 0x1b, 0x1a, 0x10, 0x0d, 0x1e, 0x0d, 0x66, 0x0d, 0x06, 0xad, 0x17, 0x1a, 0x2c, 0x1c,
+    0x17, 0x0c, 0x18, 0x1b, 0x1c, 0x04, 0x1b, 0x0c, 0x1a, 0x17, 0x8d, 0x06, 0x0d, 0x86, 0x0d, 0xe6,
+    0xe6, 0x06, 0x50, 0x26, 0x1e, 0x15, 0x2a, 0x28, 0x15, 0x1e, 0x2a, 0x08, 0x22, 0x30, 0x40, 0x25,
+    0x22, 0x2b, 0x25, 0x0b, 0x10, 0x3e, 0x10, 0x45, 0x0b, 0x10, 0x48, 0x0b, 0x20, 0x05, 0x21, 0x05,
+    0x11, 0x02, 0x05, 0x02, 0x03, 0x00, 0x05, 0x0b, 0x10, 0x26, 0x0b, 0x25, 0x01, 0x45, 0x06, 0x3e,
+    0x08, 0x02, 0x05, 0x00, 0x02, 0x0b, 0x10, 0x0b, 0x10, 0x1e, 0x35, 0x04, 0x17, 0x06, 0x10, 0x1e,
+    0x1a, 0x06, 0x00, 0x10, 0x1a, 0x1d, 0x06, 0x0d, 0x1a, 0x15, 0x10, 0x0d, 0x1e, 0x0d, 0x66, 0x0d,
+    0x08, 0x17, 0x0d, 0x26, 0x02, 0x17, 0x0c, 0x18, 0x0c, 0x17, 0x1a, 0x19, 0x18, 0x1b, 0x04, 0x1c,
+    0x1b, 0x0c, 0x1d, 0x17, 0xcd, 0x26, 0x0d, 0x06, 0x2d, 0x06, 0x2d, 0xe6, 0xc6, 0x50, 0x06, 0x03,
+    0x28, 0x10, 0x08, 0x3e, 0x1a, 0x35, 0x0a, 0x08, 0x10, 0xa2, 0x05, 0x42, 0x00, 0x05, 0x01, 0x45,
+    0x0b, 0x08, 0x1e, 0x00, 0x02, 0x05, 0x02, 0x48, 0x06, 0x00, 0x65, 0x20, 0x25, 0x20, 0x02, 0x05,
+    0x0b, 0x10, 0x08, 0x06, 0x01, 0x0b, 0x02, 0x01, 0x0b, 0x05, 0x0b, 0x00, 0x1e, 0x08, 0x05, 0x06,
+    0x10, 0x01, 0x10, 0x05, 0x10, 0x08, 0x1e, 0x35, 0x1e, 0x06, 0x02, 0x00, 0x26, 0x1e, 0x1a, 0x10,
+    0x26, 0x1a, 0x1d, 0x2d, 0x1a, 0x15, 0x10, 0x0d, 0x1e, 0x06, 0x0d, 0x46, 0x03, 0x06, 0x0d, 0x06,
+    0x2d, 0x17, 0x0c, 0x18, 0x0c, 0x1d, 0x18, 0x39, 0x1b, 0x1c, 0x1d, 0x0c, 0x1b, 0x04, 0x2d, 0x17,
+    0x2d, 0x26, 0x2d, 0x06, 0x08, 0x46, 0x0d, 0x06, 0x2d, 0x03, 0x06, 0x4d, 0x26, 0x17, 0x26, 0x0d,
+    0x03, 0x26, 0x0d, 0x06, 0x00, 0x10, 0x26, 0x1e, 0x08, 0x1e, 0x0e, 0x0a, 0x08, 0x1a, 0x15, 0x1a,
+    0x15, 0x30, 0x00, 0x0b, 0x10, 0x00, 0x01, 0x17, 0x00, 0x05, 0x23, 0x3e, 0x08, 0x06, 0x08, 0x06,
+    0x2b, 0x10, 0x1e, 0x08, 0x05, 0x01, 0x00, 0x11, 0x20, 0x45, 0x02, 0x11, 0x02, 0x25, 0x00, 0x03,
+    0x00, 0x25, 0x11, 0x08, 0x10, 0x06, 0x17, 0x31, 0x01, 0x10, 0x01, 0x0b, 0x28, 0x00, 0x02, 0x30,
+    0x00, 0x05, 0x01, 0x10, 0x0a, 0x35, 0x04, 0x00, 0x02, 0x10, 0x00, 0x30, 0x0e, 0x1a, 0x10, 0x06,
+    0x0b, 0x1a, 0x15, 0x00, 0x1e, 0x1b, 0x1e, 0x17, 0x0d, 0x04, 0x03, 0x06, 0x0d, 0x10, 0x2d, 0x26,
+    0x08, 0x10, 0x0d, 0x2c, 0x1b, 0x1d, 0x59, 0x1b, 0x1d, 0x04, 0x0c, 0x1b, 0x1e, 0x5b, 0x04, 0x1c,
+    0x06, 0x2d, 0x17, 0x2d, 0x26, 0x04, 0x06, 0x0d, 0x06, 0x0d, 0x10, 0x06, 0x2d, 0x86, 0x08, 0x10,
+    0x66, 0x02, 0x10, 0x46, 0x02, 0x1e, 0x08, 0x06, 0x08, 0x1e, 0x03, 0x1a, 0x1f, 0x35, 0x0d, 0x10,
+    0x02, 0x10, 0x05, 0x06, 0x00, 0x25, 0x10, 0x00, 0x2a, 0x1e, 0x28, 0x3e, 0x08, 0x02, 0x05, 0x06,
+    0x28, 0x0b, 0x01, 0x00, 0x02, 0x05, 0x01, 0x05, 0x02, 0x11, 0x02, 0x25, 0x20, 0x02, 0x05, 0x0b,
+    0x10, 0x03, 0x02, 0x0b, 0x08, 0x54, 0x09, 0x54, 0x17, 0x0e, 0x21, 0x00, 0x03, 0x01, 0x0d, 0x06,
+    0x0d, 0x04, 0x0a, 0x0d, 0x00, 0x10, 0x11, 0x08, 0x06, 0x05, 0x00, 0x1e, 0x1a, 0x06, 0x20, 0x1a,
+    0x1d, 0x0d, 0x06, 0x1a, 0x15, 0x17, 0x0d, 0x03, 0x08, 0x0d, 0x10, 0x0d, 0x26, 0x0d, 0x17, 0x08,
+    0x17, 0x1a, 0x1b, 0x1a, 0x04, 0xb4, 0x18, 0x1a, 0x1e, 0x1c, 0x2c, 0x1b, 0x1d, 0x57, 0x0d, 0x1e,
+    0x0d, 0x10, 0x06, 0x0d, 0x06, 0x0d, 0x06, 0x0d, 0x08, 0x0d, 0x06, 0x0d, 0x66, 0x17, 0x46, 0x37,
+    0x00, 0x06, 0x0d, 0x08, 0x06, 0x02, 0x20, 0x10, 0x00, 0x06, 0x03, 0x10, 0x06, 0x43, 0x10, 0x02,
+    0x00, 0x05, 0x00, 0x0b, 0x05, 0x10, 0x20, 0x0b, 0x00, 0x28, 0x03, 0x00, 0x02, 0x00, 0x03, 0x08,
+    0x03, 0x02, 0x05, 0x0b, 0x08, 0x1e, 0x02, 0x25, 0x10, 0x01, 0x02, 0x00, 0x02, 0x25, 0x02, 0x00,
+    0x25, 0x0b, 0x10, 0x11, 0x02, 0x2b, 0x05, 0xc9, 0x14, 0x10, 0x01, 0x03, 0x1e, 0x06, 0x17, 0x10,
+    0x06, 0x02, 0x05, 0x10, 0x08, 0x10, 0x11, 0x01, 0x05, 0x0b, 0x11, 0x00, 0x0d, 0x1a, 0x10, 0x03,
+    0x0b, 0x1a, 0x15, 0x2d, 0x1a, 0x15, 0x0b, 0x0d, 0x1e, 0x0d, 0x00, 0x86, 0x04, 0x26, 0x15, 0x1b,
+    0x1d, 0x0d, 0xa9, 0x1b, 0x08, 0x0d, 0x1c, 0x3a, 0x3b, 0x66, 0x0d, 0x06, 0x4d, 0x26, 0x03, 0x06,
+    0x0d, 0x06, 0x10, 0x00, 0x03, 0x00, 0x0d, 0x06, 0x2d, 0x00, 0x10, 0x00, 0x0d, 0x06, 0x00, 0x06,
+    0x17, 0x03, 0x00, 0x26, 0x10, 0x00, 0x06, 0x10, 0x03, 0x01, 0x17, 0x26, 0x10, 0x08, 0x05, 0x10,
+    0x00, 0x10, 0x0b, 0x08, 0x10, 0x00, 0x01, 0x03, 0x00, 0xa5, 0x03, 0x28, 0x02, 0x25, 0x0a, 0x0c,
+    0x1b, 0x2b, 0x00, 0x65, 0x20, 0x05, 0x01, 0x02, 0x11, 0x02, 0x2b, 0x45, 0x1f, 0x29, 0x7f, 0x09,
+    0x14, 0x28, 0x03, 0x05, 0x2b, 0x17, 0x0b, 0x10, 0x0b, 0x02, 0x0b, 0x65, 0x0b, 0x00, 0x04, 0x1a,
+    0x17, 0x0b, 0x17, 0x0d, 0x1a, 0x06, 0x1c, 0x24, 0x0b, 0x37, 0x0d, 0x26, 0x00, 0x06, 0x37, 0x0b,
+    0x08, 0x05, 0x24, 0x37, 0x18, 0x19, 0x29, 0x0c, 0x18, 0x1b, 0x10, 0x06, 0x17, 0x2d, 0x1c, 0x0c,
+    0x1d, 0x0d, 0x57, 0x06, 0x17, 0x10, 0x26, 0x57, 0x10, 0x17, 0x08, 0x57, 0x06, 0x0d, 0x06, 0x10,
+    0x57, 0x00, 0x2b, 0x17, 0x26, 0x0d, 0x30, 0x17, 0x05, 0x01, 0x0d, 0x02, 0x10, 0x02, 0x05, 0x30,
+    0x0b, 0x01, 0x0b, 0x10, 0x17, 0x01, 0x2b, 0x20, 0x0b, 0x02, 0x00, 0xa5, 0x00, 0x03, 0x08, 0x06,
+    0x05, 0x08, 0x1b, 0x0c, 0x1e, 0x10, 0x45, 0x02, 0x20, 0x05, 0x01, 0x02, 0x20, 0x0b, 0x65, 0x0b,
+    0x17, 0x29, 0x05, 0x17, 0x2b, 0x29, 0x06, 0x05, 0x00, 0x02, 0x05, 0x94, 0x17, 0x25, 0x74, 0x17,
+    0x1e, 0x15, 0x74, 0x1e, 0x06, 0x17, 0x94, 0x17, 0x06, 0x0d, 0x1c, 0x74, 0x17, 0x74, 0x0b, 0x1d,
+    0x0c, 0x29, 0x04, 0x1d, 0x1b, 0x0d, 0x02, 0x1c, 0x06, 0x0d, 0x06, 0x17, 0x94, 0x04, 0x1a, 0x15,
+    0x3a, 0x04, 0x74, 0x04, 0x54, 0x11, 0x10, 0x17, 0x74, 0x17, 0x54, 0x20, 0x17, 0x94, 0x10, 0x06,
+    0x00, 0x06, 0x74, 0x0b, 0x74, 0x03, 0x02, 0x01, 0x00, 0x0b, 0x10, 0x02, 0x85, 0x01, 0x05, 0x02,
+    0x23, 0x10, 0x0b, 0x02, 0x0a, 0x1e, 0x17, 0x05, 0x0b, 0x02, 0x11, 0x02, 0x45, 0x03, 0x02, 0xa5,
+    0x01, 0x03, 0x09, 0x14, 0x0b, 0x37, 0x05, 0x29, 0x00, 0x05, 0x03, 0x10, 0x14, 0x89, 0x14, 0x0b,
+    0x02, 0x69, 0x0b, 0x17, 0x1a, 0x69, 0x10, 0x0b, 0x14, 0x89, 0x14, 0x17, 0x0d, 0x1e, 0x69, 0x14,
+    0x69, 0x11, 0x1e, 0x0c, 0x29, 0x1d, 0x3b, 0x1c, 0x4d, 0x06, 0x17, 0x14, 0x89, 0x14, 0x0d, 0x1b,
+    0x1a, 0x04, 0x14, 0x69, 0x14, 0x49, 0x11, 0x17, 0x14, 0x69, 0x14, 0x49, 0x11, 0x10, 0x14, 0x89,
+    0x14, 0x17, 0x02, 0x01, 0x69, 0x14, 0x69, 0x01, 0x02, 0x01, 0x05, 0x02, 0x0b, 0x22, 0xa5, 0x02,
+    0x03, 0x06, 0x02, 0x05, 0x01, 0x05, 0x02, 0x10, 0x0b, 0x30, 0x2b, 0x02, 0x0b, 0x05, 0x0b, 0x11,
+    0x02, 0x21, 0x05, 0x02, 0x25, 0x17, 0x29, 0x74, 0x09, 0x1f, 0x01, 0x10, 0x11, 0x14, 0x29, 0x53,
+    0x29, 0x14, 0x05, 0x13, 0x29, 0x13, 0x17, 0x14, 0x0d, 0x18, 0x29, 0x18, 0x04, 0x14, 0x09, 0x16,
+    0x0c, 0x3f, 0x16, 0x09, 0x14, 0x08, 0x0d, 0x18, 0x16, 0x69, 0x58, 0x0b, 0x1e, 0x1b, 0x29, 0x1a,
+    0x1b, 0x0c, 0x1d, 0x77, 0x14, 0x29, 0x53, 0x29, 0x14, 0x0d, 0x04, 0x14, 0x29, 0x36, 0x13, 0x49,
+    0x18, 0x10, 0x14, 0x29, 0x13, 0x18, 0x13, 0x49, 0x13, 0x11, 0x14, 0x09, 0x7f, 0x16, 0x09, 0x14,
+    0x31, 0x33, 0x69, 0x33, 0x16, 0x05, 0x02, 0x17, 0x01, 0x05, 0x11, 0x01, 0xe5, 0x0d, 0x03, 0xc1,
+    0x05, 0x02, 0x0b, 0x02, 0x31, 0x2b, 0x06, 0x10, 0x05, 0x02, 0x28, 0x05, 0x01, 0x17, 0xa9, 0x13,
+    0x05, 0x02, 0x10, 0x11, 0x29, 0x13, 0x05, 0x01, 0x0b, 0x13, 0x29, 0x02, 0x0b, 0x09, 0x14, 0x17,
+    0x14, 0x09, 0x14, 0x04, 0x29, 0x04, 0x1a, 0x29, 0x94, 0x29, 0x03, 0x57, 0x29, 0x33, 0x3d, 0x17,
+    0x01, 0x04, 0x1a, 0x29, 0x15, 0x3a, 0x0d, 0x34, 0x04, 0x0d, 0x29, 0x13, 0x57, 0x13, 0x29, 0x06,
+    0x17, 0x29, 0x13, 0x57, 0x18, 0x29, 0x1d, 0x00, 0x29, 0x18, 0x57, 0x18, 0x29, 0x26, 0x29, 0x94,
+    0x29, 0x20, 0x25, 0x09, 0x14, 0x33, 0x05, 0x0b, 0x85, 0x22, 0x05, 0x01, 0x05, 0x02, 0x65, 0x0b,
+    0x23, 0x25, 0x01, 0x65, 0x22, 0x2b, 0x31, 0x2b, 0x30, 0x01, 0x05, 0x08, 0x11, 0x05, 0x10, 0x11,
+    0x29, 0x73, 0x0b, 0x11, 0x01, 0x05, 0x02, 0x29, 0x0b, 0x08, 0x10, 0x0b, 0x01, 0x09, 0x14, 0x11,
+    0x03, 0x13, 0x09, 0x14, 0x49, 0x14, 0x09, 0x18, 0x15, 0x1a, 0xe9, 0x09, 0x05, 0x0d, 0x03, 0x1e,
+    0x29, 0x17, 0x05, 0x3a, 0x04, 0x17, 0x1e, 0x1b, 0x29, 0x4d, 0x03, 0x29, 0x15, 0x0d, 0x09, 0x14,
+    0x17, 0x11, 0x08, 0x17, 0x11, 0x29, 0x06, 0x08, 0x29, 0x17, 0x1e, 0x04, 0x1c, 0x17, 0x29, 0x1b,
+    0x04, 0x29, 0x17, 0x0d, 0x26, 0x0b, 0x29, 0x06, 0x00, 0xe9, 0x09, 0x08, 0x0b, 0x02, 0x11, 0x29,
+    0x2b, 0x05, 0x2b, 0x42, 0x0b, 0x65, 0x10, 0x45, 0x01, 0x05, 0x00, 0x23, 0x25, 0x01, 0x05, 0x01,
+    0x25, 0x22, 0x2b, 0x11, 0x02, 0x05, 0x0b, 0x06, 0x02, 0x01, 0x05, 0x11, 0x02, 0x01, 0x02, 0x10,
+    0x29, 0x11, 0x0b, 0x10, 0x0b, 0x25, 0x10, 0x22, 0x09, 0x34, 0x10, 0x0b, 0x11, 0x14, 0x29, 0x11,
+    0x00, 0x05, 0x49, 0x13, 0x49, 0x17, 0x04, 0x08, 0x29, 0x13, 0x36, 0x1f, 0x56, 0x1a, 0x06, 0x17,
+    0x10, 0x29, 0x17, 0x11, 0x2d, 0x04, 0x0b, 0x17, 0x04, 0x14, 0x09, 0x77, 0x29, 0x04, 0x1e, 0x29,
+    0x14, 0x11, 0x37, 0x34, 0x09, 0x00, 0x08, 0x29, 0x14, 0x37, 0x10, 0x14, 0x29, 0x18, 0x19, 0x29,
+    0x14, 0x17, 0x0b, 0x17, 0x14, 0x29, 0x20, 0x29, 0x16, 0x1f, 0x13, 0x1f, 0x13, 0x1f, 0x13, 0x05,
+    0x00, 0x17, 0x05, 0x09, 0x14, 0x01, 0x17, 0x01, 0x11, 0x4b, 0x02, 0x0b, 0x85, 0x2b, 0x65, 0x23,
+    0x25, 0x01, 0x05, 0x01, 0x25, 0x22, 0x2b, 0x00, 0x02, 0x01, 0x0b, 0x11, 0x02, 0x01, 0x05, 0x11,
+    0x02, 0x21, 0x34, 0x09, 0x54, 0x05, 0x08, 0x00, 0x01, 0x05, 0x02, 0x13, 0x29, 0x54, 0x29, 0x13,
+    0x05, 0x03, 0x0b, 0x29, 0x13, 0x10, 0x13, 0x09, 0x14, 0x10, 0x03, 0x06, 0x13, 0x09, 0xd4, 0x3a,
+    0x34, 0x29, 0x74, 0x1c, 0x05, 0x34, 0x29, 0x74, 0x29, 0x04, 0x06, 0x13, 0x29, 0x54, 0x29, 0x13,
+    0x1e, 0x0d, 0x13, 0x29, 0x54, 0x49, 0x59, 0x29, 0x54, 0x49, 0x08, 0x0b, 0x13, 0x09, 0xd4, 0x11,
+    0x02, 0x34, 0x29, 0x74, 0x02, 0x6b, 0x25, 0x02, 0x01, 0x45, 0x21, 0x25, 0x23, 0x25, 0x01, 0x05,
+    0x21, 0x05, 0x22, 0x25, 0x00, 0x05, 0x01, 0x0b, 0x11, 0x02, 0x01, 0x05, 0x11, 0x02, 0x21, 0xa9,
+    0x0b, 0x01, 0x10, 0x05, 0x00, 0x10, 0x05, 0x13, 0x89, 0x13, 0x31, 0x05, 0x1e, 0x29, 0x05, 0x10,
+    0x17, 0x29, 0x00, 0x08, 0x0d, 0x17, 0x13, 0xa9, 0x13, 0x1a, 0x0a, 0xe9, 0x0d, 0x05, 0xe9, 0x29,
+    0x0d, 0x1e, 0x17, 0x13, 0x89, 0x13, 0x17, 0x03, 0x06, 0x17, 0x13, 0x69, 0x13, 0x29, 0x18, 0x19,
+    0x1b, 0x18, 0x69, 0x13, 0x09, 0x14, 0x11, 0x00, 0x0b, 0x13, 0xa9, 0x13, 0x10, 0x05, 0xe9, 0xc5,
+    0x21, 0x00, 0x21, 0x00, 0x01, 0x22, 0x23, 0x25, 0x01, 0x05, 0x41, 0x65, 0x20, 0x01, 0x0b, 0x11,
+    0x02, 0x01, 0x05, 0x11, 0x02, 0x01, 0x03, 0xb3, 0x11, 0x02, 0x05, 0x0b, 0x01, 0x0b, 0x00, 0x01,
+    0x93, 0x0b, 0x01, 0x00, 0x05, 0x1e, 0x33, 0x10, 0x06, 0x0a, 0x33, 0x00, 0x08, 0x06, 0x0d, 0x17,
+    0x18, 0x93, 0x17, 0x1a, 0x0b, 0xd3, 0x18, 0x04, 0x11, 0x13, 0x38, 0xd3, 0x06, 0x10, 0x08, 0x17,
+    0x93, 0x17, 0x03, 0x1e, 0x26, 0x17, 0x33, 0x18, 0x13, 0x17, 0x09, 0x14, 0x1c, 0x3d, 0x17, 0x73,
+    0x0b, 0x29, 0x00, 0x10, 0x02, 0x17, 0xb3, 0x05, 0x01, 0x06, 0xf3, 0xc5, 0x41, 0x25, 0x01, 0x45,
+    0x23, 0x65, 0x41, 0x05, 0x02, 0x25, 0x00, 0x05, 0x01, 0x05, 0x10, 0x02, 0x01, 0x05, 0x11, 0x10,
+    0x05, 0x50, 0x25, 0x10, 0x17, 0x0b, 0x01, 0x05, 0x2b, 0x02, 0x06, 0x05, 0x10, 0x05, 0x0b, 0x21,
+    0x11, 0x05, 0x02, 0x01, 0x03, 0x17, 0x10, 0x17, 0x06, 0x1e, 0x17, 0x10, 0x06, 0x03, 0x30, 0x15,
+    0x04, 0x37, 0x0b, 0x10, 0x17, 0x0a, 0x15, 0x10, 0x17, 0x30, 0x0b, 0x10, 0x11, 0x0d, 0x04, 0x1c,
+    0x05, 0x0d, 0x1d, 0x1a, 0xd7, 0x1c, 0x04, 0x2d, 0x97, 0x04, 0x1c, 0x0d, 0x26, 0x10, 0x14, 0x13,
+    0x34, 0x13, 0x29, 0x02, 0x10, 0x3e, 0x54, 0x13, 0x14, 0x29, 0x10, 0x05, 0x02, 0x01, 0x2b, 0x25,
+    0x01, 0x10, 0x25, 0x01, 0x25, 0x01, 0x05, 0x0b, 0x05, 0x02, 0x01, 0xc5, 0x0b, 0x25, 0x0a, 0x08,
+    0x01, 0x02, 0x25, 0x23, 0x65, 0x41, 0x05, 0x02, 0x25, 0x02, 0x05, 0x01, 0x05, 0x10, 0x02, 0x01,
+    0x05, 0x30, 0x05, 0x03, 0x00, 0x08, 0x11, 0x05, 0x01, 0x00, 0x03, 0x08, 0x05, 0x0b, 0x17, 0x21,
+    0x00, 0x10, 0x01, 0x2b, 0x10, 0x05, 0x10, 0x01, 0x05, 0x0d, 0x04, 0x05, 0x22, 0x04, 0x1e, 0x06,
+    0x00, 0x06, 0x0b, 0x02, 0x1e, 0x04, 0x1e, 0x06, 0x0b, 0x00, 0x05, 0x04, 0x1a, 0x10, 0x11, 0x26,
+    0x08, 0x10, 0x01, 0x3d, 0x10, 0x02, 0x1e, 0x3b, 0x06, 0x1e, 0x06, 0x04, 0x26, 0x08, 0x1e, 0x0d,
+    0x1c, 0x3e, 0x06, 0x0d, 0x1e, 0x06, 0x2d, 0x06, 0x00, 0x1e, 0x0d, 0xa9, 0x13, 0x06, 0x0d, 0x06,
+    0x1c, 0xa9, 0x13, 0x15, 0x1a, 0x35, 0x3a, 0x1f, 0x15, 0x1a, 0xf5, 0x2a, 0x15, 0x1e, 0x0a, 0x3e,
+    0x4a, 0x15, 0x1a, 0x39, 0x1b, 0x1e, 0x08, 0x21, 0x05, 0x23, 0x65, 0x21, 0x02, 0x31, 0x02, 0x0b,
+    0x02, 0x05, 0x01, 0x02, 0x00, 0x05, 0x01, 0x05, 0x00, 0x30, 0x2b, 0x02, 0x11, 0x02, 0x25, 0x00,
+    0x03, 0x00, 0x25, 0x62, 0x45, 0x22, 0x25, 0x01, 0x08, 0x1e, 0x10, 0x0b, 0x10, 0x04, 0x1e, 0x10,
+    0x08, 0x10, 0x00, 0x0b, 0x06, 0x1c, 0x0d, 0x00, 0x02, 0x00, 0x06, 0x1e, 0x15, 0x26, 0x10, 0x06,
+    0x50, 0x15, 0x0a, 0x0d, 0x05, 0x1e, 0x3a, 0x10, 0x3e, 0x0d, 0x5e, 0x2d, 0x3e, 0xed, 0x4d, 0xb3,
+    0x17, 0x04, 0x1e, 0x1c, 0x08, 0x33, 0x18, 0x53, 0x17, 0x0a, 0x35, 0x1f, 0x0a, 0x15, 0xea, 0x7e,
+    0x2e, 0x03, 0x5e, 0x48, 0x1e, 0x15, 0x38, 0x1a, 0x08, 0x02, 0x25, 0x02, 0x08, 0x03, 0x02, 0x25,
+    0x21, 0x05, 0x02, 0x20, 0x65, 0x01, 0x00, 0x03, 0x02, 0x25, 0x00, 0x10, 0x6b, 0x02, 0x11, 0x00,
+    0x02, 0x25, 0x23, 0x0b, 0x05, 0x00, 0x11, 0x02, 0x45, 0x22, 0x45, 0x08, 0x1e, 0x06, 0x0b, 0x10,
+    0x3e, 0x10, 0x11, 0x02, 0x00, 0x0b, 0x1e, 0x15, 0x04, 0x08, 0x05, 0x02, 0x00, 0x1e, 0x15, 0x26,
+    0x10, 0x06, 0x10, 0x03, 0x10, 0x0a, 0x15, 0x0d, 0x05, 0x1e, 0x3a, 0x30, 0x2d, 0x04, 0x1e, 0x6d,
+    0x1e, 0x0d, 0x06, 0xed, 0x1e, 0xb7, 0x44, 0x17, 0x0b, 0x1c, 0x1b, 0x17, 0x10, 0x17, 0x0b, 0x10,
+    0x00, 0x2b, 0x50, 0x4b, 0x02, 0x4b, 0x05, 0x01, 0x05, 0x22, 0x10, 0x02, 0xe5, 0x0b, 0x05, 0x00,
+    0x03, 0x11, 0x02, 0x25, 0x00, 0x08, 0x03, 0x02, 0x25, 0x61, 0x25, 0x01, 0x45, 0x01, 0x0b, 0x22,
+    0x01, 0x05, 0x20, 0x2b, 0x25, 0x0b, 0x00, 0x03, 0x02, 0x25, 0x02, 0x31, 0x62, 0x45, 0x22, 0x45,
+    0x08, 0x1e, 0x06, 0x0b, 0x10, 0x1e, 0x0d, 0x31, 0x02, 0x06, 0x0b, 0x0a, 0x35, 0x08, 0x25, 0x00,
+    0x1e, 0x15, 0x26, 0x50, 0x03, 0x10, 0x04, 0x15, 0x04, 0x10, 0x06, 0x1a, 0x1b, 0x1e, 0x10, 0x08,
+    0x06, 0x1e, 0x0a, 0x26, 0x0d, 0x1e, 0x0d, 0x06, 0xed, 0x0d, 0x26, 0x03, 0x2d, 0x1e, 0x04, 0x3d,
+    0x17, 0x1d, 0x18, 0x0c, 0x15, 0x05, 0x00, 0x08, 0x0b, 0x03, 0x00, 0x06, 0x10, 0x08, 0x05, 0x30,
+    0xc2, 0x25, 0x20, 0x22, 0x00, 0xe5, 0x85, 0x21, 0x00, 0x03, 0x00, 0x02, 0x25, 0xc1, 0x45, 0x01,
+    0x05, 0x22, 0x25, 0x02, 0x00, 0xa5, 0x02, 0x40, 0x25, 0x00, 0x03, 0x00, 0x85, 0x22, 0x0b, 0x25,
+    0x08, 0x1e, 0x10, 0x05, 0x00, 0x3e, 0x11, 0x22, 0x00, 0x0b, 0x1e, 0x15, 0x1e, 0x10, 0x22, 0x00,
+    0x1e, 0x15, 0x70, 0x02, 0x10, 0x0b, 0x0d, 0x04, 0x15, 0x1e, 0x06, 0x0a, 0x3a, 0x1e, 0x06, 0x10,
+    0x06, 0x10, 0x06, 0x3e, 0x0d, 0x1e, 0x08, 0x2d, 0x1e, 0x08, 0x0d, 0x08, 0x9e, 0x06, 0x0d, 0x3c,
+    0x3d, 0x04, 0x18, 0x39, 0x1a, 0x10, 0x17, 0x10, 0x05, 0x00, 0x0b, 0x22, 0x05, 0x02, 0x11, 0x50,
+    0x2b, 0x22, 0x05, 0x30, 0x20, 0x05, 0x41, 0x65, 0x21, 0x05, 0x00, 0x03, 0x05, 0x21, 0x05, 0x41,
+    0x45, 0xe1, 0x85, 0x0b, 0x00, 0x03, 0x02, 0x65, 0x41, 0x25, 0x01, 0x05, 0x20, 0x02, 0x25, 0x00,
+    0x03, 0x00, 0x65, 0x0b, 0x22, 0x25, 0x08, 0x1e, 0x10, 0x05, 0x00, 0x3e, 0x10, 0x0b, 0x00, 0x02,
+    0x0b, 0x10, 0x1e, 0x06, 0x10, 0x00, 0x02, 0x00, 0x1e, 0x15, 0x30, 0x00, 0x06, 0x02, 0x00, 0x02,
+    0x10, 0x06, 0x1e, 0x35, 0x04, 0x15, 0x3a, 0x35, 0x06, 0x03, 0x08, 0x26, 0x0d, 0xe6, 0x0d, 0x1e,
+    0x0d, 0x5e, 0x06, 0x0d, 0x44, 0x59, 0x0c, 0x04, 0x1a, 0x15, 0x06, 0x0d, 0x15, 0x0d, 0x06, 0x00,
+    0x10, 0x05, 0x50, 0x02, 0x10, 0x06, 0x08, 0x06, 0x05, 0x10, 0x0b, 0x05, 0x02, 0x25, 0x21, 0x45,
+    0x41, 0xe5, 0x25, 0xe1, 0x22, 0x45, 0x6b, 0x02, 0x00, 0x02, 0x65, 0x61, 0x05, 0x21, 0x05, 0x02,
+    0x03, 0x00, 0x25, 0x00, 0x03, 0x00, 0x02, 0x45, 0x22, 0x0b, 0x05, 0x08, 0x1e, 0x02, 0x05, 0x02,
+    0x3e, 0x00, 0x10, 0x08, 0x06, 0x30, 0x1e, 0x06, 0x10, 0x42, 0x1e, 0x0a, 0x30, 0x00, 0x06, 0x02,
+    0x00, 0x22, 0x0b, 0x06, 0x15, 0x1a, 0x15, 0x0a, 0x0d, 0x5a, 0x0b, 0x00, 0x06, 0x10, 0x06, 0x08,
+    0x46, 0x70, 0x26, 0x4d, 0x06, 0x00, 0x06, 0x08, 0x0d, 0x3c, 0x39, 0x18, 0x0d, 0x0c, 0x3b, 0x06,
+    0x1f, 0x35, 0x06, 0x05, 0x06, 0x02, 0x0b, 0x02, 0x2b, 0x06, 0x3e, 0x03, 0x05, 0x20, 0x05, 0x03,
+    0x08, 0x3a, 0x04, 0x06, 0x20, 0x25, 0x20, 0x05, 0x40, 0x05, 0x01, 0xe5, 0x45, 0x11, 0x02, 0x65,
+    0x22, 0x45, 0x02, 0x20, 0x22, 0x25, 0x21, 0x65, 0x02, 0x40, 0x25, 0x02, 0x03, 0x11, 0x02, 0x65,
+    0x2b, 0x08, 0x1e, 0x0b, 0x01, 0x02, 0x3e, 0x00, 0x08, 0x3e, 0x08, 0x10, 0x1e, 0x08, 0x10, 0x42,
+    0x1e, 0x0a, 0x30, 0x00, 0xa2, 0x10, 0x1e, 0x15, 0x3a, 0x1e, 0x15, 0x1a, 0x1b, 0x15, 0x0b, 0x10,
+    0x0d, 0x06, 0x10, 0x08, 0x06, 0xb0, 0x26, 0x0d, 0x06, 0x1c, 0x10, 0x06, 0x08, 0x06, 0x1c, 0x17,
+    0x18, 0x19, 0x1d, 0x0d, 0x3b, 0x1d, 0x00, 0x04, 0x0a, 0x1a, 0x1c, 0x05, 0x0b, 0x05, 0x10, 0x02,
+    0x0b, 0x06, 0x1e, 0x0a, 0x1e, 0x08, 0x02, 0x00, 0x25, 0x06, 0x04, 0x0c, 0x18, 0x1b, 0x3e, 0x68,
+    0x43, 0x26, 0x20, 0x23, 0x20, 0x62, 0x00, 0x62, 0x85, 0x02, 0x00, 0x05, 0x01, 0x05, 0x20, 0x62,
+    0xa5, 0x02, 0x05, 0x02, 0x23, 0x02, 0x05, 0x02, 0x03, 0x11, 0x65, 0x2b, 0x11, 0x08, 0x0b, 0x01,
+    0x05, 0x1e, 0x0d, 0x00, 0x3e, 0x04, 0x26, 0x1e, 0x08, 0x0b, 0x42, 0x1e, 0x0a, 0x10, 0x20, 0x02,
+    0x11, 0x00, 0x0b, 0x02, 0x00, 0x02, 0x26, 0x1e, 0x04, 0x15, 0x06, 0x1e, 0x1a, 0x38, 0x57, 0x30,
+    0x0b, 0x08, 0x06, 0x10, 0x02, 0x0b, 0x10, 0x26, 0x1e, 0x06, 0x1e, 0x03, 0x50, 0x06, 0x10, 0x0c,
+    0x18, 0x1d, 0x17, 0x08, 0x1b, 0x1c, 0x17, 0x06, 0x3e, 0x0a, 0x08, 0x06, 0x01, 0x10, 0x0b, 0x10,
+    0x1e, 0x04, 0x1e, 0x06, 0x30, 0x4b, 0x08, 0x0d, 0x2c, 0x1a, 0x66, 0x83, 0x00, 0x26, 0x20, 0x10,
+    0x42, 0x0b, 0x82, 0x00, 0x02, 0x25, 0x02, 0x00, 0x05, 0x01, 0x20, 0x05, 0x01, 0x05, 0x02, 0x00,
+    0x05, 0x30, 0x00, 0x02, 0x25, 0x02, 0x20, 0x02, 0x05, 0x02, 0x23, 0x00, 0x25, 0x11, 0x03, 0x00,
+    0x25, 0x02, 0x05, 0x28, 0x10, 0x05, 0x02, 0x28, 0x30, 0x3e, 0x30, 0x1e, 0x08, 0x0b, 0x00, 0x05,
+    0x02, 0x08, 0x3e, 0x26, 0x42, 0x40, 0x22, 0x05, 0x0b, 0x08, 0x04, 0x15, 0x2d, 0x18, 0x39, 0x38,
+    0x0c, 0x15, 0x5a, 0x1e, 0x2b, 0x30, 0x1e, 0x4d, 0x06, 0x10, 0x02, 0x45, 0x1b, 0x0c, 0x04, 0x10,
+    0x06, 0x04, 0x0d, 0x10, 0x06, 0x0b, 0x02, 0x08, 0x1e, 0x04, 0x06, 0x0b, 0x10, 0x1e, 0x0a, 0x08,
+    0x2b, 0x02, 0x2b, 0x28, 0x1e, 0x11, 0x05, 0xc1, 0x05, 0x63, 0x11, 0x20, 0xe2, 0x00, 0x22, 0x00,
+    0x02, 0x25, 0x42, 0x05, 0x01, 0x05, 0x20, 0x45, 0x02, 0x05, 0x22, 0x60, 0x03, 0x00, 0x02, 0x05,
+    0x02, 0x00, 0x03, 0x00, 0x02, 0x05, 0x22, 0x00, 0x02, 0x05, 0x02, 0x05, 0x10, 0x08, 0x10, 0x05,
+    0x02, 0x28, 0x02, 0x10, 0x1e, 0x0d, 0x30, 0x1e, 0x08, 0x10, 0x05, 0x00, 0x10, 0x00, 0x08, 0x0a,
+    0x1e, 0x06, 0x0b, 0x02, 0x10, 0x00, 0x02, 0x00, 0x62, 0x0b, 0x06, 0x15, 0x1a, 0x1d, 0x0d, 0x79,
+    0x18, 0x1b, 0x1a, 0x0c, 0x1b, 0x15, 0x02, 0x0b, 0x30, 0x0d, 0x06, 0x2d, 0x06, 0x10, 0x02, 0x05,
+    0x2b, 0x15, 0x1a, 0x0d, 0x0b, 0x06, 0x0a, 0x1e, 0x30, 0x05, 0x0b, 0x10, 0x1e, 0x0a, 0x1e, 0x10,
+    0x3e, 0x03, 0x02, 0x0b, 0x45, 0x10, 0x5e, 0x10, 0x05, 0x21, 0x05, 0x01, 0x05, 0x22, 0x43, 0x60,
+    0xe2, 0x20, 0x62, 0x45, 0x22, 0x25, 0x01, 0xa5, 0x62, 0x45, 0x00, 0x02, 0x45, 0x42, 0x65, 0x11,
+    0x00, 0x45, 0x31, 0x02, 0x0b, 0x02, 0x03, 0x06, 0x02, 0x0b, 0x3e, 0x10, 0x0b, 0x3e, 0x0b, 0x02,
+    0x20, 0x05, 0x00, 0x08, 0x3e, 0x08, 0x10, 0x0b, 0x02, 0x00, 0x42, 0x00, 0x05, 0x30, 0x06, 0x1a,
+    0x3b, 0x1d, 0x39, 0x0c, 0x1a, 0x15, 0x2a, 0x15, 0x1e, 0x0b, 0x02, 0x10, 0x02, 0x06, 0x10, 0x3e,
+    0x06, 0x10, 0x00, 0x45, 0x1e, 0x1a, 0x06, 0x0b, 0x03, 0x0a, 0x1e, 0x0b, 0x42, 0x05, 0x10, 0x3e,
+    0x0d, 0x1e, 0x08, 0x02, 0x85, 0x00, 0x08, 0x1e, 0x08, 0x02, 0x25, 0x01, 0x25, 0x00, 0x06, 0x08,
+    0x03, 0x02, 0x05, 0xe1, 0xe1, 0x22, 0x05, 0x01, 0xa5, 0x21, 0x65, 0x42, 0xe5, 0xe5, 0x11, 0x00,
+    0x45, 0x11, 0x03, 0x10, 0x0b, 0x02, 0x08, 0x03, 0x02, 0x0b, 0x3e, 0x10, 0x0b, 0x3e, 0x0b, 0x02,
+    0x85, 0x03, 0x0e, 0x0a, 0x08, 0x2b, 0x00, 0x62, 0x06, 0x0b, 0x50, 0x1a, 0x0c, 0x3b, 0x10, 0x05,
+    0x21, 0x0b, 0x06, 0x22, 0x05, 0x02, 0x00, 0x0b, 0x30, 0x46, 0x20, 0x45, 0x0a, 0x15, 0x06, 0x05,
+    0x03, 0x04, 0x08, 0x05, 0x00, 0x22, 0x0b, 0x06, 0x3e, 0x06, 0x3e, 0x03, 0x05, 0x01, 0x45, 0x0b,
+    0x06, 0x1e, 0x06, 0x05, 0x02, 0x45, 0x06, 0x08, 0x26, 0x02, 0xe1, 0xe1, 0x21, 0x02, 0x25, 0x21,
+    0xc5, 0x01, 0x25, 0x02, 0x25, 0x62, 0xe5, 0x85, 0x00, 0x02, 0x45, 0x0b, 0x28, 0x2b, 0x03, 0x08,
+    0x10, 0x02, 0x26, 0x08, 0x10, 0x28, 0x11, 0x01, 0xa5, 0x02, 0x5e, 0x10, 0x0b, 0x00, 0x02, 0x05,
+    0x10, 0x0b, 0x03, 0x22, 0x30, 0x15, 0x3b, 0x04, 0x06, 0x0b, 0x02, 0x00, 0x01, 0x05, 0x02, 0x0b,
+    0x22, 0x0b, 0x02, 0x70, 0x02, 0x25, 0x02, 0x0b, 0x1e, 0x15, 0x06, 0x05, 0x10, 0x04, 0x0d, 0x0b,
+    0x02, 0x05, 0x02, 0x08, 0x3e, 0x06, 0x10, 0x06, 0x1e, 0x08, 0x02, 0x25, 0x22, 0x05, 0x10, 0x08,
+    0x00, 0x25, 0x01, 0x05, 0x02, 0x03, 0x08, 0x06, 0x10, 0x0b, 0x25, 0x81, 0x45, 0xc1, 0x05, 0x02,
+    0x25, 0xa1, 0x05, 0x00, 0x05, 0x21, 0x65, 0x0b, 0x22, 0xe5, 0xa5, 0x00, 0x02, 0x65, 0x00, 0x23,
+    0x22, 0x03, 0x08, 0x50, 0x88, 0x22, 0x65, 0x0b, 0x05, 0x10, 0x08, 0x0a, 0x1e, 0x10, 0x2b, 0x22,
+    0x0b, 0x22, 0x25, 0x00, 0x06, 0x3e, 0x26, 0x10, 0x45, 0x00, 0x02, 0x0b, 0x22, 0x00, 0x22, 0x06,
+    0x08, 0x06, 0x10, 0x02, 0x00, 0x02, 0x0b, 0x1e, 0x15, 0x06, 0x05, 0x06, 0x04, 0x0d, 0x22, 0x10,
+    0x3e, 0x08, 0x11, 0x0b, 0x30, 0x68, 0x10, 0x02, 0x25, 0x03, 0x08, 0x00, 0x45, 0x02, 0x23, 0x00,
+    0x02, 0x0b, 0x45, 0xe1, 0x81, 0x25, 0x00, 0x10, 0x0b, 0x05, 0x01, 0x25, 0x21, 0xe5, 0x22, 0x65,
+    0x21, 0xe5, 0x45, 0x00, 0x02, 0x25, 0x02, 0x25, 0x02, 0x23, 0x25, 0x23, 0x06, 0x10, 0x08, 0x23,
+    0x08, 0x0e, 0x08, 0x10, 0x22, 0x10, 0x06, 0x28, 0x22, 0x08, 0x3e, 0x02, 0x0b, 0x20, 0x05, 0x22,
+    0x0b, 0x00, 0x05, 0x2b, 0x10, 0x05, 0x21, 0x11, 0x2b, 0x25, 0x0b, 0x22, 0x00, 0x02, 0x0b, 0x1e,
+    0x04, 0x1e, 0x06, 0x42, 0x0b, 0x1e, 0x15, 0x03, 0x05, 0x06, 0x04, 0x0d, 0x0b, 0x08, 0x1e, 0x04,
+    0x1e, 0x0b, 0x01, 0x05, 0x02, 0x05, 0x0b, 0x02, 0x08, 0x0a, 0x1e, 0x11, 0x05, 0x02, 0x23, 0x00,
+    0x05, 0x0b, 0x43, 0x02, 0x05, 0x21, 0x25, 0xe1, 0x41, 0x45, 0x02, 0x00, 0x03, 0x10, 0x0b, 0x21,
+    0x25, 0x21, 0x05, 0x01, 0x45, 0x41, 0xe5, 0xe5, 0x02, 0x25, 0x00, 0x02, 0x25, 0x02, 0x65, 0x00,
+    0x03, 0x00, 0x01, 0x11, 0x08, 0x06, 0x2b, 0x48, 0x5e, 0x0d, 0x3e, 0x04, 0x0a, 0x03, 0x02, 0x05,
+    0x03, 0x3e, 0x06, 0x0b, 0x01, 0x00, 0x02, 0x2b, 0x05, 0x2b, 0x05, 0x01, 0x05, 0x03, 0x05, 0x0b,
+    0x02, 0x0b, 0x22, 0x11, 0x02, 0x0b, 0x42, 0x1e, 0x15, 0x0a, 0x06, 0x0b, 0x22, 0x0b, 0x1e, 0x15,
+    0x00, 0x01, 0x10, 0x04, 0x0d, 0x02, 0x1e, 0x24, 0x06, 0xc5, 0x10, 0x3e, 0x03, 0x05, 0x28, 0x02,
+    0x25, 0x02, 0x08, 0x03, 0x0b, 0x61, 0x45, 0xe1, 0x21, 0x45, 0x0b, 0x30, 0x02, 0x0b, 0x25, 0x21,
+    0xe5, 0x02, 0x00, 0x05, 0x01, 0x05, 0x60, 0x02, 0x03, 0x00, 0x02, 0xe5, 0x22, 0xa5, 0x01, 0x05,
+    0x23, 0x00, 0x01, 0x02, 0x23, 0x02, 0x0b, 0x88, 0x23, 0x28, 0x1e, 0x11, 0x00, 0x05, 0x01, 0x00,
+    0x3e, 0x06, 0x02, 0x0b, 0x05, 0x4b, 0x05, 0x0b, 0x05, 0x22, 0x2b, 0x25, 0x62, 0x45, 0x22, 0x06,
+    0x15, 0x1e, 0x10, 0x0b, 0x00, 0x05, 0x03, 0x1e, 0x15, 0x1e, 0x05, 0x02, 0x0e, 0x1e, 0x10, 0x06,
+    0x28, 0x00, 0x21, 0x05, 0x01, 0x25, 0x0b, 0x02, 0x03, 0x48, 0x03, 0x25, 0x02, 0x11, 0x10, 0x02,
+    0x05, 0x61, 0x65, 0x81, 0x45, 0x02, 0xc5, 0x22, 0x05, 0x21, 0x25, 0x01, 0xa5, 0x42, 0xa5, 0x02,
+    0x00, 0xe5, 0x25, 0x22, 0x85, 0x00, 0x05, 0x01, 0x05, 0x00, 0x23, 0x25, 0x03, 0x08, 0x10, 0x0b,
+    0x10, 0x28, 0x00, 0x21, 0x02, 0x23, 0x85, 0x00, 0x08, 0x1e, 0x08, 0x10, 0x8b, 0x82, 0x0b, 0x45,
+    0x42, 0x45, 0x0b, 0x02, 0x10, 0x0a, 0x06, 0x22, 0x00, 0x02, 0x08, 0x35, 0x0a, 0x00, 0x05, 0x02,
+    0x08, 0x0a, 0x06, 0x10, 0x0b, 0x45, 0x02, 0x00, 0x25, 0x2b, 0x02, 0x43, 0x25, 0x0b, 0x10, 0x11,
+    0x02, 0x05, 0x81, 0x65, 0x41, 0x85, 0x40, 0x42, 0xa5, 0x21, 0x85, 0x21, 0x45, 0x11, 0x0b, 0x25,
+    0x21, 0xe5, 0x05, 0x01, 0x45, 0x22, 0xe5, 0x05, 0x0b, 0x11, 0x03, 0x00, 0x0b, 0x02, 0x23, 0x10,
+    0x0b, 0x06, 0x23, 0x00, 0x21, 0x05, 0x0b, 0x22, 0x65, 0x02, 0x08, 0x3e, 0x08, 0x86, 0x08, 0x22,
+    0x00, 0x0b, 0x05, 0x02, 0x05, 0x0b, 0x62, 0x6b, 0x0a, 0x00, 0x22, 0x25, 0x03, 0x3e, 0x08, 0x00,
+    0x25, 0x02, 0x08, 0x1e, 0x08, 0x30, 0x68, 0x02, 0x25, 0x02, 0x23, 0x00, 0x05, 0x0b, 0x02, 0x10,
+    0x11, 0x00, 0x05, 0xa1, 0x65, 0x61, 0xe5, 0x65, 0x41, 0x00, 0x05, 0x21, 0x65, 0x21, 0x45, 0x02,
+    0x0b, 0x02, 0x05, 0xe1, 0x61, 0x05, 0x21, 0x00, 0x05, 0x01, 0x45, 0x21, 0x05, 0x02, 0x45, 0x02,
+    0x23, 0x0b, 0x05, 0x10, 0x03, 0x11, 0x0b, 0x02, 0x43, 0x02, 0x05, 0x22, 0xa5, 0x0b, 0x08, 0xfe,
+    0x10, 0x22, 0x0b, 0x05, 0x02, 0x05, 0x2b, 0x02, 0x8b, 0x05, 0x0a, 0x00, 0x05, 0x02, 0x05, 0x01,
+    0x05, 0x10, 0x00, 0x85, 0x01, 0x00, 0x48, 0x3e, 0x0a, 0x1e, 0x11, 0x05, 0x02, 0x03, 0x08, 0x00,
+    0x05, 0x02, 0x28, 0x03, 0x02, 0x25, 0x61, 0xa5, 0x81, 0x45, 0x41, 0x85, 0x00, 0x41, 0x45, 0x01,
+    0x25, 0xa1, 0x25, 0x20, 0xe1, 0x61, 0x05, 0x01, 0x05, 0x00, 0x05, 0x01, 0x25, 0x61, 0x65, 0x0b,
+    0x02, 0x11, 0x03, 0x02, 0x05, 0x02, 0x28, 0x0b, 0x05, 0x10, 0x08, 0x03, 0x02, 0x0b, 0xe5, 0x0b,
+    0x10, 0x03, 0x26, 0x08, 0x3e, 0x08, 0x02, 0x0b, 0x02, 0x25, 0x02, 0x25, 0x02, 0x05, 0x8b, 0x05,
+    0x0e, 0x03, 0xa5, 0x02, 0xa5, 0x01, 0x05, 0x02, 0x2b, 0x11, 0x28, 0x30, 0x28, 0x02, 0x25, 0x03,
+    0x28, 0x00, 0x05, 0x61, 0xe5, 0xa5, 0x21, 0x45, 0x81, 0x05, 0x00, 0x05, 0x21, 0x00, 0x05, 0x81,
+    0xa5, 0x02, 0x00, 0xe1, 0x61, 0x45, 0x00, 0x05, 0x01, 0x25, 0xa1, 0x65, 0x0b, 0x23, 0x02, 0x05,
+    0x02, 0x08, 0x03, 0x02, 0x0b, 0x02, 0x03, 0x11, 0x2b, 0x22, 0x25, 0x22, 0x05, 0x01, 0x65, 0x02,
+    0x00, 0x30, 0x0b, 0x02, 0x00, 0x42, 0x65, 0xab, 0x08, 0x03, 0x0b, 0xe5, 0x05, 0x01, 0x05, 0x00,
+    0x05, 0x41, 0x45, 0x02, 0x06, 0x28, 0x0b, 0x05, 0x0b, 0x11, 0x08, 0x20, 0x05, 0x21, 0x25, 0x01,
+    0xe5, 0xa5, 0x21, 0x65, 0x81, 0x05, 0x00, 0x05, 0x21, 0x65, 0x41, 0x85, 0x0b, 0x02, 0xe1, 0x61,
+    0x05, 0x01, 0x05, 0x00, 0x05, 0x01, 0x25, 0x81, 0xa5, 0x0b, 0x11, 0x03, 0x02, 0x25, 0x10, 0x03,
+    0x20, 0x03, 0x28, 0x22, 0x0b, 0x02, 0x06, 0x28, 0x03, 0xa5, 0x0b, 0x42, 0x00, 0x62, 0x65, 0x4b,
+    0x25, 0x02, 0x03, 0x08, 0x11, 0x0b, 0xe5, 0x25, 0x02, 0x05, 0x21, 0x45, 0x02, 0x03, 0x08, 0x10,
+    0x0b, 0x05, 0x0b, 0x03, 0x11, 0x10, 0x05, 0x61, 0xe5, 0xe5, 0x45, 0xc1, 0x05, 0x41, 0x25, 0x21,
+    0x45, 0x81, 0xa5, 0xe1, 0x41, 0x05, 0x21, 0x25, 0x61, 0xa5, 0x0b, 0x65, 0x0b, 0x11, 0x03, 0x11,
+    0x01, 0x05, 0x40, 0x25, 0x00, 0x08, 0x43, 0x68, 0x45, 0x00, 0x02, 0x2b, 0x22, 0x20, 0xe5, 0x42,
+    0x25, 0x02, 0x05, 0x28, 0x10, 0x02, 0xc5, 0x4b, 0x05, 0x0b, 0x45, 0x02, 0x03, 0x08, 0x06, 0x45,
+    0x23, 0x0b, 0x05, 0xa1, 0x05, 0x0b, 0xe5, 0xe5, 0x25, 0xa1, 0x25, 0x01, 0x65, 0x21, 0x25, 0x21,
+    0x25, 0x01, 0x65, 0xe1, 0x61, 0x05, 0x21, 0x45, 0x01, 0x25, 0x02, 0x20, 0x2b, 0x02, 0x03, 0x11,
+    0x25, 0x02, 0x11, 0x02, 0x20, 0x03, 0x05, 0x01, 0x00, 0x03, 0x10, 0x85, 0x2b, 0x10, 0x03, 0x00,
+    0x25, 0x22, 0x2b, 0x02, 0x25, 0x22, 0x45, 0x8b, 0x02, 0x03, 0x08, 0x03, 0x0b, 0x21, 0x05, 0x03,
+    0x08, 0x03, 0x02, 0x85, 0x02, 0x06, 0x08, 0x06, 0x22, 0x0b, 0x02, 0x06, 0x03, 0x08, 0x10, 0x05,
+    0x0b, 0x62, 0x05, 0xa1, 0xe5, 0xe5, 0x45, 0xe1, 0x25, 0x21, 0xe5, 0x45, 0x01, 0x65, 0xe1, 0xa1,
+    0x45, 0x21, 0x25, 0x02, 0x20, 0x0b, 0x05, 0x02, 0x11, 0x00, 0x25, 0x00, 0x11, 0x02, 0x25, 0x40,
+    0x05, 0x02, 0x03, 0x11, 0x02, 0x25, 0x0b, 0x02, 0x0b, 0x02, 0x00, 0x02, 0x05, 0x00, 0x28, 0x43,
+    0x11, 0x30, 0x03, 0x10, 0x20, 0x30, 0x03, 0x02, 0x05, 0x0b, 0x08, 0x0e, 0x08, 0x0b, 0x01, 0x25,
+    0x0b, 0x00, 0x23, 0x65, 0x0b, 0x11, 0x08, 0x1e, 0x48, 0x43, 0x10, 0x2b, 0x62, 0x0b, 0x25, 0xa1,
+    0xe5, 0x45, 0xe1, 0xe1, 0x01, 0xe5, 0x85, 0x21, 0x65, 0xe1, 0xa1, 0x45, 0x21, 0x05, 0x01, 0x05,
+    0x00, 0x02, 0x45, 0x02, 0x65, 0x00, 0x02, 0x05, 0x01, 0x05, 0x20, 0x25, 0x00, 0x03, 0x11, 0x45,
+    0x02, 0x85, 0x00, 0x28, 0x63, 0x48, 0xe3, 0x02, 0x00, 0x43, 0x00, 0x45, 0x0b, 0x02, 0x23, 0x65,
+    0x02, 0x03, 0x08, 0x11, 0x4b, 0x02, 0x4b, 0x11, 0x03, 0x11, 0x02, 0x0b, 0x25, 0xa1, 0x65, 0xe1,
+    0xe1, 0xe1, 0x21, 0x65, 0x21, 0xe5, 0x65, 0xe1, 0x81, 0x45, 0x81, 0x45, 0x21, 0x05, 0x02, 0x05,
+    0x21, 0x05, 0x22, 0x05, 0x21, 0x05, 0x00, 0x45, 0x02, 0x11, 0x00, 0x65, 0x21, 0x05, 0x01, 0x05,
+    0x02, 0x20, 0x02, 0x25, 0x4b, 0xa5, 0x03, 0x08, 0x03, 0x25, 0x02, 0x03, 0x08, 0x00, 0x0b, 0x22,
+    0x25, 0x23, 0x00, 0x0b, 0x25, 0x6b, 0x85, 0x02, 0x08, 0x03, 0x11, 0x25, 0xe1, 0x65, 0xe1, 0xe1,
+    0xe1, 0x21, 0x65, 0x41, 0x25, 0x21, 0xc5, 0xe1, 0x21, 0x85, 0xa1, 0x05, 0x00, 0x45, 0x02, 0x20,
+    0x05, 0x01, 0x05, 0x02, 0x25, 0x21, 0x05, 0x20, 0x05, 0x01, 0x05, 0x02, 0x03, 0x02, 0xa5, 0x01,
+    0x05, 0x2b, 0x65, 0x0b, 0x45, 0x81, 0x05, 0x02, 0x03, 0x00, 0x45, 0x11, 0x43, 0x00, 0x02, 0x25,
+    0x23, 0x06, 0x02, 0xe5, 0x05, 0x02, 0x11, 0x03, 0x02, 0x25, 0xe1, 0x21, 0x05, 0xe1, 0xe1, 0xe1,
+    0x21, 0x05, 0x41, 0x25, 0x41, 0x25, 0x41, 0xa5, 0xe1, 0xa5, 0xc1, 0x05, 0x00, 0x45, 0x02, 0x03,
+    0x00, 0x05, 0x01, 0x20, 0x05, 0x41, 0x05, 0x11, 0x02, 0x21, 0x05, 0x0b, 0x11, 0x0b, 0xa5, 0x01,
+    0x02, 0x23, 0x10, 0x22, 0x03, 0x10, 0x00, 0x02, 0x05, 0x00, 0x45, 0x02, 0x25, 0x00, 0x23, 0x02,
+    0x25, 0x22, 0x0b, 0x00, 0x03, 0x00, 0x25, 0x02, 0x20, 0x02, 0x25, 0x00, 0x05, 0x62, 0x20, 0x25,
+    0xe1, 0xc1, 0x25, 0xe1, 0xe1, 0xa1, 0x05, 0x41, 0x45, 0x21, 0x45, 0x21, 0x45, 0x01, 0x25, 0xe1,
+    0x85, 0xe1, 0x85, 0x02, 0x00, 0x05, 0x21, 0x05, 0x00, 0x0b, 0x05, 0x21, 0x02, 0x11, 0x0b, 0x41,
+    0x05, 0x11, 0x0b, 0xa5, 0x01, 0x00, 0x28, 0x03, 0x00, 0x10, 0x1e, 0x28, 0xc3, 0x00, 0x42, 0x40,
+    0x25, 0x21, 0x05, 0x02, 0x00, 0x03, 0x25, 0x02, 0xe0, 0x03, 0x00, 0x02, 0xe1, 0xe1, 0x21, 0x65,
+    0xe1, 0xe1, 0xe1, 0x45, 0x41, 0x25, 0x21, 0x45, 0x21, 0x45, 0xe1, 0x01, 0x25, 0xa1, 0x05, 0x01,
+    0xa5, 0x00, 0x0b, 0x45, 0x22, 0x05, 0x21, 0x0b, 0x10, 0x02, 0x41, 0x02, 0x08, 0x0b, 0xa5, 0x01,
+    0x42, 0x10, 0x2b, 0x26, 0x10, 0x02, 0x8b, 0x02, 0x23, 0x02, 0x25, 0x22, 0x65, 0x21, 0x0b, 0x03,
+    0x11, 0x02, 0x85, 0x01, 0x05, 0x21, 0x25, 0xe1, 0xe1, 0x41, 0xa5, 0xe1, 0xe1, 0xa1, 0x45, 0x21,
+    0x45, 0x21, 0x25, 0x61, 0x45, 0xe1, 0xe1, 0x41, 0x00, 0x05, 0x41, 0x00, 0x41, 0x05, 0x02, 0x05,
+    0x41, 0x0b, 0x10, 0x0b, 0x41, 0x05, 0x11, 0x05, 0x01, 0x05, 0x21, 0x25, 0x21, 0xa5, 0x6b, 0xa5,
+    0x0b, 0x03, 0x11, 0x45, 0x03, 0x00, 0x65, 0x21, 0x11, 0x10, 0x02, 0x81, 0x45, 0xe1, 0xc1, 0x05,
+    0xe1, 0xe1, 0xe1, 0xe1, 0x01, 0x45, 0x21, 0x45, 0x21, 0x45, 0x81, 0x25, 0x81, 0x05, 0xe1, 0x61,
+    0x00, 0x05, 0x41, 0x00, 0x05, 0x21, 0x05, 0x02, 0x05, 0x41, 0x02, 0x11, 0x02, 0x41, 0x05, 0x03,
+    0x45, 0x21, 0x05, 0x21, 0x05, 0x20, 0x02, 0x2b, 0xc2, 0x25, 0x22, 0x25, 0x02, 0x03, 0x00, 0x05,
+    0x0b, 0x11, 0x00, 0x05, 0x01, 0x25, 0x01, 0x05, 0x02, 0x03, 0x00, 0x45, 0x01, 0x25, 0xe1, 0xe1,
+    0x25, 0xe1, 0xe1, 0xe1, 0xe1, 0x45, 0x21, 0x45, 0x21, 0x25, 0xa1, 0x65, 0xe1, 0xe1, 0x00, 0x05,
+    0x41, 0x00, 0x05, 0x21, 0x05, 0x02, 0x05, 0x41, 0x0b, 0x11, 0x02, 0x41, 0x02, 0x03, 0x0b, 0x25,
+    0x61, 0x25, 0x11, 0x03, 0x11, 0x22, 0x11, 0x20, 0x63, 0x11, 0x00, 0x02, 0x00, 0x02, 0x25, 0x20,
+    0x02, 0x05, 0x02, 0x20, 0x05, 0x21, 0x05, 0x01, 0x05, 0x20, 0x02, 0x85, 0x01, 0x05, 0x01, 0x05,
+    0xe1, 0x61, 0x25, 0xe1, 0xe1, 0xe1, 0xe1, 0x45, 0x21, 0x45, 0x21, 0x25, 0x21, 0x05, 0x81, 0x45,
+    0x61, 0x05, 0xe1, 0x21, 0x25, 0x41, 0x00, 0x65, 0x22, 0x05, 0x01, 0x05, 0x0b, 0x11, 0x02, 0x05,
+    0x01, 0x02, 0x23, 0x02, 0x25, 0x81, 0x05, 0x02, 0x00, 0x02, 0x25, 0x0b, 0x21, 0xc5, 0x00, 0x03,
+    0x00, 0x25, 0x02, 0x03, 0x02, 0x25, 0x22, 0x05, 0x01, 0x05, 0x01, 0x25, 0x0b, 0x02, 0x11, 0x02,
+    0x05, 0x61, 0x05, 0xe1, 0x81, 0x25, 0xe1, 0xe1, 0xe1, 0xe1, 0x45, 0x21, 0x45, 0x21, 0x25, 0xe1,
+    0x85, 0xe1, 0xa1, 0x05, 0x41, 0x85, 0x22, 0x45, 0x02, 0x11, 0x02, 0x25, 0x0b, 0x00, 0x11, 0x02,
+    0x05, 0xe1, 0xe1, 0x45, 0x2b, 0x02, 0x05, 0x02, 0x00, 0x02, 0x25, 0x00, 0x03, 0x02, 0x05, 0x01,
+    0x02, 0x03, 0x00, 0x41, 0x05, 0x02, 0x31, 0x02, 0x65, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0x01,
+    0x45, 0x21, 0x45, 0x21, 0x45, 0x21, 0x45, 0x61, 0x65, 0xe1, 0x81, 0x25, 0x41, 0x22, 0x45, 0x02,
+    0xe5, 0x65, 0x21, 0x85, 0xe1, 0x41, 0x45, 0x0b, 0x02, 0x45, 0x02, 0x00, 0xe5, 0x02, 0x00, 0x41,
+    0x05, 0x62, 0x00, 0x02, 0x45, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xc1, 0x45, 0x21, 0x45, 0x21, 0x25,
+    0x21, 0x25, 0x00, 0x05, 0x61, 0x65, 0xe1, 0x81, 0x25, 0x01, 0x05, 0x01, 0xe5, 0x05, 0x41, 0x25,
+    0x21, 0x25, 0x21, 0x25, 0x01, 0x25, 0xe1, 0x41, 0xe5, 0x05, 0x02, 0x00, 0x45, 0x02, 0x00, 0x45,
+    0x03, 0x25, 0x61, 0x05, 0x02, 0x20, 0x02, 0x0b, 0x25, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xa1, 0x45,
+    0x21, 0x45, 0x21, 0x25, 0x41, 0x85, 0x00, 0x05, 0x21, 0x65, 0xe1, 0x41, 0x85, 0x01, 0xe5, 0x05,
+    0x41, 0x05, 0x41, 0x05, 0x21, 0x25, 0x01, 0x05, 0x21, 0x05, 0x41, 0x25, 0x21, 0xe5, 0x65, 0x02,
+    0x00, 0x45, 0x02, 0x00, 0x11, 0x02, 0x05, 0x02, 0x25, 0x61, 0x05, 0x8b, 0x25, 0xe1, 0xe1, 0xe1,
+    0xe1, 0xe1, 0x01,
+};
@@ -0,0 +1,47 @@
+/*--------------------------------------------------------------------------------
+UDP sample stream
+
+Lightweight alternative to the WebSocket for bench use: samples are sent in
+batches as UDP datagrams to UDP_STREAM_HOST:UDP_STREAM_PORT. A datagram is
+sent once UDP_STREAM_BATCH samples are collected or the oldest one is
+UDP_STREAM_MAX_DELAY ms old, loop() polls for the latter between samples. Layout, little endian:
+
+  char     magic[2]          "PL"
+  uint8_t  version           1
+  uint8_t  count             samples in this datagram
+  uint16_t session           incremented with every new measurement
+  uint32_t datagram          datagram counter since boot
+  count x sample:
+    uint32_t seq             sample index, restarts at 0 each session
+    uint32_t time_us         low 32 bits of the sample timebase (us)
+    uint8_t  channel_mask    bit 0..2 for channel 1..3
+    per enabled channel: float V, mA, mWh, mAh
+
+tools/udp_stream.cpp receives the stream (gap/reorder statistics, CSV log) and
+can simulate a logger on loopback.
+--------------------------------------------------------------------------------*/
+
+#ifndef UDP_STREAM_H
+#define UDP_STREAM_H
+
+#include <Arduino.h>
+#include "log_sample.h"
+
+#ifndef UDP_STREAM_HOST
+#define UDP_STREAM_HOST "" // no receiver, streaming is disabled
+#endif
+#ifndef UDP_STREAM_PORT
+#define UDP_STREAM_PORT 5005
+#endif
+
+#define UDP_STREAM_VERSION 1
+#define UDP_STREAM_BATCH 16     // samples per datagram, at most 24 fit into 1400 bytes
+#define UDP_STREAM_MAX_DELAY 50 // ms a sample may wait for its datagram
+
+void udp_stream_begin();                     // call once WiFi is connected
+void udp_stream_sample(const log_sample &sample); // does nothing while disabled
+long udp_stream_poll();                      // sends a batch that is due, returns ms until the next is due, -1 if none
+void udp_stream_flush();                     // sends the partial batch, at the end of a measurement
+uint32_t udp_stream_errors();                // datagrams the network stack refused
+
+#endif
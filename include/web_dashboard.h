@@ -0,0 +1,57 @@
+// Dashboard page served at /, see web_server.h for the frame layout
+
+#include <pgmspace.h>
+
+const char web_dashboard_html[] PROGMEM = R"rawliteral(<!DOCTYPE html>
+<html><head><meta charset="utf-8"><meta name="viewport" content="width=device-width">
+<title>PowerLogger</title>
+<style>
+body{font-family:sans-serif;background:#0b1526;color:#eee;margin:1em}
+table{border-collapse:collapse;margin-bottom:1em}td,th{padding:4px 12px;text-align:right}
+th{color:#8ab}canvas{width:100%;height:260px;background:#112}
+.c1{color:#ff0}.c2{color:#0ff}.c3{color:#f0f}
+</style></head><body>
+<h2>PowerLogger</h2><p id="st">connecting ...</p>
+<table id="tab"><tr><th>CH</th><th>V</th><th>mA</th><th>mW</th><th>mWh</th><th>mAh</th></tr></table>
+<canvas id="plot" width="800" height="260"></canvas>
+<h3>Log files</h3><ul id="files"></ul>
+<script>
+const N = 600, colors = ['#ff0', '#0ff', '#f0f'], hist = [[], [], []];
+const tab = document.getElementById('tab'), st = document.getElementById('st');
+const rows = [1, 2, 3].map(ch => { const r = tab.insertRow(); r.className = 'c' + ch; r.insertCell().textContent = ch;
+  for (let i = 0; i < 5; i++) r.insertCell().textContent = '-'; return r; });
+function draw() {
+  const c = document.getElementById('plot'), g = c.getContext('2d');
+  g.clearRect(0, 0, c.width, c.height);
+  let max = 1;
+  hist.forEach(h => h.forEach(v => max = Math.max(max, Math.abs(v))));
+  hist.forEach((h, ch) => { g.strokeStyle = colors[ch]; g.beginPath();
+    h.forEach((v, i) => g.lineTo(i * c.width / N, c.height - 5 - v / max * (c.height - 10))); g.stroke(); });
+  g.fillStyle = '#8ab'; g.fillText(max.toFixed(2) + ' mA', 4, 12);
+}
+function connect() {
+  const ws = new WebSocket('ws://' + location.hostname + ':81/');
+  ws.binaryType = 'arraybuffer';
+  ws.onopen = () => st.textContent = 'live';
+  ws.onclose = () => { st.textContent = 'disconnected, retrying ...'; setTimeout(connect, 2000); };
+  ws.onmessage = e => {
+    const d = new DataView(e.data), mask = d.getUint8(1), count = d.getUint16(2, true);
+    let o = 4, last = null;
+    for (let s = 0; s < count; s++) {
+      o += 8; last = [];
+      for (let ch = 0; ch < 3; ch++) {
+        if (!(mask & (1 << ch))) continue;
+        const v = []; for (let i = 0; i < 5; i++, o += 4) v.push(d.getFloat32(o, true));
+        last[ch] = v; hist[ch].push(v[1]); if (hist[ch].length > N) hist[ch].shift();
+      }
+    }
+    if (last) last.forEach((v, ch) => { if (v) v.forEach((x, i) => rows[ch].cells[i + 1].textContent = x.toFixed(2)); });
+    draw();
+  };
+}
+connect();
+fetch('/files').then(r => r.json()).then(list => list.forEach(f => {
+  const li = document.createElement('li'), a = document.createElement('a');
+  a.href = '/files/' + encodeURIComponent(f.name); a.textContent = f.name + ' (' + f.size + ' bytes)';
+  li.appendChild(a); document.getElementById('files').appendChild(li); })).catch(() => {});
+</script></body></html>)rawliteral";
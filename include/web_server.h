@@ -0,0 +1,31 @@
+/*--------------------------------------------------------------------------------
+Web dashboard
+
+HTTP server on port 80 (dashboard page at /) and WebSocket server on port 81,
+announced as powerlogger.local. Both run in their own task at a lower
+priority than loop(), samples reach the task through a queue.
+
+Every WebSocket binary frame carries a batch of samples, little endian:
+  uint8_t  version (1)
+  uint8_t  channel_mask      bit 0..2 for channel 1..3
+  uint16_t count             samples in this frame
+  per sample:
+    uint32_t seq
+    uint32_t time_ms         millis() of the sample
+    per enabled channel: float V, mA, mW, mWh, mAh
+--------------------------------------------------------------------------------*/
+
+#ifndef WEB_SERVER_H
+#define WEB_SERVER_H
+
+#include <Arduino.h>
+#include "log_sample.h"
+
+#define WEB_HOSTNAME "powerlogger"
+#define WEB_HTTP_PORT 80
+#define WEB_WS_PORT 81
+
+void web_begin();                           // call once WiFi is connected
+void web_publish(const log_sample &sample); // never blocks, drops the sample if the web task is behind
+
+#endif
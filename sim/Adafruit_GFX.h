@@ -0,0 +1,54 @@
+// Adafruit GFX for the native build (see sim.h): nothing is drawn, the traffic is counted (sim_tft_read())
+#ifndef ADAFRUIT_GFX_H
+#define ADAFRUIT_GFX_H
+
+#include <Arduino.h>
+
+class Adafruit_GFX : public Print
+{
+public:
+  Adafruit_GFX(int16_t w, int16_t h) : raw_width(w), raw_height(h), screen_width(w), screen_height(h) {}
+  using Print::write;
+  size_t write(uint8_t c) override;
+  void drawPixel(int16_t x, int16_t y, uint16_t color) { fillRect(x, y, 1, 1, color); }
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  void fillScreen(uint16_t color) { fillRect(0, 0, screen_width, screen_height, color); }
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) { fillRect(x, y, w, 1, color); }
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) { fillRect(x, y, 1, h, color); }
+  void drawRGBBitmap(int16_t x, int16_t y, const uint16_t *bitmap, int16_t w, int16_t h) { fillRect(x, y, w, h, 0); }
+  void setCursor(int16_t x, int16_t y)
+  {
+    cursor_x = x;
+    cursor_y = y;
+  }
+  int16_t getCursorX() const { return cursor_x; }
+  int16_t getCursorY() const { return cursor_y; }
+  void setTextSize(uint8_t size) { text_size = size > 0 ? size : 1; }
+  void setTextColor(uint16_t color) {}
+  void setTextColor(uint16_t color, uint16_t background) {}
+  void setTextWrap(bool wrap) { text_wrap = wrap; }
+  void setRotation(uint8_t rotation);
+  int16_t width() const { return screen_width; }
+  int16_t height() const { return screen_height; }
+
+protected:
+  int16_t raw_width, raw_height;
+  int16_t screen_width, screen_height;
+  int16_t cursor_x = 0, cursor_y = 0;
+  uint8_t text_size = 1;
+  bool text_wrap = true;
+};
+
+class Adafruit_SPITFT : public Adafruit_GFX
+{
+public:
+  Adafruit_SPITFT(int16_t w, int16_t h) : Adafruit_GFX(w, h) {}
+  void startWrite() {}
+  void endWrite() {}
+  void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+  void writePixels(uint16_t *colors, uint32_t len, bool block = true, bool big_endian = false);
+  void enableDisplay(bool enable) {}
+  void enableSleep(bool enable);
+};
+
+#endif
@@ -0,0 +1,18 @@
+// ST7735 for the native build (see sim.h)
+#ifndef ADAFRUIT_ST7735_H
+#define ADAFRUIT_ST7735_H
+
+#include <Adafruit_GFX.h>
+
+#define INITR_GREENTAB 0x00
+#define INITR_REDTAB 0x01
+#define INITR_BLACKTAB 0x02
+
+class Adafruit_ST7735 : public Adafruit_SPITFT
+{
+public:
+  Adafruit_ST7735(int8_t cs, int8_t dc, int8_t rst) : Adafruit_SPITFT(128, 160) {}
+  void initR(uint8_t options = INITR_GREENTAB) {}
+};
+
+#endif
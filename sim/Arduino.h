@@ -0,0 +1,264 @@
+// Arduino core for the native build (see sim.h): the subset the firmware uses
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+#include <math.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <time.h>
+#include <string>
+#include "pgmspace.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+
+#define ICACHE_RAM_ATTR
+#define IRAM_ATTR
+
+#define LOW 0
+#define HIGH 1
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+
+#define DEC 10
+#define HEX 16
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+
+void pinMode(uint8_t pin, uint8_t mode);
+int digitalRead(uint8_t pin);
+void digitalWrite(uint8_t pin, uint8_t value);
+uint16_t analogRead(uint8_t pin);
+void analogWrite(uint8_t pin, int value);
+#define digitalPinToInterrupt(p) (p)
+void attachInterrupt(uint8_t pin, void (*handler)(void), int mode);
+void detachInterrupt(uint8_t pin);
+
+bool setCpuFrequencyMhz(uint32_t mhz);
+uint32_t getCpuFrequencyMhz();
+
+// ----- String ----- //
+class String
+{
+public:
+  String(const char *text = "") : s(text ? text : "") {}
+  String(const std::string &text) : s(text) {}
+  explicit String(char c) : s(1, c) {}
+  explicit String(int value, unsigned char base = 10) : s(format_int(value, base)) {}
+  explicit String(unsigned int value, unsigned char base = 10) : s(format_int(value, base)) {}
+  explicit String(long value, unsigned char base = 10) : s(format_int(value, base)) {}
+  explicit String(unsigned long value, unsigned char base = 10) : s(format_int(value, base)) {}
+  explicit String(float value, unsigned int decimals = 2) : s(format_float(value, decimals)) {}
+  explicit String(double value, unsigned int decimals = 2) : s(format_float(value, decimals)) {}
+
+  const char *c_str() const { return s.c_str(); }
+  unsigned int length() const { return s.size(); }
+  char operator[](unsigned int i) const { return i < s.size() ? s[i] : 0; }
+  char charAt(unsigned int i) const { return (*this)[i]; }
+  bool operator==(const String &other) const { return s == other.s; }
+  bool operator==(const char *other) const { return s == other; }
+  bool operator!=(const String &other) const { return s != other.s; }
+  bool operator!=(const char *other) const { return s != other; }
+  bool equals(const String &other) const { return s == other.s; }
+  String &operator+=(const String &other) { s += other.s; return *this; }
+  String &operator+=(const char *other) { s += other; return *this; }
+  String &operator+=(char c) { s += c; return *this; }
+  bool concat(const String &other) { s += other.s; return true; }
+  friend String operator+(const String &a, const String &b) { return String(a.s + b.s); }
+  friend String operator+(const String &a, const char *b) { return String(a.s + b); }
+  friend String operator+(const char *a, const String &b) { return String(a + b.s); }
+  bool startsWith(const String &prefix) const { return s.compare(0, prefix.s.size(), prefix.s) == 0; }
+  bool endsWith(const String &suffix) const
+  {
+    return s.size() >= suffix.s.size() && s.compare(s.size() - suffix.s.size(), suffix.s.size(), suffix.s) == 0;
+  }
+  int indexOf(char c, unsigned int from = 0) const { return to_index(s.find(c, from)); }
+  int indexOf(const String &text, unsigned int from = 0) const { return to_index(s.find(text.s, from)); }
+  int lastIndexOf(char c) const { return to_index(s.rfind(c)); }
+  String substring(unsigned int from) const { return from < s.size() ? String(s.substr(from)) : String(); }
+  String substring(unsigned int from, unsigned int to) const
+  {
+    return from < s.size() && to > from ? String(s.substr(from, to - from)) : String();
+  }
+  long toInt() const { return strtol(s.c_str(), NULL, 10); }
+  float toFloat() const { return strtof(s.c_str(), NULL); }
+  void trim()
+  {
+    size_t first = s.find_first_not_of(" \t\r\n");
+    size_t last = s.find_last_not_of(" \t\r\n");
+    s = first == std::string::npos ? std::string() : s.substr(first, last - first + 1);
+  }
+
+private:
+  static int to_index(size_t pos) { return pos == std::string::npos ? -1 : (int)pos; }
+  static std::string format_int(long long value, unsigned char base)
+  {
+    char text[24];
+    snprintf(text, sizeof(text), base == 16 ? "%llx" : "%lld", value);
+    return text;
+  }
+  static std::string format_float(double value, unsigned int decimals)
+  {
+    char text[48];
+    snprintf(text, sizeof(text), "%.*f", (int)decimals, value);
+    return text;
+  }
+  std::string s;
+};
+
+// ----- Print and Stream ----- //
+class Print;
+
+class Printable
+{
+public:
+  virtual ~Printable() {}
+  virtual size_t printTo(Print &p) const = 0;
+};
+
+class Print
+{
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size)
+  {
+    size_t n = 0;
+    while (size--)
+    {
+      n += write(*buffer++);
+    }
+    return n;
+  }
+  size_t write(const char *text) { return write((const uint8_t *)text, strlen(text)); }
+  size_t write(const char *buffer, size_t size) { return write((const uint8_t *)buffer, size); }
+
+  size_t print(const char *text) { return write(text); }
+  size_t print(const String &text) { return write(text.c_str()); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(unsigned char value, int base = DEC) { return print((unsigned long)value, base); }
+  size_t print(int value, int base = DEC) { return print((long)value, base); }
+  size_t print(unsigned int value, int base = DEC) { return print((unsigned long)value, base); }
+  size_t print(long value, int base = DEC) { return printf(base == HEX ? "%lx" : "%ld", value); }
+  size_t print(unsigned long value, int base = DEC) { return printf(base == HEX ? "%lx" : "%lu", value); }
+  size_t print(long long value, int base = DEC) { return printf(base == HEX ? "%llx" : "%lld", value); }
+  size_t print(unsigned long long value, int base = DEC) { return printf(base == HEX ? "%llx" : "%llu", value); }
+  size_t print(double value, int digits = 2) { return printf("%.*f", digits, value); }
+  size_t print(const Printable &value) { return value.printTo(*this); }
+
+  size_t println() { return write("\r\n"); }
+  template <typename T> size_t println(const T &value) { return print(value) + println(); }
+  template <typename T> size_t println(const T &value, int format) { return print(value, format) + println(); }
+
+  size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)))
+  {
+    char text[256];
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+    if (len < (int)sizeof(text))
+    {
+      return write((const uint8_t *)text, len < 0 ? 0 : len);
+    }
+    std::string longer(len + 1, '\0');
+    va_start(args, format);
+    vsnprintf(&longer[0], longer.size(), format, args);
+    va_end(args);
+    return write((const uint8_t *)longer.data(), len);
+  }
+};
+
+class Stream : public Print
+{
+public:
+  virtual int available() { return 0; }
+  virtual int read() { return -1; }
+  virtual int peek() { return -1; }
+  virtual void flush() {}
+  void setTimeout(unsigned long ms) { timeout_ms = ms; }
+
+protected:
+  unsigned long timeout_ms = 1000;
+};
+
+// ----- USB CDC on the host: stdout and stdin ----- //
+class HWCDC : public Stream
+{
+public:
+  void begin(unsigned long baud = 0) {}
+  void end() {}
+  operator bool() const { return true; }
+  void setTxTimeoutMs(uint32_t ms) {}
+  int availableForWrite() { return 256; }
+  int available() override;
+  int read() override;
+  void flush() override;
+  using Print::write;
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t *buffer, size_t size) override;
+};
+extern HWCDC Serial;
+
+// ----- IPAddress ----- //
+class IPAddress : public Printable
+{
+public:
+  IPAddress() : address(0) {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : address(a | b << 8 | c << 16 | (uint32_t)d << 24) {}
+  IPAddress(uint32_t value) : address(value) {}
+  operator uint32_t() const { return address; }
+  uint8_t operator[](int i) const { return address >> (8 * i); }
+  bool fromString(const char *text)
+  {
+    unsigned a, b, c, d;
+    if (sscanf(text, "%u.%u.%u.%u", &a, &b, &c, &d) != 4 || a > 255 || b > 255 || c > 255 || d > 255)
+    {
+      return false;
+    }
+    address = a | b << 8 | c << 16 | (uint32_t)d << 24;
+    return true;
+  }
+  String toString() const
+  {
+    char text[16];
+    snprintf(text, sizeof(text), "%u.%u.%u.%u", (*this)[0], (*this)[1], (*this)[2], (*this)[3]);
+    return String(text);
+  }
+  size_t printTo(Print &p) const override { return p.print(toString()); }
+
+private:
+  uint32_t address;
+};
+
+// ----- ESP ----- //
+class EspClass
+{
+public:
+  void restart();
+  uint64_t getEfuseMac() { return 0x0000563412C3B2A1ULL; }
+  uint32_t getFreeHeap() { return 200000; }
+  uint32_t getMinFreeHeap() { return 200000; }
+  uint32_t getCpuFreqMHz() { return getCpuFrequencyMhz(); }
+  uint32_t getCycleCount(); // host time counted at the CPU frequency
+};
+extern EspClass ESP;
+
+#endif
@@ -0,0 +1,22 @@
+// ESP32Time for the native build (see sim.h): the RTC counts on the simulated clock
+#ifndef ESP32TIME_H
+#define ESP32TIME_H
+
+#include <Arduino.h>
+
+class ESP32Time
+{
+public:
+  ESP32Time(unsigned long offset = 0) : offset(offset) {}
+  void setTime(unsigned long epoch = 1609459200, int ms = 0);
+  unsigned long getEpoch();
+  unsigned long getMillis();
+  String getTime();
+  String getTime(String format);
+  struct tm getTimeStruct();
+
+private:
+  unsigned long offset;
+};
+
+#endif
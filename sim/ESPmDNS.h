@@ -0,0 +1,15 @@
+// mDNS for the native build (see sim.h)
+#ifndef ESPMDNS_H
+#define ESPMDNS_H
+
+#include <Arduino.h>
+
+class MDNSResponder
+{
+public:
+  bool begin(const char *hostname) { return false; }
+  void addService(const char *service, const char *protocol, uint16_t port) {}
+};
+extern MDNSResponder MDNS;
+
+#endif
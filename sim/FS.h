@@ -0,0 +1,79 @@
+// File system for the native build (see sim.h): files in a directory of the host
+#ifndef FS_H
+#define FS_H
+
+#include <Arduino.h>
+#include <memory>
+
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+#define FILE_APPEND "a"
+
+namespace fs
+{
+
+enum SeekMode
+{
+  SeekSet = 0,
+  SeekCur = 1,
+  SeekEnd = 2
+};
+
+struct FileImpl;
+
+class File : public Stream
+{
+public:
+  File() {}
+  explicit File(std::shared_ptr<FileImpl> impl) : impl(impl) {}
+  operator bool() const;
+  void close();
+  size_t size() const;
+  size_t position() const;
+  bool seek(uint32_t pos, SeekMode mode = SeekSet);
+  const char *name() const;
+  const char *path() const;
+  bool isDirectory() const;
+  File openNextFile(const char *mode = FILE_READ);
+  void rewindDirectory();
+  time_t getLastWrite();
+  int available() override;
+  int read() override;
+  int peek() override;
+  size_t read(uint8_t *buffer, size_t size);
+  void flush() override;
+  using Print::write;
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t *buffer, size_t size) override;
+
+private:
+  std::shared_ptr<FileImpl> impl;
+};
+
+class FS
+{
+public:
+  File open(const char *path, const char *mode = FILE_READ, bool create = false);
+  File open(const String &path, const char *mode = FILE_READ, bool create = false)
+  {
+    return open(path.c_str(), mode, create);
+  }
+  bool exists(const char *path);
+  bool exists(const String &path) { return exists(path.c_str()); }
+  bool remove(const char *path);
+  bool remove(const String &path) { return remove(path.c_str()); }
+  bool rename(const char *from, const char *to);
+  bool mkdir(const char *path);
+
+protected:
+  std::string host_path(const char *path) const;
+  std::string root;
+  bool mounted = false;
+};
+
+} // namespace fs
+
+using fs::File;
+using fs::FS;
+
+#endif
@@ -0,0 +1,28 @@
+// MQTT client for the native build (see sim.h): never connects
+#ifndef PUBSUBCLIENT_H
+#define PUBSUBCLIENT_H
+
+#include <WiFi.h>
+
+class PubSubClient
+{
+public:
+  PubSubClient(WiFiClient &client) {}
+  PubSubClient &setServer(const char *host, uint16_t port) { return *this; }
+  bool setBufferSize(uint16_t size) { return true; }
+  bool connect(const char *id) { return false; }
+  bool connect(const char *id, const char *will_topic, uint8_t will_qos, bool will_retain, const char *will_message)
+  {
+    return false;
+  }
+  bool connected() { return false; }
+  bool loop() { return false; }
+  int state() { return -2; }
+  bool publish(const char *topic, const char *payload, bool retained = false) { return false; }
+  bool publish(const char *topic, const uint8_t *payload, unsigned int length, bool retained = false)
+  {
+    return false;
+  }
+};
+
+#endif
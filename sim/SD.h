@@ -0,0 +1,19 @@
+// SD card for the native build (see sim.h): mounts the directory set with sim_sd_root()
+#ifndef SD_H
+#define SD_H
+
+#include <FS.h>
+#include <SPI.h>
+
+class SDFS : public fs::FS
+{
+public:
+  bool begin(uint8_t ss = 5, SPIClass &spi = SPI, uint32_t frequency = 4000000, const char *mountpoint = "/sd",
+             uint8_t max_files = 5, bool format_if_empty = false);
+  void end() { mounted = false; }
+  uint64_t totalBytes();
+  uint64_t usedBytes();
+};
+extern SDFS SD;
+
+#endif
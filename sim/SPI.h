@@ -0,0 +1,14 @@
+// SPI for the native build (see sim.h): the simulated TFT and SD card are not on a bus
+#ifndef SPI_H
+#define SPI_H
+
+#include <Arduino.h>
+
+class SPIClass
+{
+public:
+  void begin(int8_t sck = -1, int8_t miso = -1, int8_t mosi = -1, int8_t ss = -1) {}
+};
+extern SPIClass SPI;
+
+#endif
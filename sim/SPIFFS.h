@@ -0,0 +1,7 @@
+// SPIFFS for the native build (see sim.h): the firmware includes it but does not use it
+#ifndef SPIFFS_H
+#define SPIFFS_H
+
+#include <FS.h>
+
+#endif
@@ -0,0 +1,46 @@
+// WebServer for the native build (see sim.h): web_begin() is only called once WiFi is up, so nothing is served
+#ifndef WEBSERVER_H
+#define WEBSERVER_H
+
+#include <WiFi.h>
+#include <functional>
+
+enum HTTPMethod
+{
+  HTTP_ANY,
+  HTTP_GET,
+  HTTP_HEAD,
+  HTTP_POST,
+  HTTP_PUT,
+  HTTP_PATCH,
+  HTTP_DELETE,
+  HTTP_OPTIONS
+};
+
+#define CONTENT_LENGTH_UNKNOWN ((size_t)-1)
+
+class WebServer
+{
+public:
+  typedef std::function<void(void)> THandlerFunction;
+  WebServer(int port = 80) {}
+  void begin() {}
+  void handleClient() {}
+  void on(const String &uri, HTTPMethod method, THandlerFunction handler) {}
+  void onNotFound(THandlerFunction handler) {}
+  void collectHeaders(const char *headers[], size_t count) {}
+  String uri() { return String(); }
+  HTTPMethod method() { return HTTP_GET; }
+  String arg(const String &name) { return String(); }
+  String header(const String &name) { return String(); }
+  bool hasHeader(const String &name) { return false; }
+  WiFiClient client() { return WiFiClient(); }
+  void setContentLength(size_t length) {}
+  void sendHeader(const String &name, const String &value, bool first = false) {}
+  void send(int code, const char *content_type = NULL, const String &content = String()) {}
+  void send_P(int code, const char *content_type, const char *content) {}
+  void sendContent(const String &content) {}
+  void sendContent(const char *content, size_t size) {}
+};
+
+#endif
@@ -0,0 +1,18 @@
+// WebSockets for the native build (see sim.h)
+#ifndef WEBSOCKETSSERVER_H
+#define WEBSOCKETSSERVER_H
+
+#include <Arduino.h>
+
+class WebSocketsServer
+{
+public:
+  WebSocketsServer(uint16_t port) {}
+  void begin() {}
+  void loop() {}
+  int connectedClients(bool ping = false) { return 0; }
+  bool broadcastBIN(const uint8_t *payload, size_t length) { return false; }
+  bool broadcastTXT(const char *payload) { return false; }
+};
+
+#endif
@@ -0,0 +1,56 @@
+// WiFi for the native build (see sim.h): there is no network, the station never connects
+#ifndef WIFI_H
+#define WIFI_H
+
+#include <Arduino.h>
+
+typedef enum
+{
+  WL_IDLE_STATUS = 0,
+  WL_NO_SSID_AVAIL = 1,
+  WL_CONNECTED = 3,
+  WL_CONNECT_FAILED = 4,
+  WL_DISCONNECTED = 6
+} wl_status_t;
+
+typedef enum
+{
+  WIFI_OFF = 0,
+  WIFI_STA,
+  WIFI_AP,
+  WIFI_AP_STA
+} wifi_mode_t;
+
+class WiFiClass
+{
+public:
+  bool mode(wifi_mode_t mode);
+  wl_status_t begin() { return WL_DISCONNECTED; }
+  wl_status_t begin(const char *ssid, const char *password = NULL) { return WL_DISCONNECTED; }
+  bool disconnect(bool wifi_off = false) { return true; }
+  wl_status_t status() { return WL_DISCONNECTED; }
+  IPAddress localIP() { return IPAddress(); }
+  IPAddress broadcastIP() { return IPAddress(); }
+  String macAddress() { return String("A1:B2:C3:12:34:56"); }
+  bool setSleep(bool enable) { return true; }
+  int hostByName(const char *host, IPAddress &ip) { return 0; }
+};
+extern WiFiClass WiFi;
+
+class WiFiClient : public Stream
+{
+public:
+  int connect(const char *host, uint16_t port) { return 0; }
+  int connect(IPAddress ip, uint16_t port) { return 0; }
+  uint8_t connected() { return 0; }
+  operator bool() { return false; }
+  void stop() {}
+  void setNoDelay(bool no_delay) {}
+  int read(uint8_t *buffer, size_t size) { return -1; }
+  using Stream::read;
+  using Print::write;
+  size_t write(uint8_t c) override { return 0; }
+  size_t write(const uint8_t *buffer, size_t size) override { return 0; }
+};
+
+#endif
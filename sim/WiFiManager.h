@@ -0,0 +1,18 @@
+// WiFiManager for the native build (see sim.h): credentials are "saved", so the firmware tries to connect and times out
+#ifndef WIFIMANAGER_H
+#define WIFIMANAGER_H
+
+#include <WiFi.h>
+
+class WiFiManager
+{
+public:
+  void setEnableConfigPortal(bool enable) {}
+  void setConfigPortalBlocking(bool blocking) {}
+  bool startConfigPortal(const char *ap_name) { return false; }
+  bool getWiFiIsSaved() { return true; }
+  void resetSettings() {}
+  void process() {}
+};
+
+#endif
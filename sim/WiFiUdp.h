@@ -0,0 +1,26 @@
+// UDP for the native build (see sim.h): nothing is sent or received
+#ifndef WIFIUDP_H
+#define WIFIUDP_H
+
+#include <WiFi.h>
+
+class WiFiUDP : public Stream
+{
+public:
+  uint8_t begin(uint16_t port) { return 0; }
+  void stop() {}
+  int beginPacket(IPAddress ip, uint16_t port) { return 0; }
+  int beginPacket(const char *host, uint16_t port) { return 0; }
+  int endPacket() { return 0; }
+  int parsePacket() { return 0; }
+  int read(uint8_t *buffer, size_t size) { return -1; }
+  int read(char *buffer, size_t size) { return -1; }
+  using Stream::read;
+  IPAddress remoteIP() { return IPAddress(); }
+  uint16_t remotePort() { return 0; }
+  using Print::write;
+  size_t write(uint8_t c) override { return 0; }
+  size_t write(const uint8_t *buffer, size_t size) override { return 0; }
+};
+
+#endif
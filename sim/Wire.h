@@ -0,0 +1,15 @@
+// I2C for the native build (see sim.h): the simulated INA3221 is not on a bus
+#ifndef WIRE_H
+#define WIRE_H
+
+#include <Arduino.h>
+
+class TwoWire
+{
+public:
+  bool begin(int sda = -1, int scl = -1, uint32_t frequency = 0) { return true; }
+  bool setClock(uint32_t frequency) { return true; }
+};
+extern TwoWire Wire;
+
+#endif
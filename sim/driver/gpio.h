@@ -0,0 +1,16 @@
+#ifndef DRIVER_GPIO_H
+#define DRIVER_GPIO_H
+
+#include "esp_sleep.h"
+
+typedef int gpio_num_t;
+typedef enum
+{
+  GPIO_INTR_LOW_LEVEL = 4,
+  GPIO_INTR_HIGH_LEVEL = 5
+} gpio_int_type_t;
+
+inline esp_err_t gpio_wakeup_enable(gpio_num_t pin, gpio_int_type_t type) { return ESP_OK; }
+inline esp_err_t gpio_wakeup_disable(gpio_num_t pin) { return ESP_OK; }
+
+#endif
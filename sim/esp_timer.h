@@ -0,0 +1,9 @@
+// esp_timer for the native build (see sim.h): the simulated clock
+#ifndef ESP_TIMER_H
+#define ESP_TIMER_H
+
+#include <stdint.h>
+
+int64_t esp_timer_get_time();
+
+#endif
@@ -0,0 +1,34 @@
+// FreeRTOS for the native build (see sim.h): tasks are threads, ticks are simulated milliseconds
+#ifndef FREERTOS_H
+#define FREERTOS_H
+
+#include <pthread.h>
+#include <stdint.h>
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS pdTRUE
+#define pdFAIL pdFALSE
+#define portMAX_DELAY ((TickType_t)0xffffffffUL)
+#define configTICK_RATE_HZ 1000
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define tskNO_AFFINITY 0x7FFFFFFF
+
+// ----- Critical sections are a mutex, the host has no interrupts to mask ----- //
+typedef struct
+{
+  pthread_mutex_t lock;
+} portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED {PTHREAD_MUTEX_INITIALIZER}
+#define portENTER_CRITICAL(mux) pthread_mutex_lock(&(mux)->lock)
+#define portEXIT_CRITICAL(mux) pthread_mutex_unlock(&(mux)->lock)
+#define portENTER_CRITICAL_ISR(mux) portENTER_CRITICAL(mux)
+#define portEXIT_CRITICAL_ISR(mux) portEXIT_CRITICAL(mux)
+#define portYIELD_FROM_ISR(woken) ((void)(woken))
+
+#endif
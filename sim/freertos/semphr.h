@@ -0,0 +1,14 @@
+#ifndef FREERTOS_SEMPHR_H
+#define FREERTOS_SEMPHR_H
+
+#include "queue.h"
+
+// ----- Semaphores are queues without payload, as in FreeRTOS ----- //
+typedef QueueHandle_t SemaphoreHandle_t;
+
+SemaphoreHandle_t xSemaphoreCreateMutex();
+SemaphoreHandle_t xSemaphoreCreateBinary();
+#define xSemaphoreTake(semaphore, ticks) xQueueReceive((semaphore), NULL, (ticks))
+#define xSemaphoreGive(semaphore) xQueueSend((semaphore), NULL, 0)
+
+#endif
@@ -0,0 +1,59 @@
+// INA3221 library for the native build (see sim.h): same API and unit conventions, inputs from sim_ina_waveform()
+#ifndef INA3221_H
+#define INA3221_H
+
+#include <Arduino.h>
+
+typedef enum
+{
+  INA3221_ADDR40_GND = 0x40,
+  INA3221_ADDR41_VCC = 0x41,
+  INA3221_ADDR42_SDA = 0x42,
+  INA3221_ADDR43_SCL = 0x43
+} ina3221_addr_t;
+
+typedef enum
+{
+  INA3221_CH1 = 0,
+  INA3221_CH2,
+  INA3221_CH3,
+  INA3221_CH_NUM
+} ina3221_ch_t;
+
+typedef enum
+{
+  INA3221_REG_CONF_AVG_1 = 0,
+  INA3221_REG_CONF_AVG_4,
+  INA3221_REG_CONF_AVG_16,
+  INA3221_REG_CONF_AVG_64,
+  INA3221_REG_CONF_AVG_128,
+  INA3221_REG_CONF_AVG_256,
+  INA3221_REG_CONF_AVG_512,
+  INA3221_REG_CONF_AVG_1024
+} ina3221_avg_mode_t;
+
+class INA3221
+{
+public:
+  INA3221(ina3221_addr_t address) {}
+  void begin() {}
+  void reset();
+  void setShuntRes(uint32_t res_ch1, uint32_t res_ch2, uint32_t res_ch3);
+  void setFilterRes(uint32_t res_ch1, uint32_t res_ch2, uint32_t res_ch3);
+  void setAveragingMode(ina3221_avg_mode_t mode) { averaging = mode; }
+  void setChannelEnable(ina3221_ch_t channel) { enabled[channel] = true; }
+  void setChannelDisable(ina3221_ch_t channel) { enabled[channel] = false; }
+  void setWarnAlertCurrentLimit(ina3221_ch_t channel, int32_t current_mA) {}
+  void setCritAlertCurrentLimit(ina3221_ch_t channel, int32_t current_mA) {}
+  int32_t getShuntVoltage(ina3221_ch_t channel); // uV
+  float getCurrent(ina3221_ch_t channel);        // A, from the calibration shunt set with setShuntRes()
+  float getVoltage(ina3221_ch_t channel);        // bus voltage in V
+
+private:
+  uint32_t shunt_res[INA3221_CH_NUM] = {10, 10, 10};
+  uint32_t filter_res[INA3221_CH_NUM] = {0, 0, 0};
+  ina3221_avg_mode_t averaging = INA3221_REG_CONF_AVG_1;
+  bool enabled[INA3221_CH_NUM] = {true, true, true};
+};
+
+#endif
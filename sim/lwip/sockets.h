@@ -0,0 +1,11 @@
+// lwIP sockets for the native build (see sim.h): the BSD socket API of the host
+#ifndef LWIP_SOCKETS_H
+#define LWIP_SOCKETS_H
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#endif
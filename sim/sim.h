@@ -0,0 +1,81 @@
+/*--------------------------------------------------------------------------------
+Native build: the firmware on a Linux host with simulated peripherals
+
+The firmware only reaches the hardware through the Arduino core, FreeRTOS and
+the libraries in lib_deps, so these APIs are its hardware abstraction. The
+[env:native] environment in platformio.ini puts this directory in front of
+the include path: every header here has the name and the API subset of the
+one the firmware includes, backed by a simulation instead of a peripheral.
+
+  Clock      millis(), micros(), esp_timer and the FreeRTOS tick run on a
+             simulated clock, SIM_SPEED times faster than the host clock.
+             delay(), vTaskDelay() and queue timeouts sleep accordingly.
+  INA3221    replays a waveform per channel (dc, pulse, sine or a CSV file),
+             quantised to the 40uV shunt and 8mV bus LSB of the chip.
+  SD / FS    files live in a host directory (sim_sd/ by default).
+  TFT        counts the characters and pixels that would go over SPI.
+  Buttons    presses are scripted at simulated times and run the handlers
+             registered with attachInterrupt(), like the GPIO interrupt.
+  WiFi       never connects, so the network modules stay idle.
+  Power      CPU frequency, light sleep, WiFi and backlight are accounted
+             per state, the run ends with an estimate of the supply current.
+  Serial     stdout, commands (control_api.h) are read from stdin or
+             scripted at simulated times.
+
+Tasks are host threads, queues and semaphores block on condition variables.
+sim_main.cpp provides main(): it parses the options, then calls setup() and
+loop() until the simulated run time is over.
+--------------------------------------------------------------------------------*/
+
+#ifndef SIM_H
+#define SIM_H
+
+#include <stdint.h>
+
+#define SIM_SPEED 100 // default speedup of the simulated clock
+
+// ----- Simulated clock ----- //
+void sim_clock_start(double speed);
+uint64_t sim_time_us();
+void sim_sleep_us(uint64_t us);
+double sim_speed();
+
+// ----- Buttons: schedule a press of a pin at a simulated time ----- //
+void sim_press(int pin, uint64_t at_ms);
+void sim_buttons_start();
+
+// ----- Serial: schedule a command line at a simulated time, as if typed into stdin ----- //
+void sim_serial_line(const char *line, uint64_t at_ms);
+
+// ----- INA3221 inputs ----- //
+bool sim_ina_waveform(int channel, const char *spec); // see sim_peripherals.cpp for the forms of spec
+void sim_ina_noise(float mA);
+void sim_ina_shunt(uint32_t mohm); // the resistor on the board, not the one the firmware calibrates with
+
+// ----- Other inputs and outputs ----- //
+void sim_battery(float volts);
+void sim_sd_root(const char *path, bool present);
+
+struct sim_tft_stats
+{
+  uint64_t chars;  // text written through Print
+  uint64_t pixels; // filled or pushed with writePixels()
+  uint64_t windows; // setAddrWindow() transactions
+};
+sim_tft_stats sim_tft_read();
+
+// ----- Time spent in each power state, for the current estimate at the end of a run ----- //
+struct sim_power_stats
+{
+  uint64_t light_sleep_us;
+  uint64_t awake_80_us;  // CPU at 80MHz (or less), running or halted in the idle task
+  uint64_t awake_160_us;
+  uint64_t wifi_us;      // WiFi switched on
+  uint64_t backlight_us; // at full brightness, a dimmed backlight counts by its PWM duty
+  uint64_t panel_us;     // display controller out of its sleep mode
+};
+void sim_power_wifi(bool on);
+void sim_power_panel(bool awake);
+sim_power_stats sim_power_read();
+
+#endif
@@ -0,0 +1,599 @@
+// Arduino core, clock, pins, buttons and FreeRTOS of the native build (see sim.h)
+#include "sim.h"
+#include <Arduino.h>
+#include <Wire.h>
+#include <SPI.h>
+#include <WiFi.h>
+#include <ESPmDNS.h>
+#include <esp_sleep.h>
+#include <esp_timer.h>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <fcntl.h>
+#include <mutex>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#define SIM_PINS 48
+#define SIM_PRESS_MS 100    // how long a scripted press holds the pin low
+#define SIM_SPIN_REAL_US 200 // the last part of a wait is spun, host sleeps overshoot by ~60us
+#define SIM_BACKLIGHT_PIN 1  // TFT_BL of src/main.cpp
+
+HWCDC Serial;
+EspClass ESP;
+TwoWire Wire;
+SPIClass SPI;
+WiFiClass WiFi;
+MDNSResponder MDNS;
+
+// ----- Simulated clock ----- //
+typedef std::chrono::steady_clock sim_host_clock;
+
+static sim_host_clock::time_point sim_start = sim_host_clock::now();
+static double sim_factor = SIM_SPEED;
+
+void sim_clock_start(double speed)
+{
+  sim_factor = speed > 0 ? speed : 1;
+  sim_start = sim_host_clock::now();
+}
+
+double sim_speed()
+{
+  return sim_factor;
+}
+
+uint64_t sim_time_us()
+{
+  std::chrono::duration<double, std::micro> real = sim_host_clock::now() - sim_start;
+  return (uint64_t)(real.count() * sim_factor);
+}
+
+// Host time at which the simulated clock reaches at_us
+static sim_host_clock::time_point sim_host_deadline(uint64_t at_us)
+{
+  return sim_start + std::chrono::duration_cast<sim_host_clock::duration>(
+                         std::chrono::duration<double, std::micro>(at_us / sim_factor));
+}
+
+void sim_sleep_us(uint64_t us)
+{
+  sim_host_clock::time_point deadline = sim_host_deadline(sim_time_us() + us);
+  std::this_thread::sleep_until(deadline - std::chrono::microseconds(SIM_SPIN_REAL_US));
+  while (sim_host_clock::now() < deadline)
+  {
+    std::this_thread::yield();
+  }
+}
+
+unsigned long millis()
+{
+  return sim_time_us() / 1000;
+}
+
+unsigned long micros()
+{
+  return (uint32_t)sim_time_us();
+}
+
+void delay(uint32_t ms)
+{
+  sim_sleep_us((uint64_t)ms * 1000);
+}
+
+void delayMicroseconds(uint32_t us)
+{
+  sim_sleep_us(us);
+}
+
+void yield()
+{
+  std::this_thread::yield();
+}
+
+int64_t esp_timer_get_time()
+{
+  return sim_time_us();
+}
+
+// ----- CPU frequency and light sleep ----- //
+static uint32_t sim_cpu_mhz = 160;
+static uint64_t sim_sleep_wakeup_us = 0;
+
+// ----- Power states, the time since the last change is added to the state it was spent in ----- //
+static std::mutex sim_power_lock;
+static sim_power_stats sim_power = {};
+static uint64_t sim_power_since = 0;
+static bool sim_asleep = false;
+static bool sim_wifi_on = false;
+static bool sim_panel_awake = true;
+static int sim_backlight = 0;
+
+static void sim_power_account()
+{
+  uint64_t now = sim_time_us();
+  uint64_t elapsed = now - sim_power_since;
+  sim_power_since = now;
+  if (sim_asleep)
+  {
+    sim_power.light_sleep_us += elapsed;
+  }
+  else if (sim_cpu_mhz > 80)
+  {
+    sim_power.awake_160_us += elapsed;
+  }
+  else
+  {
+    sim_power.awake_80_us += elapsed;
+  }
+  sim_power.wifi_us += sim_wifi_on ? elapsed : 0;
+  sim_power.panel_us += sim_panel_awake ? elapsed : 0;
+  sim_power.backlight_us += elapsed * sim_backlight / 255;
+}
+
+void sim_power_wifi(bool on)
+{
+  std::lock_guard<std::mutex> held(sim_power_lock);
+  sim_power_account();
+  sim_wifi_on = on;
+}
+
+void sim_power_panel(bool awake)
+{
+  std::lock_guard<std::mutex> held(sim_power_lock);
+  sim_power_account();
+  sim_panel_awake = awake;
+}
+
+sim_power_stats sim_power_read()
+{
+  std::lock_guard<std::mutex> held(sim_power_lock);
+  sim_power_account();
+  return sim_power;
+}
+
+bool WiFiClass::mode(wifi_mode_t mode)
+{
+  sim_power_wifi(mode != WIFI_OFF);
+  return true;
+}
+
+bool setCpuFrequencyMhz(uint32_t mhz)
+{
+  std::lock_guard<std::mutex> held(sim_power_lock);
+  sim_power_account();
+  sim_cpu_mhz = mhz;
+  return true;
+}
+
+uint32_t getCpuFrequencyMhz()
+{
+  return sim_cpu_mhz;
+}
+
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t us)
+{
+  sim_sleep_wakeup_us = us;
+  return ESP_OK;
+}
+
+esp_err_t esp_sleep_enable_gpio_wakeup()
+{
+  return ESP_OK;
+}
+
+esp_err_t esp_light_sleep_start()
+{
+  {
+    std::lock_guard<std::mutex> held(sim_power_lock);
+    sim_power_account();
+    sim_asleep = true;
+  }
+  sim_sleep_us(sim_sleep_wakeup_us);
+  std::lock_guard<std::mutex> held(sim_power_lock);
+  sim_power_account();
+  sim_asleep = false;
+  return ESP_OK;
+}
+
+esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause()
+{
+  return ESP_SLEEP_WAKEUP_TIMER;
+}
+
+uint32_t EspClass::getCycleCount()
+{
+  std::chrono::duration<double, std::nano> real = sim_host_clock::now().time_since_epoch();
+  return (uint64_t)(real.count() * sim_cpu_mhz / 1000);
+}
+
+void EspClass::restart()
+{
+  fprintf(stderr, "sim: ESP.restart()\n");
+  fflush(NULL);
+  _exit(3);
+}
+
+// ----- Pins: buttons idle high, the battery divider on the ADC ----- //
+static uint8_t sim_level[SIM_PINS];
+static void (*sim_handler[SIM_PINS])(void);
+static float sim_battery_volts = 3.9f;
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+  if (pin < SIM_PINS && mode != OUTPUT)
+  {
+    sim_level[pin] = HIGH;
+  }
+}
+
+int digitalRead(uint8_t pin)
+{
+  return pin < SIM_PINS ? sim_level[pin] : LOW;
+}
+
+void digitalWrite(uint8_t pin, uint8_t value)
+{
+  if (pin < SIM_PINS)
+  {
+    sim_level[pin] = value;
+  }
+}
+
+void analogWrite(uint8_t pin, int value)
+{
+  if (pin == SIM_BACKLIGHT_PIN)
+  {
+    std::lock_guard<std::mutex> held(sim_power_lock);
+    sim_power_account();
+    sim_backlight = value;
+  }
+}
+
+void sim_battery(float volts)
+{
+  sim_battery_volts = volts;
+}
+
+uint16_t analogRead(uint8_t pin)
+{
+  // 12 bit ADC behind the 1:5.8 divider of get_battery_voltage()
+  int raw = (int)(sim_battery_volts * 4095 / 5.8f + 0.5f);
+  return raw > 4095 ? 4095 : raw;
+}
+
+void attachInterrupt(uint8_t pin, void (*handler)(void), int mode)
+{
+  if (pin < SIM_PINS)
+  {
+    sim_handler[pin] = handler;
+  }
+}
+
+void detachInterrupt(uint8_t pin)
+{
+  if (pin < SIM_PINS)
+  {
+    sim_handler[pin] = NULL;
+  }
+}
+
+// ----- Scripted button presses ----- //
+struct sim_press_event
+{
+  uint64_t at_ms;
+  int pin;
+};
+
+static std::vector<sim_press_event> sim_presses;
+
+void sim_press(int pin, uint64_t at_ms)
+{
+  sim_presses.push_back({at_ms, pin});
+}
+
+// A press the host started late moves the later ones by as much, so the presses keep their spacing in
+// simulated time and none falls into the 200ms debounce of the one before. A press before setup()
+// attached the interrupt waits for it, at high speeds setup() takes seconds of simulated time.
+static void sim_button_thread()
+{
+  uint64_t late_us = 0;
+  for (const sim_press_event &press : sim_presses)
+  {
+    uint64_t at_us = press.at_ms * 1000 + late_us;
+    uint64_t now_us = sim_time_us();
+    if (at_us > now_us)
+    {
+      sim_sleep_us(at_us - now_us);
+    }
+    while (sim_handler[press.pin] == NULL)
+    {
+      sim_sleep_us(SIM_PRESS_MS * 1000);
+    }
+    now_us = sim_time_us(); // a busy host wakes the thread late
+    if (now_us > at_us)
+    {
+      late_us += now_us - at_us;
+    }
+    sim_level[press.pin] = LOW;
+    if (sim_handler[press.pin] != NULL)
+    {
+      sim_handler[press.pin](); // falling edge
+    }
+    sim_sleep_us(SIM_PRESS_MS * 1000);
+    sim_level[press.pin] = HIGH;
+  }
+}
+
+void sim_buttons_start()
+{
+  std::sort(sim_presses.begin(), sim_presses.end(),
+            [](const sim_press_event &a, const sim_press_event &b) { return a.at_ms < b.at_ms; });
+  if (!sim_presses.empty())
+  {
+    std::thread(sim_button_thread).detach();
+  }
+}
+
+// ----- Serial: stdout, commands from stdin ----- //
+struct sim_serial_event
+{
+  uint64_t at_ms;
+  std::string line;
+};
+
+static std::deque<uint8_t> sim_serial_input;
+static std::vector<sim_serial_event> sim_serial_script; // sorted by time
+static std::mutex sim_serial_lock;
+
+void sim_serial_line(const char *line, uint64_t at_ms)
+{
+  std::lock_guard<std::mutex> guard(sim_serial_lock);
+  sim_serial_script.push_back({at_ms, std::string(line) + "\n"});
+  std::stable_sort(sim_serial_script.begin(), sim_serial_script.end(),
+                   [](const sim_serial_event &a, const sim_serial_event &b) { return a.at_ms < b.at_ms; });
+}
+
+int HWCDC::available()
+{
+  std::lock_guard<std::mutex> guard(sim_serial_lock);
+  static bool nonblocking = false;
+  if (!nonblocking)
+  {
+    fcntl(0, F_SETFL, fcntl(0, F_GETFL) | O_NONBLOCK);
+    nonblocking = true;
+  }
+  uint8_t buffer[256];
+  ssize_t n = ::read(0, buffer, sizeof(buffer));
+  for (ssize_t i = 0; i < n; i++)
+  {
+    sim_serial_input.push_back(buffer[i]);
+  }
+  // Scripted lines arrive once the simulated clock has passed their time, however slow the host is
+  while (!sim_serial_script.empty() && sim_serial_script.front().at_ms * 1000 <= sim_time_us())
+  {
+    sim_serial_input.insert(sim_serial_input.end(), sim_serial_script.front().line.begin(),
+                            sim_serial_script.front().line.end());
+    sim_serial_script.erase(sim_serial_script.begin());
+  }
+  return sim_serial_input.size();
+}
+
+int HWCDC::read()
+{
+  std::lock_guard<std::mutex> guard(sim_serial_lock);
+  if (sim_serial_input.empty())
+  {
+    return -1;
+  }
+  uint8_t c = sim_serial_input.front();
+  sim_serial_input.pop_front();
+  return c;
+}
+
+void HWCDC::flush()
+{
+  fflush(stdout);
+}
+
+size_t HWCDC::write(uint8_t c)
+{
+  return fwrite(&c, 1, 1, stdout);
+}
+
+size_t HWCDC::write(const uint8_t *buffer, size_t size)
+{
+  return fwrite(buffer, 1, size, stdout);
+}
+
+// ----- FreeRTOS: tasks are threads, queues wait on the simulated clock ----- //
+struct sim_task
+{
+  const char *name;
+};
+
+struct sim_queue
+{
+  std::mutex lock;
+  std::condition_variable changed;
+  std::vector<uint8_t> storage; // length items, allocated once like a FreeRTOS queue
+  size_t first;                 // index of the oldest item
+  size_t count;
+  size_t length;
+  size_t item_size;
+};
+
+BaseType_t xTaskCreate(TaskFunction_t code, const char *name, uint32_t stack, void *parameter, UBaseType_t priority,
+                       TaskHandle_t *handle)
+{
+  sim_task *task = new sim_task{name};
+  if (handle != NULL)
+  {
+    *handle = task;
+  }
+  std::thread(code, parameter).detach();
+  return pdPASS;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t code, const char *name, uint32_t stack, void *parameter,
+                                   UBaseType_t priority, TaskHandle_t *handle, BaseType_t core)
+{
+  return xTaskCreate(code, name, stack, parameter, priority, handle);
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+  sim_sleep_us((uint64_t)ticks * 1000);
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+  if (task == NULL)
+  {
+    pthread_exit(NULL);
+  }
+}
+
+void vTaskPrioritySet(TaskHandle_t task, UBaseType_t priority)
+{
+}
+
+TickType_t xTaskGetTickCount()
+{
+  return millis();
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle()
+{
+  static thread_local sim_task current{"thread"};
+  return &current;
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task)
+{
+  return 0; // host threads have no stack watermark
+}
+
+// Waits until ready() holds or the simulated timeout passed, with queue->lock held
+template <typename Ready> static bool sim_queue_wait(sim_queue *queue, std::unique_lock<std::mutex> &held,
+                                                      TickType_t ticks, Ready ready)
+{
+  if (ticks == portMAX_DELAY)
+  {
+    queue->changed.wait(held, ready);
+    return true;
+  }
+  sim_host_clock::time_point deadline = sim_host_deadline(sim_time_us() + (uint64_t)ticks * 1000);
+  while (!ready())
+  {
+    sim_host_clock::time_point now = sim_host_clock::now();
+    if (now >= deadline)
+    {
+      return false;
+    }
+    if (deadline - now > std::chrono::microseconds(SIM_SPIN_REAL_US))
+    {
+      queue->changed.wait_until(held, deadline - std::chrono::microseconds(SIM_SPIN_REAL_US));
+    }
+    else
+    {
+      held.unlock();
+      std::this_thread::yield();
+      held.lock();
+    }
+  }
+  return true;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size)
+{
+  sim_queue *queue = new sim_queue();
+  queue->storage.resize(length * item_size);
+  queue->first = 0;
+  queue->count = 0;
+  queue->length = length;
+  queue->item_size = item_size;
+  return queue;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticks)
+{
+  std::unique_lock<std::mutex> held(queue->lock);
+  if (!sim_queue_wait(queue, held, ticks, [queue] { return queue->count < queue->length; }))
+  {
+    return pdFALSE;
+  }
+  if (item != NULL && queue->item_size > 0)
+  {
+    size_t slot = (queue->first + queue->count) % queue->length;
+    memcpy(queue->storage.data() + slot * queue->item_size, item, queue->item_size);
+  }
+  queue->count++;
+  queue->changed.notify_all();
+  return pdTRUE;
+}
+
+BaseType_t xQueueSendFromISR(QueueHandle_t queue, const void *item, BaseType_t *woken)
+{
+  return xQueueSend(queue, item, 0);
+}
+
+static BaseType_t sim_queue_take(QueueHandle_t queue, void *item, TickType_t ticks, bool remove)
+{
+  std::unique_lock<std::mutex> held(queue->lock);
+  if (!sim_queue_wait(queue, held, ticks, [queue] { return queue->count > 0; }))
+  {
+    return pdFALSE;
+  }
+  if (item != NULL && queue->item_size > 0)
+  {
+    memcpy(item, queue->storage.data() + queue->first * queue->item_size, queue->item_size);
+  }
+  if (remove)
+  {
+    queue->first = (queue->first + 1) % queue->length;
+    queue->count--;
+    queue->changed.notify_all();
+  }
+  return pdTRUE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t ticks)
+{
+  return sim_queue_take(queue, item, ticks, true);
+}
+
+BaseType_t xQueuePeek(QueueHandle_t queue, void *item, TickType_t ticks)
+{
+  return sim_queue_take(queue, item, ticks, false);
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue)
+{
+  std::lock_guard<std::mutex> guard(queue->lock);
+  return queue->count;
+}
+
+BaseType_t xQueueReset(QueueHandle_t queue)
+{
+  std::lock_guard<std::mutex> guard(queue->lock);
+  queue->first = 0;
+  queue->count = 0;
+  queue->changed.notify_all();
+  return pdPASS;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex()
+{
+  SemaphoreHandle_t semaphore = xQueueCreate(1, 0);
+  xSemaphoreGive(semaphore); // a mutex starts out available
+  return semaphore;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary()
+{
+  return xQueueCreate(1, 0);
+}
@@ -0,0 +1,172 @@
+// main() of the native build (see sim.h): runs setup() and loop() on the simulated peripherals
+#include "sim.h"
+#include <Arduino.h>
+#include <thread>
+#include <unistd.h>
+
+#define SIM_LEFT_BUTTON_PIN 7  // as in src/main.cpp
+#define SIM_RIGHT_BUTTON_PIN 9
+#define SIM_MENU_START_PRESSES 5 // LEFT presses from CH1 to START in the setup menu
+#define SIM_PRESS_SPACING_MS 300 // more than the 200ms debounce of the button handlers
+
+// ----- Assumed supply currents per power state, rounded typical values, replace with bench figures ----- //
+#define SIM_MA_AWAKE_80 13.0f    // ESP32-C3 at 80MHz, the CPU halted in the idle task most of the time
+#define SIM_MA_AWAKE_160 18.0f   // same at 160MHz
+#define SIM_MA_LIGHT_SLEEP 0.13f // ESP32-C3 light sleep
+#define SIM_MA_WIFI 20.0f        // station with modem sleep, on top of the CPU
+#define SIM_MA_BACKLIGHT 20.0f   // TFT backlight at full brightness
+#define SIM_MA_PANEL 1.0f        // ST7735 controller out of sleep mode
+#define SIM_MA_BOARD 1.0f        // INA3221, SD card idle and regulator
+
+void setup();
+void loop();
+void format_status(char *reply, size_t size, const char *error);
+
+static void sim_usage(const char *name)
+{
+  fprintf(stderr,
+          "usage: %s [options]\n"
+          "  --seconds <s>             simulated run time (60)\n"
+          "  --speed <x>               simulated seconds per host second (%d)\n"
+          "  --sd <dir>                directory of the SD card (sim_sd), --no-sd: no card\n"
+          "  --ch1|--ch2|--ch3 <wave>  off, dc:V:mA, pulse:V:lowmA:highmA:periodms:duty%%,\n"
+          "                            sine:V:meanmA:ampmA:periodms or csv:file (t_ms,V,mA)\n"
+          "  --noise <mA>              gaussian noise on the current, before averaging\n"
+          "  --shunt <mOhm>            shunt resistor on the board (100)\n"
+          "  --battery <V>             battery voltage (3.9)\n"
+          "  --press <ms>:left|right   press a button at a simulated time\n"
+          "  --serial <ms>:<line>      send a command line (JSON) over Serial at a simulated time\n"
+          "  --start                   press through the setup menu to START (not with an autostart\n"
+          "                            /config.json, the last press would stop the measurement)\n",
+          name, SIM_SPEED);
+}
+
+// Ends the run at the simulated deadline, also while the firmware waits in the setup menu
+static void sim_end(double seconds, double speed)
+{
+  sim_sleep_us(seconds * 1e6);
+
+  char status[512] = "";
+  format_status(status, sizeof(status), NULL);
+  sim_tft_stats tft = sim_tft_read();
+  fflush(stdout);
+  fprintf(stderr, "sim: %.1f s simulated in %.1f s\n", sim_time_us() / 1e6, sim_time_us() / 1e6 / speed);
+  fprintf(stderr, "sim: tft %llu chars, %llu pixels, %llu windows\n", (unsigned long long)tft.chars,
+          (unsigned long long)tft.pixels, (unsigned long long)tft.windows);
+  fprintf(stderr, "sim: %s\n", status);
+
+  sim_power_stats power = sim_power_read();
+  double total = power.light_sleep_us + power.awake_80_us + power.awake_160_us;
+  double mA = (power.awake_80_us * SIM_MA_AWAKE_80 + power.awake_160_us * SIM_MA_AWAKE_160 +
+               power.light_sleep_us * SIM_MA_LIGHT_SLEEP + power.wifi_us * SIM_MA_WIFI +
+               power.backlight_us * SIM_MA_BACKLIGHT + power.panel_us * SIM_MA_PANEL) /
+                  total +
+              SIM_MA_BOARD;
+  fprintf(stderr, "sim: power 80MHz %.1f%% 160MHz %.1f%% light sleep %.1f%% wifi %.1f%% backlight %.1f%% panel %.1f%%, about %.1f mA\n",
+          100 * power.awake_80_us / total, 100 * power.awake_160_us / total, 100 * power.light_sleep_us / total,
+          100 * power.wifi_us / total, 100 * power.backlight_us / total, 100 * power.panel_us / total, mA);
+  fflush(NULL); // the log file is still open in the SD writer task
+  _exit(0);
+}
+
+int main(int argc, char **argv)
+{
+  double seconds = 60;
+  double speed = SIM_SPEED;
+
+  for (int i = 1; i < argc; i++)
+  {
+    const char *option = argv[i];
+    const char *value = i + 1 < argc ? argv[i + 1] : NULL;
+    bool ok = true;
+
+    if (strcmp(option, "--start") == 0)
+    {
+      for (int press = 0; press <= SIM_MENU_START_PRESSES; press++)
+      {
+        int pin = press < SIM_MENU_START_PRESSES ? SIM_LEFT_BUTTON_PIN : SIM_RIGHT_BUTTON_PIN;
+        sim_press(pin, (press + 1) * SIM_PRESS_SPACING_MS);
+      }
+      continue;
+    }
+    if (strcmp(option, "--no-sd") == 0)
+    {
+      sim_sd_root("", false);
+      continue;
+    }
+    if (value == NULL)
+    {
+      sim_usage(argv[0]);
+      return 1;
+    }
+    i++;
+    if (strcmp(option, "--seconds") == 0)
+    {
+      seconds = atof(value);
+    }
+    else if (strcmp(option, "--speed") == 0)
+    {
+      speed = atof(value);
+    }
+    else if (strcmp(option, "--sd") == 0)
+    {
+      sim_sd_root(value, true);
+    }
+    else if (strncmp(option, "--ch", 4) == 0 && option[4] >= '1' && option[4] <= '3' && option[5] == 0)
+    {
+      ok = sim_ina_waveform(option[4] - '1', value);
+    }
+    else if (strcmp(option, "--noise") == 0)
+    {
+      sim_ina_noise(atof(value));
+    }
+    else if (strcmp(option, "--shunt") == 0)
+    {
+      sim_ina_shunt(atoi(value));
+    }
+    else if (strcmp(option, "--battery") == 0)
+    {
+      sim_battery(atof(value));
+    }
+    else if (strcmp(option, "--press") == 0)
+    {
+      char button[8];
+      unsigned long at_ms;
+      ok = sscanf(value, "%lu:%7s", &at_ms, button) == 2 &&
+           (strcmp(button, "left") == 0 || strcmp(button, "right") == 0);
+      if (ok)
+      {
+        sim_press(strcmp(button, "left") == 0 ? SIM_LEFT_BUTTON_PIN : SIM_RIGHT_BUTTON_PIN, at_ms);
+      }
+    }
+    else if (strcmp(option, "--serial") == 0)
+    {
+      char *line;
+      unsigned long at_ms = strtoul(value, &line, 10);
+      ok = line != value && *line == ':';
+      if (ok)
+      {
+        sim_serial_line(line + 1, at_ms);
+      }
+    }
+    else
+    {
+      ok = false;
+    }
+    if (!ok)
+    {
+      fprintf(stderr, "bad option %s %s\n", option, value);
+      sim_usage(argv[0]);
+      return 1;
+    }
+  }
+
+  sim_clock_start(speed);
+  sim_buttons_start();
+  std::thread(sim_end, seconds, speed).detach();
+  setup();
+  for (;;)
+  {
+    loop();
+  }
+}
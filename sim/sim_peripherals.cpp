@@ -0,0 +1,560 @@
+// Simulated INA3221, SD card, TFT and RTC of the native build (see sim.h)
+#include "sim.h"
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+#include <ESP32Time.h>
+#include <SD.h>
+#include <ina3221.h>
+#include <dirent.h>
+#include <random>
+#include <sys/stat.h>
+#include <vector>
+
+// ----- INA3221 inputs ----- //
+//
+// A waveform per channel, t is the simulated time:
+//   off                                   nothing connected
+//   dc:<V>:<mA>                           constant load
+//   pulse:<V>:<low mA>:<high mA>:<period ms>:<duty %>
+//   sine:<V>:<mean mA>:<amplitude mA>:<period ms>
+//   csv:<file>                            lines "t_ms,V,mA", held until the next line, repeated after the last
+
+enum sim_wave_type
+{
+  SIM_WAVE_OFF,
+  SIM_WAVE_DC,
+  SIM_WAVE_PULSE,
+  SIM_WAVE_SINE,
+  SIM_WAVE_CSV
+};
+
+struct sim_csv_point
+{
+  double t_ms;
+  float volts;
+  float mA;
+};
+
+struct sim_waveform
+{
+  sim_wave_type type;
+  float volts;
+  float a_mA; // dc, pulse low, sine mean
+  float b_mA; // pulse high, sine amplitude
+  float period_ms;
+  float duty;
+  std::vector<sim_csv_point> points;
+};
+
+static sim_waveform sim_waves[INA3221_CH_NUM] = {
+    {SIM_WAVE_DC, 5.0f, 100.0f, 0, 0, 0, {}},
+    {SIM_WAVE_PULSE, 3.3f, 1.0f, 80.0f, 1000.0f, 0.1f, {}},
+    {SIM_WAVE_SINE, 12.0f, 500.0f, 200.0f, 5000.0f, 0, {}},
+};
+static float sim_noise_mA = 0;
+static uint32_t sim_board_shunt_mohm = 100; // measure_values() expects the shunt_mohm of main.cpp
+static std::mt19937 sim_random(1);
+
+static bool sim_load_csv(const char *path, std::vector<sim_csv_point> &points)
+{
+  FILE *file = fopen(path, "r");
+  char line[256];
+  if (file == NULL)
+  {
+    return false;
+  }
+  points.clear();
+  while (fgets(line, sizeof(line), file))
+  {
+    sim_csv_point point;
+    if (sscanf(line, "%lf,%f,%f", &point.t_ms, &point.volts, &point.mA) == 3)
+    {
+      points.push_back(point);
+    }
+  }
+  fclose(file);
+  return !points.empty();
+}
+
+bool sim_ina_waveform(int channel, const char *spec)
+{
+  sim_waveform wave = {SIM_WAVE_OFF, 0, 0, 0, 0, 0, {}};
+  float duty = 0;
+
+  if (channel < 0 || channel >= INA3221_CH_NUM)
+  {
+    return false;
+  }
+  if (strcmp(spec, "off") == 0)
+  {
+  }
+  else if (sscanf(spec, "dc:%f:%f", &wave.volts, &wave.a_mA) == 2)
+  {
+    wave.type = SIM_WAVE_DC;
+  }
+  else if (sscanf(spec, "pulse:%f:%f:%f:%f:%f", &wave.volts, &wave.a_mA, &wave.b_mA, &wave.period_ms, &duty) == 5 &&
+           wave.period_ms > 0)
+  {
+    wave.type = SIM_WAVE_PULSE;
+    wave.duty = duty / 100;
+  }
+  else if (sscanf(spec, "sine:%f:%f:%f:%f", &wave.volts, &wave.a_mA, &wave.b_mA, &wave.period_ms) == 4 &&
+           wave.period_ms > 0)
+  {
+    wave.type = SIM_WAVE_SINE;
+  }
+  else if (strncmp(spec, "csv:", 4) == 0 && sim_load_csv(spec + 4, wave.points))
+  {
+    wave.type = SIM_WAVE_CSV;
+  }
+  else
+  {
+    return false;
+  }
+  sim_waves[channel] = wave;
+  return true;
+}
+
+void sim_ina_noise(float mA)
+{
+  sim_noise_mA = mA;
+}
+
+void sim_ina_shunt(uint32_t mohm)
+{
+  sim_board_shunt_mohm = mohm;
+}
+
+static void sim_wave_at(const sim_waveform &wave, double t_ms, float &volts, float &mA)
+{
+  volts = wave.volts;
+  if (wave.type == SIM_WAVE_DC)
+  {
+    mA = wave.a_mA;
+  }
+  else if (wave.type == SIM_WAVE_PULSE)
+  {
+    mA = fmod(t_ms, wave.period_ms) < wave.period_ms * wave.duty ? wave.b_mA : wave.a_mA;
+  }
+  else if (wave.type == SIM_WAVE_SINE)
+  {
+    mA = wave.a_mA + wave.b_mA * sin(2 * M_PI * t_ms / wave.period_ms);
+  }
+  else if (wave.type == SIM_WAVE_CSV)
+  {
+    double span = wave.points.back().t_ms - wave.points.front().t_ms;
+    double t = wave.points.front().t_ms + (span > 0 ? fmod(t_ms, span) : 0);
+    size_t i = 0;
+    while (i + 1 < wave.points.size() && wave.points[i + 1].t_ms <= t)
+    {
+      i++;
+    }
+    volts = wave.points[i].volts;
+    mA = wave.points[i].mA;
+  }
+  else
+  {
+    volts = 0;
+    mA = 0;
+  }
+}
+
+void INA3221::reset()
+{
+  averaging = INA3221_REG_CONF_AVG_1;
+  for (int ch = 0; ch < INA3221_CH_NUM; ch++)
+  {
+    enabled[ch] = true;
+  }
+}
+
+void INA3221::setShuntRes(uint32_t res_ch1, uint32_t res_ch2, uint32_t res_ch3)
+{
+  shunt_res[0] = res_ch1;
+  shunt_res[1] = res_ch2;
+  shunt_res[2] = res_ch3;
+}
+
+void INA3221::setFilterRes(uint32_t res_ch1, uint32_t res_ch2, uint32_t res_ch3)
+{
+  filter_res[0] = res_ch1;
+  filter_res[1] = res_ch2;
+  filter_res[2] = res_ch3;
+}
+
+int32_t INA3221::getShuntVoltage(ina3221_ch_t channel)
+{
+  const int samples[8] = {1, 4, 16, 64, 128, 256, 512, 1024};
+  float volts;
+  float mA;
+
+  if (!enabled[channel])
+  {
+    return 0;
+  }
+  sim_wave_at(sim_waves[channel], sim_time_us() / 1000.0, volts, mA);
+  if (sim_noise_mA > 0)
+  {
+    std::normal_distribution<float> noise(0, sim_noise_mA / sqrtf(samples[averaging]));
+    mA += noise(sim_random);
+  }
+  // mA * mOhm = uV, the register has a 40uV LSB and a +-163.8mV range
+  long lsb = lroundf(mA * sim_board_shunt_mohm / 40);
+  lsb = lsb > 4095 ? 4095 : (lsb < -4096 ? -4096 : lsb);
+  return lsb * 40;
+}
+
+float INA3221::getCurrent(ina3221_ch_t channel)
+{
+  int32_t shunt_uV = getShuntVoltage(channel);
+  return shunt_uV / (int32_t)shunt_res[channel] / 1000.0; // the integer division of the library
+}
+
+float INA3221::getVoltage(ina3221_ch_t channel)
+{
+  float volts;
+  float mA;
+
+  if (!enabled[channel])
+  {
+    return 0;
+  }
+  sim_wave_at(sim_waves[channel], sim_time_us() / 1000.0, volts, mA);
+  long lsb = lroundf(volts / 0.008f); // 8mV LSB, 0..26V
+  lsb = lsb > 3250 ? 3250 : (lsb < 0 ? 0 : lsb);
+  return lsb * 8 / 1000.0;
+}
+
+// ----- SD card in a host directory ----- //
+SDFS SD;
+
+static std::string sim_sd_dir = "sim_sd";
+static bool sim_sd_present = true;
+
+void sim_sd_root(const char *path, bool present)
+{
+  sim_sd_dir = path;
+  sim_sd_present = present;
+}
+
+bool SDFS::begin(uint8_t ss, SPIClass &spi, uint32_t frequency, const char *mountpoint, uint8_t max_files,
+                 bool format_if_empty)
+{
+  if (!sim_sd_present)
+  {
+    return false;
+  }
+  ::mkdir(sim_sd_dir.c_str(), 0755);
+  struct stat info;
+  mounted = stat(sim_sd_dir.c_str(), &info) == 0 && S_ISDIR(info.st_mode);
+  root = sim_sd_dir;
+  return mounted;
+}
+
+uint64_t SDFS::totalBytes()
+{
+  return mounted ? 4ULL << 30 : 0;
+}
+
+uint64_t SDFS::usedBytes()
+{
+  return 0;
+}
+
+namespace fs
+{
+
+struct FileImpl
+{
+  FILE *file = NULL;
+  DIR *dir = NULL;
+  std::string path; // on the card
+  std::string host; // on the host
+  ~FileImpl()
+  {
+    if (file)
+    {
+      fclose(file);
+    }
+    if (dir)
+    {
+      closedir(dir);
+    }
+  }
+};
+
+std::string FS::host_path(const char *path) const
+{
+  return root + (path[0] == '/' ? "" : "/") + path;
+}
+
+File FS::open(const char *path, const char *mode, bool create)
+{
+  if (!mounted)
+  {
+    return File();
+  }
+  std::shared_ptr<FileImpl> impl = std::make_shared<FileImpl>();
+  impl->path = path;
+  impl->host = host_path(path);
+  struct stat info;
+  if (strcmp(mode, FILE_READ) == 0 && stat(impl->host.c_str(), &info) == 0 && S_ISDIR(info.st_mode))
+  {
+    impl->dir = opendir(impl->host.c_str());
+  }
+  else
+  {
+    impl->file = fopen(impl->host.c_str(), strcmp(mode, FILE_READ) == 0 ? "rb" : (mode[0] == 'a' ? "ab" : "wb"));
+  }
+  return impl->file || impl->dir ? File(impl) : File();
+}
+
+bool FS::exists(const char *path)
+{
+  struct stat info;
+  return mounted && stat(host_path(path).c_str(), &info) == 0;
+}
+
+bool FS::remove(const char *path)
+{
+  return mounted && ::remove(host_path(path).c_str()) == 0;
+}
+
+bool FS::rename(const char *from, const char *to)
+{
+  return mounted && ::rename(host_path(from).c_str(), host_path(to).c_str()) == 0;
+}
+
+bool FS::mkdir(const char *path)
+{
+  return mounted && ::mkdir(host_path(path).c_str(), 0755) == 0;
+}
+
+File::operator bool() const
+{
+  return impl != NULL;
+}
+
+void File::close()
+{
+  impl.reset();
+}
+
+size_t File::size() const
+{
+  struct stat info;
+  if (impl && impl->file)
+  {
+    fflush(impl->file);
+    return fstat(fileno(impl->file), &info) == 0 ? info.st_size : 0;
+  }
+  return 0;
+}
+
+size_t File::position() const
+{
+  return impl && impl->file ? ftell(impl->file) : 0;
+}
+
+bool File::seek(uint32_t pos, SeekMode mode)
+{
+  return impl && impl->file && fseek(impl->file, pos, mode == SeekSet ? SEEK_SET : (mode == SeekCur ? SEEK_CUR : SEEK_END)) == 0;
+}
+
+const char *File::name() const
+{
+  if (!impl)
+  {
+    return "";
+  }
+  size_t slash = impl->path.rfind('/');
+  return impl->path.c_str() + (slash == std::string::npos ? 0 : slash + 1);
+}
+
+const char *File::path() const
+{
+  return impl ? impl->path.c_str() : "";
+}
+
+bool File::isDirectory() const
+{
+  return impl && impl->dir;
+}
+
+File File::openNextFile(const char *mode)
+{
+  struct dirent *entry;
+  if (!impl || !impl->dir)
+  {
+    return File();
+  }
+  while ((entry = readdir(impl->dir)) != NULL)
+  {
+    if (strcmp(entry->d_name, ".") != 0 && strcmp(entry->d_name, "..") != 0)
+    {
+      std::string child = impl->path + (impl->path.back() == '/' ? "" : "/") + entry->d_name;
+      return SD.open(child.c_str(), mode);
+    }
+  }
+  return File();
+}
+
+void File::rewindDirectory()
+{
+  if (impl && impl->dir)
+  {
+    rewinddir(impl->dir);
+  }
+}
+
+time_t File::getLastWrite()
+{
+  struct stat info;
+  return impl && stat(impl->host.c_str(), &info) == 0 ? info.st_mtime : 0;
+}
+
+int File::available()
+{
+  return impl && impl->file ? size() - position() : 0;
+}
+
+int File::read()
+{
+  return impl && impl->file ? fgetc(impl->file) : -1;
+}
+
+int File::peek()
+{
+  int c = read();
+  if (c >= 0)
+  {
+    ungetc(c, impl->file);
+  }
+  return c;
+}
+
+size_t File::read(uint8_t *buffer, size_t size)
+{
+  return impl && impl->file ? fread(buffer, 1, size, impl->file) : 0;
+}
+
+void File::flush()
+{
+  if (impl && impl->file)
+  {
+    fflush(impl->file);
+  }
+}
+
+size_t File::write(uint8_t c)
+{
+  return impl && impl->file ? fwrite(&c, 1, 1, impl->file) : 0;
+}
+
+size_t File::write(const uint8_t *buffer, size_t size)
+{
+  return impl && impl->file ? fwrite(buffer, 1, size, impl->file) : 0;
+}
+
+} // namespace fs
+
+// ----- TFT: counts what would be sent over SPI ----- //
+static sim_tft_stats sim_tft;
+
+sim_tft_stats sim_tft_read()
+{
+  return sim_tft;
+}
+
+size_t Adafruit_GFX::write(uint8_t c)
+{
+  if (c == '\n')
+  {
+    cursor_x = 0;
+    cursor_y += 8 * text_size;
+  }
+  else if (c != '\r')
+  {
+    // 6x8 cell with background, drawn as one window per character
+    sim_tft.chars++;
+    sim_tft.windows++;
+    sim_tft.pixels += 48 * text_size * text_size;
+    cursor_x += 6 * text_size;
+  }
+  return 1;
+}
+
+void Adafruit_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+  int16_t x1 = x + w < screen_width ? x + w : screen_width;
+  int16_t y1 = y + h < screen_height ? y + h : screen_height;
+  x = x < 0 ? 0 : x;
+  y = y < 0 ? 0 : y;
+  if (x1 > x && y1 > y)
+  {
+    sim_tft.windows++;
+    sim_tft.pixels += (uint32_t)(x1 - x) * (y1 - y);
+  }
+}
+
+void Adafruit_GFX::setRotation(uint8_t rotation)
+{
+  screen_width = rotation & 1 ? raw_height : raw_width;
+  screen_height = rotation & 1 ? raw_width : raw_height;
+}
+
+void Adafruit_SPITFT::setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+  sim_tft.windows++;
+}
+
+void Adafruit_SPITFT::writePixels(uint16_t *colors, uint32_t len, bool block, bool big_endian)
+{
+  sim_tft.pixels += len;
+}
+
+void Adafruit_SPITFT::enableSleep(bool enable)
+{
+  sim_power_panel(!enable);
+}
+
+// ----- RTC on the simulated clock ----- //
+static int64_t sim_rtc_offset_us = 0; // epoch minus simulated time, 1970 at power-on like the chip
+
+void ESP32Time::setTime(unsigned long epoch, int ms)
+{
+  sim_rtc_offset_us = (int64_t)epoch * 1000000 + (int64_t)ms * 1000 - (int64_t)sim_time_us();
+}
+
+unsigned long ESP32Time::getEpoch()
+{
+  return (sim_time_us() + sim_rtc_offset_us) / 1000000;
+}
+
+unsigned long ESP32Time::getMillis()
+{
+  return (sim_time_us() + sim_rtc_offset_us) / 1000 % 1000;
+}
+
+String ESP32Time::getTime()
+{
+  return getTime("%H:%M:%S");
+}
+
+String ESP32Time::getTime(String format)
+{
+  struct tm t = getTimeStruct();
+  char text[64];
+
+  strftime(text, sizeof(text), format.c_str(), &t);
+  return String(text);
+}
+
+struct tm ESP32Time::getTimeStruct()
+{
+  time_t now = getEpoch() + offset;
+  struct tm t;
+
+  gmtime_r(&now, &t);
+  return t;
+}
@@ -0,0 +1,150 @@
+#include "alloc_watch.h"
+
+static portMUX_TYPE alloc_lock = portMUX_INITIALIZER_UNLOCKED; // loop() and the SD writer enter and leave
+static TaskHandle_t alloc_tasks[ALLOC_WATCH_TASKS];             // tasks inside a watched section
+static volatile int alloc_active = 0;
+static volatile bool alloc_setup_done = false;
+static alloc_watch_stats alloc_stats;
+
+void alloc_watch_enter()
+{
+  TaskHandle_t task = xTaskGetCurrentTaskHandle();
+  portENTER_CRITICAL(&alloc_lock);
+  for (int i = 0; i < ALLOC_WATCH_TASKS; i++)
+  {
+    if (alloc_tasks[i] == NULL)
+    {
+      alloc_tasks[i] = task;
+      alloc_active = alloc_active + 1;
+      break;
+    }
+  }
+  portEXIT_CRITICAL(&alloc_lock);
+}
+
+void alloc_watch_leave()
+{
+  TaskHandle_t task = xTaskGetCurrentTaskHandle();
+  portENTER_CRITICAL(&alloc_lock);
+  for (int i = 0; i < ALLOC_WATCH_TASKS; i++)
+  {
+    if (alloc_tasks[i] == task)
+    {
+      alloc_tasks[i] = NULL;
+      alloc_active = alloc_active - 1;
+      break;
+    }
+  }
+  portEXIT_CRITICAL(&alloc_lock);
+}
+
+void alloc_watch_setup_done()
+{
+  alloc_setup_done = true;
+}
+
+alloc_watch_stats alloc_watch_read()
+{
+  portENTER_CRITICAL(&alloc_lock);
+  alloc_watch_stats stats = alloc_stats;
+  portEXIT_CRITICAL(&alloc_lock);
+  return stats;
+}
+
+#if ALLOC_WATCH
+// Called for every allocation, so it only counts: no output
+static void alloc_note(size_t size, void *caller)
+{
+  if (alloc_setup_done == false)
+  {
+    return;
+  }
+  TaskHandle_t task = xTaskGetCurrentTaskHandle();
+  bool watched = false;
+  portENTER_CRITICAL(&alloc_lock);
+  alloc_stats.after_setup = alloc_stats.after_setup + 1;
+  for (int i = 0; i < ALLOC_WATCH_TASKS && alloc_active > 0; i++)
+  {
+    if (alloc_tasks[i] == task)
+    {
+      if (alloc_stats.count == 0)
+      {
+        alloc_stats.first_size = size;
+        alloc_stats.first_caller = caller;
+      }
+      alloc_stats.count = alloc_stats.count + 1;
+      watched = true;
+      break;
+    }
+  }
+  portEXIT_CRITICAL(&alloc_lock);
+  if (ALLOC_WATCH >= 2 && watched)
+  {
+    abort();
+  }
+}
+
+extern "C"
+{
+  void *__real_malloc(size_t size);
+  void *__real_calloc(size_t count, size_t size);
+  void *__real_realloc(void *pointer, size_t size);
+
+  void *__wrap_malloc(size_t size)
+  {
+    alloc_note(size, __builtin_return_address(0));
+    return __real_malloc(size);
+  }
+
+  void *__wrap_calloc(size_t count, size_t size)
+  {
+    alloc_note(count * size, __builtin_return_address(0));
+    return __real_calloc(count, size);
+  }
+
+  void *__wrap_realloc(void *pointer, size_t size)
+  {
+    alloc_note(size, __builtin_return_address(0));
+    return __real_realloc(pointer, size);
+  }
+}
+
+// operator new of a shared libstdc++ (the native build) does not go through the wrapped malloc
+void *operator new(size_t size)
+{
+  alloc_note(size, __builtin_return_address(0));
+  void *pointer = __real_malloc(size);
+  if (pointer == NULL)
+  {
+    abort();
+  }
+  return pointer;
+}
+
+void *operator new[](size_t size)
+{
+  return operator new(size);
+}
+
+void operator delete(void *pointer) noexcept
+{
+  free(pointer);
+}
+
+void operator delete[](void *pointer) noexcept
+{
+  free(pointer);
+}
+
+void operator delete(void *pointer, size_t size) noexcept
+{
+  (void)size;
+  free(pointer);
+}
+
+void operator delete[](void *pointer, size_t size) noexcept
+{
+  (void)size;
+  free(pointer);
+}
+#endif
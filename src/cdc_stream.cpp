@@ -0,0 +1,112 @@
+#include "cdc_stream.h"
+
+#define CDC_MAX_PAYLOAD (CDC_SAMPLE_PAYLOAD + CHANNELS * CDC_CHANNEL_PAYLOAD)
+#define CDC_TX_TIMEOUT_MS 100 // default of the USB CDC, restored when the stream stops
+
+cdc_console_print cdc_console;
+
+static bool cdc_active = false;
+static uint32_t cdc_dropped = 0;
+
+void cdc_stream_start()
+{
+  cdc_dropped = 0;
+  Serial.setTxTimeoutMs(0); // never wait for a host that stopped reading
+  cdc_active = true;
+}
+
+void cdc_stream_stop()
+{
+  cdc_active = false;
+  Serial.setTxTimeoutMs(CDC_TX_TIMEOUT_MS);
+}
+
+bool cdc_streaming()
+{
+  return cdc_active;
+}
+
+uint32_t cdc_stream_dropped()
+{
+  return cdc_dropped;
+}
+
+// ----- Header and CRC around the payload at frame + CDC_HEADER, false if the USB buffer had no room ----- //
+static bool cdc_send(uint8_t *frame, uint8_t type, size_t payload)
+{
+  size_t len = CDC_HEADER + payload;
+  frame[0] = CDC_SYNC_1;
+  frame[1] = CDC_SYNC_2;
+  frame[2] = type;
+  frame[3] = payload;
+  uint16_t crc = cdc_crc16(frame + 2, len - 2);
+  frame[len++] = crc & 0xFF;
+  frame[len++] = crc >> 8;
+
+  // A frame is written completely or not at all
+  if ((size_t)Serial.availableForWrite() < len)
+  {
+    return false;
+  }
+  Serial.write(frame, len);
+  return true;
+}
+
+void cdc_stream_sample(const log_sample &sample)
+{
+  uint8_t frame[CDC_HEADER + CDC_MAX_PAYLOAD + CDC_CRC];
+  size_t len = CDC_HEADER;
+
+  if (!cdc_active)
+  {
+    return;
+  }
+
+  memcpy(frame + len, &sample.seq, 4);
+  len += 4;
+  uint32_t time_us = sample.time_us; // the low 32 bits are enough to space the samples
+  memcpy(frame + len, &time_us, 4);
+  len += 4;
+  frame[len++] = sample.channel_mask;
+  for (int ch = 0; ch < CHANNELS; ch++)
+  {
+    if (sample.channel_mask & (1 << ch))
+    {
+      memcpy(frame + len, &sample.load_voltage[ch], 4);
+      memcpy(frame + len + 4, &sample.current_mA[ch], 4);
+      memcpy(frame + len + 8, &sample.energy[ch], 4);
+      memcpy(frame + len + 12, &sample.capacity[ch], 4);
+      len += 16;
+    }
+  }
+
+  // The sequence number tells the host about a dropped frame
+  if (!cdc_send(frame, CDC_TYPE_SAMPLE, len - CDC_HEADER))
+  {
+    cdc_dropped++;
+  }
+}
+
+// ----- Console text, wrapped in text frames while streaming ----- //
+size_t cdc_console_print::write(uint8_t c)
+{
+  return write(&c, 1);
+}
+
+size_t cdc_console_print::write(const uint8_t *buffer, size_t size)
+{
+  if (!cdc_active)
+  {
+    return Serial.write(buffer, size);
+  }
+
+  uint8_t frame[CDC_HEADER + CDC_TEXT_PAYLOAD + CDC_CRC];
+  for (size_t sent = 0; sent < size;)
+  {
+    size_t len = size - sent < CDC_TEXT_PAYLOAD ? size - sent : CDC_TEXT_PAYLOAD;
+    memcpy(frame + CDC_HEADER, buffer + sent, len);
+    cdc_send(frame, CDC_TYPE_TEXT, len); // dropped like a sample rather than blocking
+    sent += len;
+  }
+  return size;
+}
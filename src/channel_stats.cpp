@@ -0,0 +1,158 @@
+#include "channel_stats.h"
+
+const float stats_quantile_p[STATS_QUANTILES] = {0.5f, 0.9f, 0.99f};
+
+static void running_add(running_stats &s, float x)
+{
+  if (s.count == 0)
+  {
+    s.min = x;
+    s.max = x;
+  }
+  s.min = x < s.min ? x : s.min;
+  s.max = x > s.max ? x : s.max;
+  s.count = s.count + 1;
+  double delta = x - s.mean;
+  s.mean = s.mean + delta / s.count;
+  s.m2 = s.m2 + delta * (x - s.mean);
+}
+
+float stats_mean(const running_stats &s)
+{
+  return s.mean;
+}
+
+float stats_stddev(const running_stats &s)
+{
+  return s.count > 0 ? sqrt(s.m2 / s.count) : 0;
+}
+
+float stats_rms(const running_stats &s)
+{
+  return s.count > 0 ? sqrt(s.mean * s.mean + s.m2 / s.count) : 0;
+}
+
+// ----- P-square: count is the number of samples before x ----- //
+static void p2_add(p2_quantile &q, float p, float x, uint32_t count)
+{
+  if (count < 5)
+  {
+    q.height[count] = x;
+    if (count == 4)
+    {
+      // Five samples: sort them into the markers
+      for (int i = 1; i < 5; i++)
+      {
+        for (int j = i; j > 0 && q.height[j - 1] > q.height[j]; j--)
+        {
+          float t = q.height[j];
+          q.height[j] = q.height[j - 1];
+          q.height[j - 1] = t;
+        }
+      }
+      for (int i = 0; i < 5; i++)
+      {
+        q.position[i] = i;
+      }
+      q.desired[0] = 0;
+      q.desired[1] = 2 * p;
+      q.desired[2] = 4 * p;
+      q.desired[3] = 2 + 2 * p;
+      q.desired[4] = 4;
+    }
+    return;
+  }
+
+  // Cell of x, the outer markers follow the extremes
+  int k;
+  if (x < q.height[0])
+  {
+    q.height[0] = x;
+    k = 0;
+  }
+  else if (x >= q.height[4])
+  {
+    q.height[4] = x;
+    k = 3;
+  }
+  else
+  {
+    k = 0;
+    while (x >= q.height[k + 1])
+    {
+      k++;
+    }
+  }
+  for (int i = k + 1; i < 5; i++)
+  {
+    q.position[i] = q.position[i] + 1;
+  }
+  const float increment[5] = {0, p / 2, p, (1 + p) / 2, 1};
+  for (int i = 0; i < 5; i++)
+  {
+    q.desired[i] = q.desired[i] + increment[i];
+  }
+
+  // Move the middle markers that are a position or more off, parabolic if that keeps the order
+  for (int i = 1; i < 4; i++)
+  {
+    float d = q.desired[i] - q.position[i];
+    int right = q.position[i + 1] - q.position[i];
+    int left = q.position[i - 1] - q.position[i];
+    if ((d >= 1 && right > 1) || (d <= -1 && left < -1))
+    {
+      int s = d >= 0 ? 1 : -1;
+      float n_prev = q.position[i - 1];
+      float n = q.position[i];
+      float n_next = q.position[i + 1];
+      float h = q.height[i] + s / (n_next - n_prev) *
+                                  ((n - n_prev + s) * (q.height[i + 1] - q.height[i]) / (n_next - n) +
+                                   (n_next - n - s) * (q.height[i] - q.height[i - 1]) / (n - n_prev));
+      if (h <= q.height[i - 1] || h >= q.height[i + 1])
+      {
+        h = q.height[i] + s * (q.height[i + s] - q.height[i]) / (q.position[i + s] - q.position[i]);
+      }
+      q.height[i] = h;
+      q.position[i] = q.position[i] + s;
+    }
+  }
+}
+
+float stats_quantile(const channel_stats &stats, int i)
+{
+  const p2_quantile &q = stats.current_quantile[i];
+  uint32_t count = stats.current_mA.count;
+  if (count >= 5)
+  {
+    return q.height[2];
+  }
+  if (count == 0)
+  {
+    return 0;
+  }
+  // Fewer than five samples: the nearest rank of the sorted samples
+  float sorted[5];
+  for (uint32_t a = 0; a < count; a++)
+  {
+    sorted[a] = q.height[a];
+    for (uint32_t b = a; b > 0 && sorted[b - 1] > sorted[b]; b--)
+    {
+      float t = sorted[b];
+      sorted[b] = sorted[b - 1];
+      sorted[b - 1] = t;
+    }
+  }
+  return sorted[(int)(stats_quantile_p[i] * (count - 1) + 0.5f)];
+}
+
+void stats_add(channel_stats &stats, const channel_state &ch)
+{
+  uint32_t count = stats.current_mA.count;
+  for (int i = 0; i < STATS_QUANTILES; i++)
+  {
+    p2_add(stats.current_quantile[i], stats_quantile_p[i], ch.current_mA, count);
+  }
+  running_add(stats.load_voltage, ch.load_voltage);
+  running_add(stats.current_mA, ch.current_mA);
+  running_add(stats.power_mW, ch.load_voltage * ch.current_mA);
+}
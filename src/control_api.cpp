@@ -0,0 +1,332 @@
+#include "control_api.h"
+#include "metrics.h"
+#include "cdc_stream.h"
+#include <ArduinoJson.h>
+
+#define CONTROL_TASK_STACK 4096
+#define CONTROL_TASK_PRIORITY 1
+#define CONTROL_SERIAL_POLL_MS 20
+
+const uint8_t control_averaging_samples[5] = {1, 4, 16, 64, 128};
+
+static QueueHandle_t control_queue = NULL;
+static QueueHandle_t control_event_queue = NULL;
+static uint8_t control_wake_event = 0;
+static SemaphoreHandle_t control_lock = NULL;     // one command at a time
+static SemaphoreHandle_t control_answered = NULL;
+static char control_reply[CONTROL_REPLY_SIZE];
+
+static const char *const control_names[] = {"status", "start", "stop", "reset", "config", "stream"};
+
+// ----- The optional settings of "config" and of /config.json ----- //
+static bool control_parse_settings(StaticJsonDocument<CONTROL_JSON_SIZE> &doc, control_command &command, char *error,
+                                   size_t size)
+{
+  if (doc.containsKey("channels"))
+  {
+    JsonArray channels = doc["channels"];
+    for (JsonVariant channel : channels)
+    {
+      int number = channel | 0;
+      if (number < 1 || number > CHANNELS)
+      {
+        snprintf(error, size, "channels are 1..%d", CHANNELS);
+        return false;
+      }
+      command.channel_mask |= 1 << (number - 1);
+    }
+    if (command.channel_mask == 0)
+    {
+      snprintf(error, size, "no channel enabled");
+      return false;
+    }
+    command.fields |= CONTROL_SET_CHANNELS;
+  }
+
+  if (doc.containsKey("avg"))
+  {
+    int samples = doc["avg"] | 0;
+    for (int i = 0; i < 5; i++)
+    {
+      if (samples == control_averaging_samples[i])
+      {
+        command.averaging = i + 1;
+      }
+    }
+    if (command.averaging == 0)
+    {
+      snprintf(error, size, "avg is 1, 4, 16, 64 or 128");
+      return false;
+    }
+    command.fields |= CONTROL_SET_AVERAGING;
+  }
+
+  if (doc.containsKey("interval"))
+  {
+    long interval = doc["interval"] | 0L;
+    if (interval < 1 || interval > 3600000L)
+    {
+      snprintf(error, size, "interval is 1..3600000 ms");
+      return false;
+    }
+    command.interval_ms = interval;
+    command.fields |= CONTROL_SET_INTERVAL;
+  }
+
+  if (doc.containsKey("shunt"))
+  {
+    JsonArray shunt = doc["shunt"];
+    if (shunt.size() != CHANNELS)
+    {
+      snprintf(error, size, "shunt needs %d values in mOhm", CHANNELS);
+      return false;
+    }
+    for (int ch = 0; ch < CHANNELS; ch++)
+    {
+      long mohm = shunt[ch] | 0L;
+      if (mohm < 1 || mohm > 100000L)
+      {
+        snprintf(error, size, "shunt is 1..100000 mOhm");
+        return false;
+      }
+      command.shunt_mohm[ch] = mohm;
+    }
+    command.fields |= CONTROL_SET_SHUNT;
+  }
+
+  if (doc.containsKey("filter"))
+  {
+    JsonArray filter = doc["filter"];
+    if (filter.size() != CHANNELS)
+    {
+      snprintf(error, size, "filter needs %d values in Ohm", CHANNELS);
+      return false;
+    }
+    for (int ch = 0; ch < CHANNELS; ch++)
+    {
+      long ohm = filter[ch] | -1L;
+      if (ohm < 0 || ohm > 10000L)
+      {
+        snprintf(error, size, "filter is 0..10000 Ohm");
+        return false;
+      }
+      command.filter_ohm[ch] = ohm;
+    }
+    command.fields |= CONTROL_SET_FILTER;
+  }
+
+  if (doc.containsKey("separator") || doc.containsKey("decimals"))
+  {
+    const char *separator = doc["separator"] | ",";
+    int decimals = doc["decimals"] | 2;
+    if (strlen(separator) != 1 || strchr(",;\t", separator[0]) == NULL)
+    {
+      snprintf(error, size, "separator is \",\", \";\" or \"\\t\"");
+      return false;
+    }
+    if (decimals < 0 || decimals > 6)
+    {
+      snprintf(error, size, "decimals is 0..6");
+      return false;
+    }
+    command.separator = separator[0];
+    command.decimals = decimals;
+    command.fields |= CONTROL_SET_FORMAT;
+  }
+
+  if (doc.containsKey("low_power"))
+  {
+    command.low_power = doc["low_power"] | false;
+    command.fields |= CONTROL_SET_LOW_POWER;
+  }
+
+  if (doc.containsKey("sleep_mA") || doc.containsKey("active_mA"))
+  {
+    JsonArray sleep = doc["sleep_mA"];
+    JsonArray active = doc["active_mA"];
+    if (sleep.size() != CHANNELS || active.size() != CHANNELS)
+    {
+      snprintf(error, size, "sleep_mA and active_mA need %d values each", CHANNELS);
+      return false;
+    }
+    for (int ch = 0; ch < CHANNELS; ch++)
+    {
+      float sleep_mA = sleep[ch] | -1.0f;
+      float active_mA = active[ch] | -1.0f;
+      if (sleep_mA < 0 || active_mA < sleep_mA || active_mA > 100000)
+      {
+        snprintf(error, size, "0 <= sleep_mA <= active_mA <= 100000");
+        return false;
+      }
+      command.sleep_mA[ch] = sleep_mA;
+      command.active_mA[ch] = active_mA;
+    }
+    command.fields |= CONTROL_SET_PHASES;
+  }
+  return true;
+}
+
+bool control_parse(const char *json, size_t len, control_command &command, char *error, size_t size)
+{
+  StaticJsonDocument<CONTROL_JSON_SIZE> doc;
+  DeserializationError result = deserializeJson(doc, json, len);
+
+  memset(&command, 0, sizeof(command));
+  if (result)
+  {
+    snprintf(error, size, "%s", result.c_str());
+    return false;
+  }
+
+  const char *name = doc["cmd"] | "";
+  int action = -1;
+  for (int i = 0; i < (int)(sizeof(control_names) / sizeof(control_names[0])); i++)
+  {
+    if (strcmp(name, control_names[i]) == 0)
+    {
+      action = i;
+    }
+  }
+  if (action < 0)
+  {
+    snprintf(error, size, "unknown cmd");
+    return false;
+  }
+  command.action = (control_action)action;
+  command.stream_on = doc["on"] | true;
+  return control_parse_settings(doc, command, error, size);
+}
+
+bool control_parse_config(const char *json, size_t len, control_command &command, bool &autostart, char *error,
+                          size_t size)
+{
+  StaticJsonDocument<CONTROL_JSON_SIZE> doc;
+  DeserializationError result = deserializeJson(doc, json, len);
+
+  memset(&command, 0, sizeof(command));
+  command.action = CONTROL_CONFIG;
+  autostart = false;
+  if (result)
+  {
+    snprintf(error, size, "%s", result.c_str());
+    return false;
+  }
+  autostart = doc["autostart"] | false;
+  return control_parse_settings(doc, command, error, size);
+}
+
+bool control_submit(const control_command &command, char *reply, size_t size)
+{
+  if (control_queue == NULL || xSemaphoreTake(control_lock, pdMS_TO_TICKS(CONTROL_TIMEOUT_MS)) != pdTRUE)
+  {
+    snprintf(reply, size, "{\"ok\":false,\"error\":\"busy\"}");
+    return false;
+  }
+
+  xSemaphoreTake(control_answered, 0); // an answer that came after an earlier timeout
+  xQueueSend(control_queue, &command, 0);
+  xQueueSend(control_event_queue, &control_wake_event, 0);
+  bool answered = xSemaphoreTake(control_answered, pdMS_TO_TICKS(CONTROL_TIMEOUT_MS)) == pdTRUE;
+  if (answered)
+  {
+    snprintf(reply, size, "%s", control_reply);
+  }
+  else
+  {
+    control_command dropped;
+    xQueueReceive(control_queue, &dropped, 0);
+    snprintf(reply, size, "{\"ok\":false,\"error\":\"timeout\"}");
+  }
+  xSemaphoreGive(control_lock);
+  return answered;
+}
+
+bool control_next(control_command &command)
+{
+  return control_queue != NULL && xQueueReceive(control_queue, &command, 0) == pdTRUE;
+}
+
+void control_done(const char *reply)
+{
+  snprintf(control_reply, sizeof(control_reply), "%s", reply);
+  xSemaphoreGive(control_answered);
+}
+
+// ----- One line from the serial port: JSON or the plain stream commands ----- //
+static void control_serial_line(const char *line)
+{
+  control_command command;
+  char error[48];
+  char reply[CONTROL_REPLY_SIZE];
+
+  if (line[0] == '{')
+  {
+    if (!control_parse(line, strlen(line), command, error, sizeof(error)))
+    {
+      cdc_console.printf("{\"ok\":false,\"error\":\"%s\"}\n", error);
+      return;
+    }
+  }
+  else if (strncmp(line, "stream on", 9) == 0 || strcmp(line, "stream off") == 0)
+  {
+    // "stream on 2" also sets the sample interval to 2ms
+    memset(&command, 0, sizeof(command));
+    command.action = CONTROL_STREAM;
+    command.stream_on = line[8] == 'n';
+    command.interval_ms = command.stream_on ? strtoul(line + 9, NULL, 10) : 0;
+    command.fields = command.interval_ms > 0 ? CONTROL_SET_INTERVAL : 0;
+  }
+  else
+  {
+    cdc_console.println("{\"ok\":false,\"error\":\"unknown command\"}");
+    return;
+  }
+
+  control_submit(command, reply, sizeof(reply));
+  cdc_console.println(reply);
+}
+
+static void control_serial_task(void *parameter)
+{
+  char line[CONTROL_LINE_SIZE];
+  size_t len = 0;
+
+  for (;;)
+  {
+    while (Serial.available() > 0)
+    {
+      char c = Serial.read();
+      if (c == '\r' || c == '\n')
+      {
+        line[len] = '\0';
+        if (len > 0)
+        {
+          control_serial_line(line);
+        }
+        len = 0;
+      }
+      else if (len < sizeof(line) - 1)
+      {
+        line[len] = c;
+        len = len + 1;
+      }
+    }
+    vTaskDelay(pdMS_TO_TICKS(CONTROL_SERIAL_POLL_MS));
+  }
+}
+
+void control_begin(QueueHandle_t event_queue, uint8_t wake_event)
+{
+  if (control_queue != NULL)
+  {
+    return;
+  }
+  control_event_queue = event_queue;
+  control_wake_event = wake_event;
+  control_lock = xSemaphoreCreateMutex();
+  control_answered = xSemaphoreCreateBinary();
+  control_queue = xQueueCreate(1, sizeof(control_command));
+  TaskHandle_t task = NULL;
+  xTaskCreate(control_serial_task, "control", CONTROL_TASK_STACK, NULL, CONTROL_TASK_PRIORITY, &task);
+  metrics_task("control", task);
+}
@@ -0,0 +1,62 @@
+#include "load_segment.h"
+
+const char *const load_state_names[LOAD_STATES] = {"sleep", "active"};
+
+static void close_phase(load_segmenter &seg, unsigned long end_ms, load_phase &ended)
+{
+  ended.state = seg.state;
+  ended.start_ms = seg.start_ms;
+  ended.duration_ms = end_ms - seg.start_ms;
+  ended.charge = seg.charge;
+  ended.energy = seg.energy;
+  ended.peak_mA = seg.peak_mA;
+
+  phase_totals &totals = seg.totals[seg.state];
+  totals.phases = totals.phases + 1;
+  totals.time_ms = totals.time_ms + ended.duration_ms;
+  totals.charge = totals.charge + seg.charge;
+  totals.energy = totals.energy + seg.energy;
+}
+
+static void open_phase(load_segmenter &seg, load_state state, unsigned long start_ms)
+{
+  seg.started = true;
+  seg.state = state;
+  seg.start_ms = start_ms;
+  seg.charge = 0;
+  seg.energy = 0;
+  seg.peak_mA = 0;
+}
+
+bool segment_add(load_segmenter &seg, float sleep_mA, float active_mA, float load_voltage, float current_mA,
+                 unsigned long time_ms, unsigned long interval_ms, load_phase &ended)
+{
+  bool changed = false;
+
+  if (seg.started == false)
+  {
+    open_phase(seg, current_mA >= active_mA ? LOAD_ACTIVE : LOAD_SLEEP, time_ms);
+  }
+  else if ((seg.state == LOAD_SLEEP && current_mA >= active_mA) || (seg.state == LOAD_ACTIVE && current_mA < sleep_mA))
+  {
+    close_phase(seg, time_ms, ended);
+    open_phase(seg, seg.state == LOAD_SLEEP ? LOAD_ACTIVE : LOAD_SLEEP, time_ms);
+    changed = true;
+  }
+
+  seg.charge = seg.charge + (current_mA * interval_ms) / 3600000;
+  seg.energy = seg.energy + (load_voltage * current_mA * interval_ms) / 3600000;
+  seg.peak_mA = current_mA > seg.peak_mA ? current_mA : seg.peak_mA;
+  return changed;
+}
+
+bool segment_end(load_segmenter &seg, unsigned long end_ms, load_phase &ended)
+{
+  if (seg.started == false)
+  {
+    return false;
+  }
+  close_phase(seg, end_ms, ended);
+  seg.started = false;
+  return true;
+}
@@ -0,0 +1,65 @@
+#include "loop_bench.h"
+#include "cdc_stream.h"
+#include <algorithm>
+
+struct bench_ring
+{
+  uint32_t cycles[LOOP_BENCH_SAMPLES];
+  uint32_t next;
+  uint32_t count; // runs since the last report
+};
+
+static const char *const bench_names[BENCH_STAGES] = {"sample", "measure", "display", "battery", "sd_write"};
+
+static bench_ring bench_rings[LOOP_BENCH ? BENCH_STAGES : 1];
+static uint32_t bench_sorted[LOOP_BENCH ? LOOP_BENCH_SAMPLES : 1];
+static portMUX_TYPE bench_lock = portMUX_INITIALIZER_UNLOCKED; // sd_write is recorded by the SD writer task
+static unsigned long bench_report_time = 0;
+
+void bench_record(bench_stage stage, uint32_t cycles)
+{
+  bench_ring &ring = bench_rings[stage];
+
+  portENTER_CRITICAL(&bench_lock);
+  ring.cycles[ring.next] = cycles;
+  ring.next = (ring.next + 1) % LOOP_BENCH_SAMPLES;
+  ring.count++;
+  portEXIT_CRITICAL(&bench_lock);
+}
+
+void bench_report()
+{
+  if (!LOOP_BENCH || millis() - bench_report_time < LOOP_BENCH_REPORT_MS)
+  {
+    return;
+  }
+  bench_report_time = millis();
+
+  uint32_t mhz = getCpuFrequencyMhz();
+  cdc_console.printf("bench %luMHz  stage       n     p50     p90     p99     max  cycles\n", (unsigned long)mhz);
+  for (int stage = 0; stage < BENCH_STAGES; stage++)
+  {
+    bench_ring &ring = bench_rings[stage];
+    uint32_t n;
+
+    portENTER_CRITICAL(&bench_lock);
+    n = ring.count < LOOP_BENCH_SAMPLES ? ring.count : LOOP_BENCH_SAMPLES;
+    // the runs since the last report, at most the newest LOOP_BENCH_SAMPLES
+    for (uint32_t i = 0; i < n; i++)
+    {
+      bench_sorted[i] = ring.cycles[(ring.next + LOOP_BENCH_SAMPLES - 1 - i) % LOOP_BENCH_SAMPLES];
+    }
+    ring.count = 0;
+    portEXIT_CRITICAL(&bench_lock);
+
+    if (n == 0)
+    {
+      continue;
+    }
+    std::sort(bench_sorted, bench_sorted + n);
+    cdc_console.printf("bench %luMHz  %-8s %6lu %7lu %7lu %7lu %7lu  (%.1fus p50)\n", (unsigned long)mhz,
+                  bench_names[stage], (unsigned long)n, (unsigned long)bench_sorted[n * 50 / 100],
+                  (unsigned long)bench_sorted[n * 90 / 100], (unsigned long)bench_sorted[n * 99 / 100],
+                  (unsigned long)bench_sorted[n - 1], (double)bench_sorted[n * 50 / 100] / mhz);
+  }
+}
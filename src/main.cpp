@@ -40,9 +40,25 @@ SOFTWARE.
 #include <Adafruit_GFX.h>
 #include <Adafruit_ST7735.h>
 #include <ESP32Time.h>
-#include <NTPClient.h>
-#include <WiFiUdp.h>
-#include "powerlogger_bmp.h"
+#include <esp_sleep.h>
+#include <driver/gpio.h>
+#include <ArduinoJson.h>
+#include "ntp_sync.h"
+#include "numeric_blit.h"
+#include "log_sample.h"
+#include "channel_state.h"
+#include "channel_stats.h"
+#include "load_segment.h"
+#include "web_server.h"
+#include "mqtt_publisher.h"
+#include "cdc_stream.h"
+#include "udp_stream.h"
+#include "metrics.h"
+#include "peer_sync.h"
+#include "control_api.h"
+#include "loop_bench.h"
+#include "alloc_watch.h"
+#include "powerlogger_rle.h" // generated from assets/powerlogger_bmp.h by tools/bmp_rle.py
 
 #ifndef STASSID
 #define STASSID "WIFI"
@@ -103,24 +119,50 @@ unsigned int timeout = 120; // seconds to run for
 // ------- Initialize WiFiManager ------- //
 
 void boot_sequesnce();
+void boot_poll();
+void wifi_prompt();
+void draw_boot_status();
 void setup_menu();
+void draw_menu_header();
+void draw_menu_line(int item);
 void measure_values();
 void displaydata();
-void write_file();
+void draw_data_labels();
+void handle_control_commands();
+const char *execute_command(const control_command &command);
+void format_status(char *reply, size_t size, const char *error);
+void apply_ina_settings();
+void stop_measurement();
+void end_session();
+void send_phase(int ch, load_phase &phase);
+void load_config_file();
+void write_file(const log_sample &sample);
+void write_gap(const log_sample &sample);
+void log_values(const log_sample &sample);
+void log_record(const log_sample &sample);
+void hold_sample(const log_sample &sample);
+void release_samples();
+void log_task(void *parameter);
+void write_summary();
+void write_phases();
+void capture_sample(log_sample &sample);
+void format_log_time(uint64_t time_us, char *date, char *clock);
 void wakeDisplay();
 void sleepDisplay();
+void set_backlight(int pwm);
+void apply_cpu_frequency();
+void idle_until_next_sample();
 void convert_time();
 float get_battery_voltage();
-void create_file();
+void create_file(const log_sample &first);
 void extractIpAddress(char *sourceString, short *ipAddress);
+void draw_rle_bitmap(int16_t x, int16_t y, const uint16_t *palette, const uint8_t *rle, int16_t w, int16_t h);
 
 // ----- Define Variables ----- //
 const char *ssid = STASSID;
 const char *password = STAPSK;
 
 int backlight_pwm = 255; // Start with the display brightness at 100%
-int left_button_flag = 0;
-int right_button_flag = 0;
 int selected = 1;
 int selected_avg = 1;
 int channel_number = 1; // The default channel to display at startup
@@ -128,36 +170,51 @@ int channel_number = 1; // The default channel to display at startup
 static unsigned long last_interrupt_time = 0; // Used in order to debounce the buttons
 unsigned long interrupt_time = 0;             // Used in order to debounce the buttons
 
+// ----- UI events, posted by the interrupts and the command API, consumed by the menus and loop() ----- //
+enum button_event_t : uint8_t
+{
+  BUTTON_LEFT,
+  BUTTON_RIGHT,
+  BUTTON_COMMAND // not a button: a command of the JSON API is waiting (control_api.h)
+};
+#define BUTTON_QUEUE_LENGTH 8
+#define MENU_ITEMS 6    // CH1, CH2, CH3, AVG, PWR, START
+#define MENU_POLL_MS 250 // Menu wakes up this often only while WiFi/NTP are still pending
+QueueHandle_t button_queue = NULL;
+void ICACHE_RAM_ATTR post_button_event_from_isr(button_event_t event);
+void post_button_event(button_event_t event);
+
 bool started = false;
+bool low_power = false;    // Light sleep between samples while the display is off, WiFi is switched off after NTP
 bool display_state = true; // Display is awake when true and sleeping when false
 bool ignore_input = false; // Used in order to ingnore the buttons
+bool stop_requested = false; // Set by the stop command, handled after it was answered
 
 unsigned long previousMillis = 0;
 unsigned long currentMillis = 0;
 unsigned long interval = 200; // Update data on screen and on SD Card every 200ms
 unsigned long display_on_time = 0;
+unsigned long display_time = 0;
+#define DISPLAY_INTERVAL 200 // Fast sample rates still refresh the display at 5Hz only
 unsigned long start_delay = 0;
 
-float shunt_voltage_1 = 0;
-float bus_voltage_1 = 0;
-float current_mA_1 = 0;
-float load_voltage_1 = 0;
-float energy_1 = 0;
-float capacity_1 = 0;
-
-float shunt_voltage_2 = 0;
-float bus_voltage_2 = 0;
-float current_mA_2 = 0;
-float load_voltage_2 = 0;
-float energy_2 = 0;
-float capacity_2 = 0;
-
-float shunt_voltage_3 = 0;
-float bus_voltage_3 = 0;
-float current_mA_3 = 0;
-float load_voltage_3 = 0;
-float energy_3 = 0;
-float capacity_3 = 0;
+// ----- Power management ----- //
+#define DISPLAY_TIMEOUT 30000 // Dim the display after 30s without a button press
+#define LOW_POWER_WIFI_MS 20000        // In low power mode WiFi is switched on for each NTP resync, for at most 20s
+#define LOW_POWER_WIFI_RETRY_MS 300000 // and not again within 5 minutes if the resync failed
+bool wifi_off = false;
+unsigned long wifi_wake_time = 0;
+unsigned long idle_ms = 0; // Time spent idling or in light sleep, reported every minute
+unsigned long idle_report_time = 0;
+// ----- Power management ----- //
+
+channel_state channels[CHANNELS] = {}; // Readings and totals of channel 1..3
+channel_stats stats[CHANNELS] = {};     // Statistics of the session of channel 1..3
+bool stats_page = false;                // LEFT alternates between the values and the statistics of a channel
+load_segmenter segments[CHANNELS] = {}; // Sleep and active phases of the session of channel 1..3
+float sleep_mA[CHANNELS] = {};          // An active channel goes back to sleep below this current
+float active_mA[CHANNELS] = {};         // A sleeping channel turns active at this current, 0 switches phases off
+uint32_t phases_dropped = 0;            // Ended phases of the session the SD writer queue had no room for
 
 float battery_voltage = 0;
 
@@ -165,355 +222,433 @@ bool use_sd_card = true;
 bool use_channel_1 = true;
 bool use_channel_2 = true;
 bool use_channel_3 = true;
+uint32_t shunt_mohm[3] = {CHANNEL_SHUNT_MOHM, CHANNEL_SHUNT_MOHM, CHANNEL_SHUNT_MOHM}; // Shunt resistors of the channels in mOhm
+uint16_t filter_ohm[3] = {10, 10, 10}; // Filter resistors in front of the INA3221 inputs
+char log_separator = ',';              // Column separator of the log file
+uint8_t log_decimals = 2;              // Decimals of the values in the log file
+char file_separator = ',';             // Format and channels of the open log file, only the SD writer task uses them
+uint8_t file_decimals = 2;
+uint8_t file_channel_mask = 0;
 bool setup_error = false;
 bool file_active = false;
 
-String file_name = "/log.txt"; // Default file name in case the is an error with the NTP server
+char file_name[40] = "/log.txt"; // Default file name in case the is an error with the NTP server
+
+// ----- Boot state ----- //
+#define WIFI_CONNECT_TIMEOUT 10000 // Give up on the stored network after 10s
+#define NTP_SYNC_TIMEOUT 10000     // Give up on the time server 10s after WiFi came up
+#define CONFIG_FILE "/config.json"
+#define CONFIG_FILE_SIZE 512       // Longest /config.json that is read
+#define PENDING_SAMPLES 150        // Samples kept in RAM until the time is known, more go to PENDING_FILE
+#define PENDING_FILE "/pending.bin" // Samples taken before the time is known, in blocks of PENDING_SAMPLES
+
+enum boot_status_t
+{
+  BOOT_PENDING,
+  BOOT_OK,
+  BOOT_FAILED
+};
+
+boot_status_t sd_status = BOOT_PENDING;
+boot_status_t wifi_status = BOOT_PENDING;
+boot_status_t time_status = BOOT_PENDING;
+unsigned long wifi_start_time = 0;
+unsigned long ntp_start_time = 0;
+unsigned long first_sample_time = 0;
+uint32_t sample_count = 0; // Samples taken since the measurement was started
+// ----- Boot state ----- //
+
+// ----- SD writer ----- //
+#define LOG_QUEUE_LENGTH 64 // Samples buffered for the SD writer (13s at 200ms)
+#define LOG_FLUSH_MS 1000   // The log file stays open and is flushed once a second
+#define LOG_TASK_STACK 4096
+#define LOG_TASK_PRIORITY 1
+QueueHandle_t log_queue = NULL;
+QueueHandle_t summary_queue = NULL; // Statistics of an ended session, written next to its log file
+#define PHASE_QUEUE_LENGTH 64       // Ended load phases waiting for the SD writer, also until the time is known
+QueueHandle_t phase_queue = NULL;   // Ended load phases, written next to the log file
+File log_file;
+File phase_file;
+uint32_t log_next_seq = 0;         // Sample number the next record of the log file should have
+unsigned long log_last_time_ms = 0; // millis() of the last record
+unsigned long log_session_ms = 0; // Session of the samples the SD writer is at, millis() of its first sample
+bool log_dirty = false;
+unsigned long log_flush_time = 0;
+volatile bool log_busy = false;   // The SD writer is between two waits for samples, possibly on the card
+SemaphoreHandle_t log_idle = NULL; // Given by the SD writer whenever it waits for samples again
+// ----- SD writer ----- //
+
+struct session_summary
+{
+  uint32_t samples;
+  unsigned long duration_ms;
+  uint8_t channel_mask;
+  channel_stats stats[CHANNELS];
+  float energy[CHANNELS];
+  float capacity[CHANNELS];
+  uint8_t phase_mask; // channels with load phases
+  phase_totals phases[CHANNELS][LOAD_STATES];
+  uint32_t phases_dropped;
+};
+unsigned long session_start = 0; // millis() of the first sample of the session
+
+log_sample pending_samples[PENDING_SAMPLES]; // Samples taken before the NTP time was known
+int pending_count = 0;
+File pending_file; // Open while samples were spilled to PENDING_FILE
 
 // ----- Time variables ----- //
 const long utcOffsetInSeconds = 7200;
-unsigned long rtcOffset = 0;
 unsigned long seconds = 0;
 unsigned long minutes = 0;
 unsigned long hours = 0;
 unsigned long days = 0;
 char daysOfTheWeek[7][12] = {"Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday"};
-WiFiUDP ntpUDP;
-NTPClient timeClient(ntpUDP, "pool.ntp.org", utcOffsetInSeconds);
 // ----- Time variables ----- //
 
 void setup()
 {
   Serial.begin(115200);
-  Serial.println("");
+  cdc_console.println("");
+  vTaskPrioritySet(NULL, 2); // Acquisition in loop() goes before the web task
 
   pinMode(TFT_BL, OUTPUT);
-  analogWrite(TFT_BL, backlight_pwm);
+  set_backlight(backlight_pwm);
   pinMode(LEFT_BUTTON_PIN, INPUT);
   pinMode(RIGHT_BUTTON_PIN, INPUT);
 
   Wire.begin(I2C_SDA, I2C_SCL);
+  Wire.setClock(400000); // The INA3221 supports fast mode, needed for ms sample intervals
   SPI.begin(SCK, MISO, MOSI, SDCARD_CS);
 
   ina3221.begin();
   ina3221.reset();
-  ina3221.setShuntRes(10, 10, 10);                  // You must specify the shunt resistor values for calibration (in mOhm)
-  ina3221.setFilterRes(10, 10, 10);                 // You must specify the filter resistor values for calibration (in Ohm)
+  ina3221.setShuntRes(shunt_mohm[0], shunt_mohm[1], shunt_mohm[2]); // You must specify the shunt resistor values for calibration (in mOhm)
+  ina3221.setFilterRes(filter_ohm[0], filter_ohm[1], filter_ohm[2]); // You must specify the filter resistor values for calibration (in Ohm)
   ina3221.setAveragingMode(INA3221_REG_CONF_AVG_1); // The INA module supports internal averaging which is better than using a smooting capacitor
+  ina3221.setWarnAlertCurrentLimit(INA3221_CH1, 1000);
+  ina3221.setCritAlertCurrentLimit(INA3221_CH1, 1500);
 
   // ----- Initiate the TFT display ----- //
   tft.initR();
   tft.setCursor(0, 0);
   tft.setRotation(3);
   tft.fillScreen(background_color);
+  num_blit_init();
 
-  // for (int y = 0; y < 128; y++)
-  // {
-  //   for (int x = 0; x < 160; x++)
-  //   {
-  //     tft.drawPixel(x, y, bitmap[(y * 160) + x]);
-  //   }
-  // }
-  
-  tft.drawRGBBitmap(0,0,powerLogger_bmp,160,128);
+  draw_rle_bitmap(0, 0, powerLogger_palette, powerLogger_rle, powerLogger_width, powerLogger_height);
   // ----- Initiate the TFT display ----- //
 
-  delay(2000);
-
   // ----- Enable Buttons ----- //
+  button_queue = xQueueCreate(BUTTON_QUEUE_LENGTH, sizeof(button_event_t));
   attachInterrupt(digitalPinToInterrupt(LEFT_BUTTON_PIN), handle_left_Interrupt, FALLING);
   attachInterrupt(digitalPinToInterrupt(RIGHT_BUTTON_PIN), handle_right_Interrupt, FALLING);
   // ----- Enable Buttons ----- //
 
-  // ----- Run the startup checks ----- //
-  Serial.println("starting bootsequence...");
+  // ----- Run the startup checks (WiFi and NTP continue in boot_poll) ----- //
+  cdc_console.println("starting bootsequence...");
   boot_sequesnce();
-  // ----- Run the startup checks ----- //
+  // ----- Run the startup checks (WiFi and NTP continue in boot_poll) ----- //
+
+  metrics_task("loop", xTaskGetCurrentTaskHandle());
+  control_begin(button_queue, BUTTON_COMMAND); // JSON commands over serial (and HTTP once WiFi is up)
 
-  delay(2000);
+  // ----- Settings from /config.json, with "autostart" the setup menu is skipped ----- //
+  load_config_file();
+  // ----- Settings from /config.json, with "autostart" the setup menu is skipped ----- //
+
+  // ----- Start the SD writer ----- //
+  log_queue = xQueueCreate(LOG_QUEUE_LENGTH, sizeof(log_sample));
+  summary_queue = xQueueCreate(1, sizeof(session_summary));
+  phase_queue = xQueueCreate(PHASE_QUEUE_LENGTH, sizeof(load_phase));
+  log_idle = xSemaphoreCreateBinary();
+  TaskHandle_t log_task_handle = NULL;
+  xTaskCreate(log_task, "log", LOG_TASK_STACK, NULL, LOG_TASK_PRIORITY, &log_task_handle);
+  metrics_task("log", log_task_handle);
+  // ----- Start the SD writer ----- //
 
   // ----- Run the setup menu ----- //
   setup_menu();
   // ----- Run the setup menu ----- //
 
-  tft.fillScreen(background_color);
+  draw_data_labels();
+  apply_cpu_frequency();
 
   display_on_time = millis();
   start_delay = millis();
+  alloc_watch_setup_done();
 }
 
 void loop()
 {
   currentMillis = millis();
-  analogWrite(TFT_BL, backlight_pwm); // Each loop adjust the brightness of the display
+  set_backlight(backlight_pwm); // Only touches the LEDC when the brightness changed
+  boot_poll();
 
   // ----- Handle measuring and writing data ----- //
   if (currentMillis - previousMillis >= interval)
   {
     if (started)
     {
+      alloc_watch_begin();
+      uint32_t stage_start = micros();
+      uint32_t bench_sample = bench_begin();
+      log_sample sample;
+      if (sample_count == 0)
+      {
+        end_session(); // a reset or a new channel setup started a new log file
+        session_start = currentMillis;
+      }
+      else
+      {
+        metrics_deadline(currentMillis - previousMillis - interval); // the first sample has no deadline
+      }
+      uint32_t bench_measure = bench_begin();
+      uint32_t measure_start = micros();
       measure_values();
+      metrics_measure(micros() - measure_start);
+      bench_end(BENCH_MEASURE, bench_measure);
       previousMillis = currentMillis;
-      displaydata();
-      if (use_sd_card == true)
+      capture_sample(sample);
+      cdc_stream_sample(sample);
+      if (currentMillis - display_time >= DISPLAY_INTERVAL)
       {
-        write_file();
+        uint32_t bench_display = bench_begin();
+        uint32_t display_start = micros();
+        displaydata();
+        metrics_display(micros() - display_start);
+        bench_end(BENCH_DISPLAY, bench_display);
+        display_time = currentMillis;
+      }
+      web_publish(sample);
+      mqtt_publish(sample);
+      alloc_watch_end(); // lwIP takes the buffer of a datagram from the heap
+      udp_stream_sample(sample);
+      alloc_watch_begin();
+      if (use_sd_card == true && xQueueSend(log_queue, &sample, 0) != pdTRUE)
+      {
+        metrics_log_dropped();
+      }
+      metrics_sample(sample, battery_voltage, micros() - stage_start);
+      bench_end(BENCH_SAMPLE, bench_sample);
+      alloc_watch_end();
+      if (first_sample_time == 0)
+      {
+        first_sample_time = currentMillis;
+        cdc_console.printf("first sample %lu ms after power-on, %lu ms after the start\n", first_sample_time,
+                      first_sample_time - start_delay);
       }
     }
   }
   // ----- Handle measuring and writing data ----- //
 
-  // ----- Handle left button being pressed ----- //
-  if (left_button_flag == 1 && display_state == true)
+  // ----- Handle button events ----- //
+  button_event_t event;
+  while (xQueueReceive(button_queue, &event, 0) == pdTRUE)
   {
-    if (started == true)
+    if (event == BUTTON_COMMAND)
     {
-      channel_number = channel_number + 1;
-      if (channel_number == 1 && use_channel_1 == false)
-      {
-        channel_number = channel_number + 1;
-      }
-      if (channel_number == 2 && use_channel_2 == false)
-      {
-        channel_number = channel_number + 1;
-      }
-      if (channel_number == 3 && use_channel_3 == false)
+      handle_control_commands();
+    }
+    else if (display_state == false)
+    {
+      wakeDisplay(); // A press on the dimmed display only wakes it up
+    }
+    else if (event == BUTTON_LEFT && started == true)
+    {
+      // Values of a channel, its statistics, then the next channel
+      stats_page = !stats_page;
+      if (stats_page == false)
       {
         channel_number = channel_number + 1;
-      }
-      if (channel_number > 3)
-      {
-        if (use_channel_1 == false)
+        if (channel_number == 1 && use_channel_1 == false)
+        {
+          channel_number = channel_number + 1;
+        }
+        if (channel_number == 2 && use_channel_2 == false)
+        {
+          channel_number = channel_number + 1;
+        }
+        if (channel_number == 3 && use_channel_3 == false)
+        {
+          channel_number = channel_number + 1;
+        }
+        if (channel_number > 3)
         {
-          if (use_channel_2 == false)
+          if (use_channel_1 == false)
           {
-            channel_number = 3;
+            if (use_channel_2 == false)
+            {
+              channel_number = 3;
+            }
+            else
+            {
+              channel_number = 2;
+            }
           }
           else
           {
-            channel_number = 2;
+            channel_number = 1;
           }
         }
-        else
-        {
-          channel_number = 1;
-        }
       }
+      draw_data_labels();
+    }
+    else if (event == BUTTON_RIGHT)
+    {
+      stop_measurement();
     }
-
-    left_button_flag = 0;
-  }
-  // ----- Handle left button being pressed ----- //
-
-  // ----- Handle right button being pressed ----- //
-  if (right_button_flag == 1 && display_state == true)
-  {
-    started = false;
-    selected = 1;
-    right_button_flag = 0;
-    shunt_voltage_1 = 0;
-    bus_voltage_1 = 0;
-    current_mA_1 = 0;
-    load_voltage_1 = 0;
-    energy_1 = 0;
-    capacity_1 = 0;
-    shunt_voltage_2 = 0;
-    bus_voltage_2 = 0;
-    current_mA_2 = 0;
-    load_voltage_2 = 0;
-    energy_2 = 0;
-    capacity_2 = 0;
-    shunt_voltage_3 = 0;
-    bus_voltage_3 = 0;
-    current_mA_3 = 0;
-    load_voltage_3 = 0;
-    energy_3 = 0;
-    capacity_3 = 0;
-    file_active = false;
-    setup_menu();
-  }
-  // ----- Handle right button being pressed ----- //
-
-  // ----- Wake the display (increase brightness) ----- //
-  if (right_button_flag == 1 && display_state == false)
-  {
-    wakeDisplay();
-    right_button_flag = 0;
   }
-  if (left_button_flag == 1 && display_state == false)
+  if (stop_requested == true)
   {
-    wakeDisplay();
-    left_button_flag = 0;
+    stop_measurement();
   }
-  // ----- Wake the display (increase brightness) ----- //
+  // ----- Handle button events ----- //
 
   // ----- Sleep the display (decrease brightness) ----- //
-  if (millis() - display_on_time > 30000)
+  if (display_state == true && millis() - display_on_time > DISPLAY_TIMEOUT)
   {
     sleepDisplay();
   }
   // ----- Sleep the display (decrease brightness) ----- //
+
+  bench_report();
+  idle_until_next_sample();
+}
+
+// ----- Layout of the data screen: 13 columns x 8 rows of 12x16 pixel cells ----- //
+#define CELL_W NUM_GLYPH_WIDTH
+#define CELL_H NUM_GLYPH_HEIGHT
+#define VALUE_COL 6 // numbers are right aligned in columns 6..12
+#define VALUE_CHARS 7
+
+// ----- Static part of the data screen, drawn once when the screen is entered ----- //
+void draw_data_labels()
+{
+  tft.fillScreen(background_color);
+  tft.setTextSize(2);
+  tft.setTextWrap(false);
+  tft.setTextColor(ST7735_YELLOW, background_color);
+  tft.setCursor(0, 0);
+  tft.print("T:");
+  tft.setTextColor(ST7735_WHITE, background_color);
+  if (stats_page == true)
+  {
+    tft.setCursor(0, CELL_H);
+    tft.println("avg:");
+    tft.println("sd:");
+    tft.println("min:");
+    tft.println("p50:");
+    tft.println("p99:");
+    tft.println("max:");
+    tft.setTextColor(ST7735_RED, background_color);
+    tft.print("CH: mA B:");
+    return;
+  }
+  tft.setTextColor(ST7735_CYAN, background_color);
+  tft.setCursor(0, CELL_H);
+  tft.print("L:");
+  tft.setCursor(7 * CELL_W, CELL_H);
+  tft.print("H:");
+  tft.setTextColor(ST7735_WHITE, background_color);
+  tft.setCursor(0, 2 * CELL_H);
+  tft.println("V:");
+  tft.println("mA:");
+  tft.println("mW:");
+  tft.println("mWh:");
+  tft.println("mAh:");
+  tft.setTextColor(ST7735_RED, background_color);
+  tft.print("CH:    B:");
 }
 
 void displaydata()
 {
-  String current_padding = "";
-  String power_padding = "";
-  String energy_padding = "";
-  String capacity_padding = "";
+  char text[NUM_MAX_CHARS + 1];
   float current_mA = 0;
   float load_voltage = 0;
   float capacity = 0;
   float energy = 0;
-  float bus_voltage = 0;
 
   // ----- Display data of the selected channel ----- //
-  if (channel_number == 1)
+  if (channel_number >= 1 && channel_number <= CHANNELS)
   {
-    bus_voltage = bus_voltage_1;
-    current_mA = current_mA_1;
-    load_voltage = load_voltage_1;
-    energy = energy_1;
-    capacity = capacity_1;
-  }
-  else if (channel_number == 2)
-  {
-    bus_voltage = bus_voltage_2;
-    current_mA = current_mA_2;
-    load_voltage = load_voltage_2;
-    energy = energy_2;
-    capacity = capacity_2;
-  }
-  else if (channel_number == 3)
-  {
-    bus_voltage = bus_voltage_3;
-    current_mA = current_mA_3;
-    load_voltage = load_voltage_3;
-    energy = energy_3;
-    capacity = capacity_3;
+    current_mA = channels[channel_number - 1].current_mA;
+    load_voltage = channels[channel_number - 1].load_voltage;
+    energy = channels[channel_number - 1].energy;
+    capacity = channels[channel_number - 1].capacity;
   }
   // ----- Display data of the selected channel ----- //
 
-  // ----- Some padding so that text is properly aligned ----- //
-  if (current_mA >= 0 && current_mA < 10)
-  {
-    current_padding = "   ";
-  }
-  else if (current_mA >= 10 && current_mA < 100)
-  {
-    current_padding = "  ";
-  }
-  else if (current_mA >= 100 && current_mA < 1000)
-  {
-    current_padding = " ";
-  }
-  else if (current_mA >= 1000 && current_mA < 10000)
-  {
-    current_padding = "";
-  }
-
-  if (load_voltage * current_mA >= 0 && load_voltage * current_mA < 10)
-  {
-    power_padding = "   ";
-  }
-  else if (load_voltage * current_mA >= 10 && load_voltage * current_mA < 100)
-  {
-    power_padding = "  ";
-  }
-  else if (load_voltage * current_mA >= 100 && load_voltage * current_mA < 1000)
-  {
-    power_padding = " ";
-  }
-  else if (load_voltage * current_mA >= 1000 && load_voltage * current_mA < 10000)
-  {
-    power_padding = "";
-  }
+  // ----- Display the data (labels are drawn by draw_data_labels) ----- //
+  convert_time();
+  // dd:hh:mm:ss fills the 11 characters of the field, the days wrap at 100
+  snprintf(text, sizeof(text), "%u:%02u:%02u:%02u", (unsigned)(days % 100), (unsigned)(hours % 24),
+           (unsigned)(minutes % 60), (unsigned)(seconds % 60));
+  num_blit_text(tft, 2 * CELL_W, 0, text, 11, ST7735_YELLOW, background_color);
 
-  if (energy >= 0 && energy < 10)
-  {
-    energy_padding = "   ";
-  }
-  else if (energy >= 10 && energy < 100)
+  if (stats_page == true && channel_number >= 1 && channel_number <= CHANNELS)
   {
-    energy_padding = "  ";
-  }
-  else if (energy >= 100 && energy < 1000)
-  {
-    energy_padding = " ";
+    const channel_stats &s = stats[channel_number - 1];
+    float values[6] = {stats_mean(s.current_mA), stats_stddev(s.current_mA), s.current_mA.min,
+                       stats_quantile(s, 0), stats_quantile(s, 2), s.current_mA.max};
+    for (int row = 0; row < 6; row++)
+    {
+      num_blit_float(tft, VALUE_COL * CELL_W, (row + 1) * CELL_H, values[row], VALUE_CHARS, 2, ST7735_WHITE, background_color);
+    }
   }
-  else if (energy >= 1000 && energy < 10000)
+  else
   {
-    energy_padding = "";
+    num_blit_float(tft, VALUE_COL * CELL_W, 2 * CELL_H, load_voltage, VALUE_CHARS, 2, ST7735_WHITE, background_color);
+    num_blit_float(tft, VALUE_COL * CELL_W, 3 * CELL_H, current_mA, VALUE_CHARS, 2, ST7735_WHITE, background_color);
+    num_blit_float(tft, VALUE_COL * CELL_W, 4 * CELL_H, load_voltage * current_mA, VALUE_CHARS, 2, ST7735_WHITE, background_color);
+    num_blit_float(tft, VALUE_COL * CELL_W, 5 * CELL_H, energy, VALUE_CHARS, 2, ST7735_WHITE, background_color);
+    num_blit_float(tft, VALUE_COL * CELL_W, 6 * CELL_H, capacity, VALUE_CHARS, 2, ST7735_WHITE, background_color);
+
+    // Status line of the runtime health: late samples and the free heap low-water mark in kB
+    snprintf(text, sizeof(text), "%lu", (unsigned long)(metrics_late().count % 10000));
+    num_blit_text(tft, 2 * CELL_W, CELL_H, text, 4, ST7735_CYAN, background_color);
+    snprintf(text, sizeof(text), "%lu", (unsigned long)(ESP.getMinFreeHeap() / 1024 % 10000));
+    num_blit_text(tft, 9 * CELL_W, CELL_H, text, 4, ST7735_CYAN, background_color);
   }
 
-  if (capacity >= 0 && capacity < 10)
-  {
-    capacity_padding = "   ";
-  }
-  else if (capacity >= 10 && capacity < 100)
-  {
-    capacity_padding = "  ";
-  }
-  else if (capacity >= 100 && capacity < 1000)
-  {
-    capacity_padding = " ";
-  }
-  else if (capacity >= 1000 && capacity < 10000)
-  {
-    capacity_padding = "";
-  }
-  // ----- Some padding so that text is properly aligned ----- //
+  snprintf(text, sizeof(text), "%d", channel_number);
+  num_blit_text(tft, 3 * CELL_W, 7 * CELL_H, text, 1, ST7735_RED, background_color);
+  uint32_t bench_battery = bench_begin();
+  battery_voltage = get_battery_voltage();
+  bench_end(BENCH_BATTERY, bench_battery);
+  num_blit_float(tft, 9 * CELL_W, 7 * CELL_H, battery_voltage, 4, 2, ST7735_RED, background_color);
+  // ----- Display the data (labels are drawn by draw_data_labels) ----- //
+}
 
-  // ----- Display the data ----- //
-  tft.setTextSize(2);
-  tft.setTextColor(ST7735_YELLOW, background_color);
-  tft.setCursor(0, 0);
+// ----- Decode a palette/RLE image (see tools/bmp_rle.py) row by row into a line buffer ----- //
+void draw_rle_bitmap(int16_t x, int16_t y, const uint16_t *palette, const uint8_t *rle, int16_t w, int16_t h)
+{
+  static uint16_t line[ST7735_TFTHEIGHT]; // one row of the rotated display (160 pixels)
+  uint16_t color = 0;
+  uint8_t run = 0;
 
-  convert_time();
-  tft.print("T: ");
-  tft.print(days);
-  tft.print(":");
-  if (hours < 10)
+  if (w > ST7735_TFTHEIGHT)
   {
-    tft.print("0");
+    return;
   }
-  tft.print(hours);
-  tft.print(":");
-  if (minutes < 10)
-  {
-    tft.print("0");
-  }
-  tft.print(minutes);
-  tft.print(":");
-  if (seconds < 10)
+
+  tft.startWrite();
+  tft.setAddrWindow(x, y, w, h);
+  for (int16_t row = 0; row < h; row++)
   {
-    tft.print("0");
+    for (int16_t col = 0; col < w; col++)
+    {
+      if (run == 0)
+      {
+        uint8_t token = pgm_read_byte(rle++);
+        color = pgm_read_word(&palette[token & 0x1F]);
+        run = (token >> 5) + 1;
+      }
+      line[col] = color;
+      run--;
+    }
+    tft.writePixels(line, w);
   }
-  tft.println(seconds);
-
-  tft.println("          ");
-
-  tft.setTextColor(ST7735_WHITE, background_color);
-  tft.print("V:       ");
-  tft.println(load_voltage);
-  tft.print("mA:   ");
-  tft.print(current_padding);
-  tft.println(current_mA, 2);
-  tft.print("mW:   ");
-  tft.print(power_padding);
-  tft.println(load_voltage * current_mA, 2);
-  tft.print("mWh:  ");
-  tft.print(energy_padding);
-  tft.println(energy, 2);
-  tft.print("mAh:  ");
-  tft.print(capacity_padding);
-  tft.println(capacity, 2);
-  tft.setTextColor(ST7735_RED, background_color);
-  tft.print("CH:");
-  tft.print(channel_number);
-  tft.print("   B:");
-  tft.print(get_battery_voltage());
-  // ----- Display the data ----- //
+  tft.endWrite();
 }
 
 void convert_time()
@@ -531,397 +666,535 @@ void convert_time()
 
 void sleepDisplay()
 {
-  backlight_pwm = 5;
+  if (low_power == true)
+  {
+    backlight_pwm = 0;
+    tft.enableSleep(true);
+  }
+  else
+  {
+    backlight_pwm = 5;
+  }
   display_state = false;
 }
 
 void wakeDisplay()
 {
+  if (low_power == true)
+  {
+    tft.enableSleep(false);
+  }
   backlight_pwm = 255;
   display_state = true;
 }
 
-void measure_values()
+void set_backlight(int pwm)
 {
-  if (use_channel_1)
-  {
-    shunt_voltage_1 = ina3221.getShuntVoltage(INA3221_CH1); // Value will be returned in uV.
-    bus_voltage_1 = ina3221.getVoltage(INA3221_CH1);
-    current_mA_1 = ina3221.getCurrent(INA3221_CH1) * 100; // Value will be returned in Amps. Adjust if you need mA
-    load_voltage_1 = bus_voltage_1 + (shunt_voltage_1 / 1000000);
-    energy_1 = energy_1 + (load_voltage_1 * current_mA_1 * interval) / 3600000;
-    capacity_1 = capacity_1 + (current_mA_1 * interval) / 3600000;
-  }
-  if (use_channel_2)
+  static int current_pwm = -1;
+  if (pwm != current_pwm)
   {
-    shunt_voltage_2 = ina3221.getShuntVoltage(INA3221_CH2); // Value will be returned in uV.
-    bus_voltage_2 = ina3221.getVoltage(INA3221_CH2);
-    current_mA_2 = ina3221.getCurrent(INA3221_CH2) * 100; // Value will be returned in Amps. Adjust if you need mA
-    load_voltage_2 = bus_voltage_2 + (shunt_voltage_2 / 1000000);
-    energy_2 = energy_2 + (load_voltage_2 * current_mA_2 * interval) / 3600000;
-    capacity_2 = capacity_2 + (current_mA_2 * interval) / 3600000;
+    analogWrite(TFT_BL, pwm);
+    current_pwm = pwm;
   }
-  if (use_channel_3)
+}
+
+// ----- 80MHz is plenty for the I2C/SPI work of slow sample rates, run faster ones at full speed ----- //
+void apply_cpu_frequency()
+{
+  uint32_t mhz = interval >= 100 ? 80 : 160;
+  if (getCpuFrequencyMhz() != mhz)
   {
-    shunt_voltage_3 = ina3221.getShuntVoltage(INA3221_CH3); // Value will be returned in uV.
-    bus_voltage_3 = ina3221.getVoltage(INA3221_CH3);
-    current_mA_3 = ina3221.getCurrent(INA3221_CH3) * 100; // Value will be returned in Amps. Adjust if you need mA
-    load_voltage_3 = bus_voltage_3 + (shunt_voltage_3 / 1000000);
-    energy_3 = energy_3 + (load_voltage_3 * current_mA_3 * interval) / 3600000;
-    capacity_3 = capacity_3 + (current_mA_3 * interval) / 3600000;
+    setCpuFrequencyMhz(mhz);
   }
 }
 
-void boot_sequesnce()
+// ----- Wait for the next sample: light sleep in low power mode, otherwise let the idle task run ----- //
+void idle_until_next_sample()
 {
-  WiFi.mode(WIFI_STA);
-
-  // wifiManager.resetSettings(); reset ESP WiFi Settings for test
-
-  wifiManager.setEnableConfigPortal(false);
-  wifiManager.setConfigPortalBlocking(false);
-
-  wifiManager.autoConnect();
-
-  tft.fillScreen(background_color);
-  tft.setCursor(0, 0);
-  tft.setTextSize(2);
-  tft.setTextColor(ST7735_RED, background_color);
-  tft.setTextWrap(false);
-
-  tft.println("Booting ...");
-  tft.println("");
-  tft.setTextColor(ST7735_WHITE, background_color);
+  unsigned long now = millis();
+  long wait = (long)(previousMillis + interval - now);
 
-  // ----- Check if SD Card is OK ----- //
-  tft.print("SD Card");
-  if (!SD.begin(SDCARD_CS))
+  // Low power mode keeps WiFi off between the NTP resyncs, MQTT and peer sync catch up meanwhile
+  if (low_power == true && wifi_off == false && time_status != BOOT_PENDING &&
+      (ntp_sync_due() == false || now - wifi_wake_time > LOW_POWER_WIFI_MS))
   {
-    Serial.println("Card failed, or not present");
-    tft.setTextColor(ST7735_RED, background_color);
-    tft.println("     X");
-    tft.setTextColor(ST7735_WHITE, background_color);
-    use_sd_card = false;
+    WiFi.disconnect(true);
+    WiFi.mode(WIFI_OFF);
+    wifi_off = true;
   }
-  else
+  else if (wifi_off == true && wifi_status == BOOT_OK &&
+           (low_power == false || (ntp_sync_due() == true && now - wifi_wake_time > LOW_POWER_WIFI_RETRY_MS)))
   {
-    tft.println("    OK");
+    WiFi.mode(WIFI_STA);
+    WiFi.begin();
+    wifi_off = false;
+    wifi_wake_time = now;
   }
-  // ----- Check if SD Card is OK ----- //
-
-  // ----- Wait for WIFI ----- //
-  tft.print("WIFI");
 
-  if (WiFi.status() == WL_CONNECTED)
+  if (now - idle_report_time >= 60000)
   {
-    tft.println("       OK");
+    char health[METRICS_HEALTH_SIZE];
+    int n = snprintf(health, sizeof(health), "idle %lu%% ", idle_ms * 100 / (now - idle_report_time));
+    metrics_health(health + n, sizeof(health) - n);
+    cdc_console.println(health); // printf() of Print would allocate for a line this long
+    idle_ms = 0;
+    idle_report_time = now;
+  }
 
-    tft.setTextSize(1);
-    tft.print("local ip   ");
-    tft.println(WiFi.localIP());
-    delay(100);
+  long udp_due = udp_stream_poll(); // a partial datagram must not wait for the next sample
+  if (udp_due >= 0 && udp_due < wait)
+  {
+    wait = udp_due;
+  }
 
-    Serial.println("local ip  ");
-    Serial.print(WiFi.localIP());
-    Serial.println();
+  if (started == false || wait <= 1 || uxQueueMessagesWaiting(button_queue) > 0)
+  {
+    return;
   }
-  else
+  if (display_state == true && (long)(display_on_time + DISPLAY_TIMEOUT - now) < wait)
   {
-    tft.setTextSize(2);
-    tft.setTextColor(ST7735_RED, background_color);
-    tft.println("        X");
-    tft.setTextColor(ST7735_WHITE, background_color);
-
-    tft.setTextSize(1);
-    tft.println();
-
-    tft.println("start without WIFI SELECT");
-    tft.println("start ConfigPortal MENU");
-
-    while (left_button_flag == 0 && right_button_flag == 0)
+    wait = display_on_time + DISPLAY_TIMEOUT - now + 1; // wake up in time to dim the display
+    if (wait <= 1)
     {
-      Serial.println(left_button_flag);
+      return;
     }
+  }
 
-    if (left_button_flag == 1)
+  if (low_power == true && wifi_off == true && display_state == false &&
+      digitalRead(LEFT_BUTTON_PIN) == HIGH && digitalRead(RIGHT_BUTTON_PIN) == HIGH)
+  {
+    // The SD writer runs below loop() and only gets the CPU while loop() waits. Let it write
+    // the samples first, the chip must not sleep in the middle of an SD transaction.
+    while (log_busy == true || uxQueueMessagesWaiting(log_queue) > 0)
     {
-      Serial.println("Portal Started");
-      tft.println("ConfigPortal started");
-
-      wifiManager.setEnableConfigPortal(true);
-      wifiManager.setConfigPortalBlocking(true);
-
-      if (!wifiManager.startConfigPortal("PowerLogger_Portal"))
+      xSemaphoreTake(log_idle, pdMS_TO_TICKS(wait));
+      wait = (long)(previousMillis + interval - millis());
+      if (wait <= 1)
       {
-        Serial.println("failed to connect and hit timeout");
-        delay(3000);
-        // reset and try again, or maybe put it to deep sleep
-        ESP.restart();
-        delay(5000);
+        idle_ms = idle_ms + (millis() - now);
+        return;
+      }
+    }
+    // The edge interrupts do not fire in light sleep, wake on the button level instead
+    esp_sleep_enable_timer_wakeup((uint64_t)wait * 1000);
+    gpio_wakeup_enable((gpio_num_t)LEFT_BUTTON_PIN, GPIO_INTR_LOW_LEVEL);
+    gpio_wakeup_enable((gpio_num_t)RIGHT_BUTTON_PIN, GPIO_INTR_LOW_LEVEL);
+    esp_sleep_enable_gpio_wakeup();
+    esp_light_sleep_start();
+    gpio_wakeup_disable((gpio_num_t)LEFT_BUTTON_PIN);
+    gpio_wakeup_disable((gpio_num_t)RIGHT_BUTTON_PIN);
+
+    if (esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_GPIO)
+    {
+      if (digitalRead(LEFT_BUTTON_PIN) == LOW)
+      {
+        post_button_event(BUTTON_LEFT);
+      }
+      else if (digitalRead(RIGHT_BUTTON_PIN) == LOW)
+      {
+        post_button_event(BUTTON_RIGHT);
       }
-
-      tft.println();
-      tft.print("local ip   ");
-      tft.println(WiFi.localIP());
-      delay(1000);
-
-      Serial.println("local ip  ");
-      Serial.print(WiFi.localIP());
-      Serial.println();
-      left_button_flag = 0;
     }
+  }
+  else
+  {
+    // Blocks until the timeout or a button event, the idle task halts the CPU meanwhile
+    button_event_t event;
+    xQueuePeek(button_queue, &event, pdMS_TO_TICKS(wait));
+  }
+  idle_ms = idle_ms + (millis() - now);
+}
+
+void measure_values()
+{
+  bool use_channel[CHANNELS] = {use_channel_1, use_channel_2, use_channel_3};
+  const ina3221_ch_t channel[CHANNELS] = {INA3221_CH1, INA3221_CH2, INA3221_CH3};
 
-    if (right_button_flag == 1)
+  for (int ch = 0; ch < CHANNELS; ch++)
+  {
+    if (use_channel[ch])
     {
-      Serial.println("getting on without WiFi");
-      right_button_flag = 0;
+      channel_integrate(channels[ch], ina3221.getShuntVoltage(channel[ch]), // uV
+                        ina3221.getVoltage(channel[ch]), shunt_mohm[ch], interval);
+      stats_add(stats[ch], channels[ch]);
+      load_phase phase;
+      if (active_mA[ch] > 0 && segment_add(segments[ch], sleep_mA[ch], active_mA[ch], channels[ch].load_voltage,
+                                           channels[ch].current_mA, currentMillis, interval, phase))
+      {
+        send_phase(ch, phase);
+      }
     }
   }
-  // ----- Wait for WIFI ----- //
+}
 
-  // ----- Get Time ----- //
-  tft.setTextSize(2);
-  tft.print("TIME");
-  timeClient.begin();
-  if (timeClient.update())
+void boot_sequesnce()
+{
+  WiFi.mode(WIFI_STA);
+
+  // wifiManager.resetSettings(); reset ESP WiFi Settings for test
+
+  wifiManager.setEnableConfigPortal(false);
+  wifiManager.setConfigPortalBlocking(false);
+
+  // ----- Check if SD Card is OK ----- //
+  if (!SD.begin(SDCARD_CS))
   {
-    rtc.setTime(timeClient.getEpochTime());
-    rtcOffset = millis();
-    tft.println("       OK");
+    cdc_console.println("Card failed, or not present");
+    sd_status = BOOT_FAILED;
+    use_sd_card = false;
   }
   else
   {
-    Serial.println("NTP Failed!");
-    tft.setTextColor(ST7735_RED, background_color);
-    tft.println("        X");
-    tft.setTextColor(ST7735_WHITE, background_color);
+    sd_status = BOOT_OK;
   }
-  // ----- Get Time ----- //
+  // ----- Check if SD Card is OK ----- //
 
   // ----- Battery check ----- //
-  tft.print("BATTERY");
   battery_voltage = get_battery_voltage();
-  tft.print("  ");
-  if (battery_voltage < 3.3)
+  // ----- Battery check ----- //
+
+  // ----- Connect WIFI in the background ----- //
+  // Without stored credentials, or with the left button held at power-on, ask for the ConfigPortal
+  if (!wifiManager.getWiFiIsSaved() || digitalRead(TRIGGER_PIN) == LOW)
   {
-    tft.setTextColor(ST7735_RED, background_color);
-    tft.println(battery_voltage);
-    tft.setTextColor(ST7735_WHITE, background_color);
+    wifi_prompt();
   }
   else
   {
-    tft.println(battery_voltage);
+    WiFi.begin();
   }
-  // ----- Battery check ----- //
-
-  ina3221.setWarnAlertCurrentLimit(INA3221_CH1, -1);
-  delay(250);
-  ina3221.setCritAlertCurrentLimit(INA3221_CH1, -1);
-  delay(500);
-  ina3221.setWarnAlertCurrentLimit(INA3221_CH1, 1000);
-  delay(250);
-  ina3221.setCritAlertCurrentLimit(INA3221_CH1, 1500);
-  delay(250);
-  tft.setTextSize(1);
-  tft.println("             ");
-  tft.setTextColor(ST7735_GREEN, background_color);
-  tft.setTextSize(2);
-  tft.println("BOOT COMPLETE");
-  tft.setTextColor(ST7735_WHITE, background_color);
-  delay(500);
+  wifi_start_time = millis();
+  // ----- Connect WIFI in the background ----- //
 }
 
-float get_battery_voltage()
+// ----- Advance WiFi and NTP without blocking, called from the menu and loop() ----- //
+void boot_poll()
 {
-  float sensorValue = 0;
-  for (int i = 1; i <= 5; i++)
+  unsigned long now = millis();
+
+  if (wifi_status == BOOT_PENDING)
   {
-    sensorValue = sensorValue + analogRead(0);
+    if (WiFi.status() == WL_CONNECTED)
+    {
+      wifi_status = BOOT_OK;
+      cdc_console.println("local ip  ");
+      cdc_console.print(WiFi.localIP());
+      cdc_console.println();
+      if (PEER_SYNC_ROLE != PEER_SYNC_PEER) // peers take their time from the master only
+      {
+        ntp_sync_begin("pool.ntp.org", utcOffsetInSeconds);
+      }
+      peer_sync_begin();
+      ntp_start_time = now;
+      web_begin();
+      mqtt_begin();
+      udp_stream_begin();
+    }
+    else if (now - wifi_start_time > WIFI_CONNECT_TIMEOUT)
+    {
+      cdc_console.println("getting on without WiFi");
+      wifi_status = BOOT_FAILED;
+      time_status = BOOT_FAILED;
+    }
+  }
+  else if (wifi_status == BOOT_OK)
+  {
+    // Keeps running after boot, the NTP client resyncs and corrects the drift on its own
+    if (ntp_sync_poll())
+    {
+      cdc_console.printf("NTP offset %ldus drift %ldppb\n", (long)ntp_offset_us(), (long)ntp_drift_ppb());
+    }
+    if (time_status != BOOT_OK && ntp_sync_valid()) // from NTP or the master logger
+    {
+      uint64_t epoch_ms = ntp_epoch_ms(now);
+      rtc.setTime(epoch_ms / 1000, epoch_ms % 1000);
+      time_status = BOOT_OK;
+    }
+    else if (time_status == BOOT_PENDING && now - ntp_start_time > NTP_SYNC_TIMEOUT)
+    {
+      cdc_console.println("NTP Failed!");
+      time_status = BOOT_FAILED;
+    }
   }
-  sensorValue = sensorValue / 5;
-  return (sensorValue * 5.8) / 4095;
 }
 
-void setup_menu()
+void wifi_prompt()
 {
-
   tft.fillScreen(background_color);
   tft.setCursor(0, 0);
   tft.setTextSize(2);
-  tft.setTextColor(ST7735_WHITE, background_color);
+  tft.setTextColor(ST7735_RED, background_color);
   tft.setTextWrap(false);
 
-  while (started == false)
-  {
-    if (left_button_flag == 1)
-    {
-      selected = selected + 1;
-    }
-    if (selected > 5)
-    {
-      selected = 1;
-    }
-    if (right_button_flag == 1)
-    {
-      if (selected == 1)
-      {
-        use_channel_1 = !use_channel_1;
-      }
-      else if (selected == 2)
-      {
-        use_channel_2 = !use_channel_2;
-      }
-      else if (selected == 3)
-      {
-        use_channel_3 = !use_channel_3;
-      }
-      else if (selected == 4)
-      {
-        selected_avg = selected_avg + 1;
-        if (selected_avg > 5)
-        {
-          selected_avg = 1;
-        }
-      }
-      else if (selected == 5)
-      {
-        if (setup_error == false)
-        {
-          started = true;
-          ignore_input = true;
-        }
-      }
-    }
+  tft.println("Booting ...");
+  tft.println("");
+  tft.setTextColor(ST7735_WHITE, background_color);
+  tft.print("WIFI");
+  tft.setTextColor(ST7735_RED, background_color);
+  tft.println("        X");
+  tft.setTextColor(ST7735_WHITE, background_color);
 
-    tft.setCursor(0, 0);
-    tft.setTextColor(ST7735_RED, background_color);
-    tft.print("Setup: ");
-    if (setup_error == true)
-    {
-      tft.print("ERROR");
-    }
-    else
+  tft.setTextSize(1);
+  tft.println();
+
+  tft.println("start without WIFI SELECT");
+  tft.println("start ConfigPortal MENU");
+
+  button_event_t event;
+  xQueueReceive(button_queue, &event, portMAX_DELAY);
+
+  if (event == BUTTON_LEFT)
+  {
+    cdc_console.println("Portal Started");
+    tft.println("ConfigPortal started");
+
+    wifiManager.setEnableConfigPortal(true);
+    wifiManager.setConfigPortalBlocking(true);
+
+    if (!wifiManager.startConfigPortal("PowerLogger_Portal"))
     {
-      tft.print("     ");
+      cdc_console.println("failed to connect and hit timeout");
+      delay(3000);
+      // reset and try again, or maybe put it to deep sleep
+      ESP.restart();
+      delay(5000);
     }
+
     tft.println();
-    tft.setTextColor(ST7735_WHITE, background_color);
-    tft.println("             ");
+    tft.print("local ip   ");
+    tft.println(WiFi.localIP());
+  }
+  else
+  {
+    cdc_console.println("getting on without WiFi");
+    wifi_status = BOOT_FAILED;
+    time_status = BOOT_FAILED;
+  }
+}
 
-    if (selected == 1)
-    {
-      tft.print(">");
-    }
-    else
+// ----- One status line for the setup menu: SD:OK WF:.. NTP:X  3.95V ----- //
+void draw_boot_status()
+{
+  const char *label[3] = {"SD:", " WF:", " NTP:"};
+  boot_status_t status[3] = {sd_status, wifi_status, time_status};
+
+  tft.setTextSize(1);
+  tft.setCursor(0, 20);
+  for (int i = 0; i < 3; i++)
+  {
+    tft.print(label[i]);
+    if (status[i] == BOOT_OK)
     {
-      tft.print(" ");
+      tft.setTextColor(ST7735_GREEN, background_color);
+      tft.print("OK");
     }
-    tft.print("CH1: ");
-    if (use_channel_1)
+    else if (status[i] == BOOT_PENDING)
     {
-      tft.println(" ENABLE");
+      tft.print("..");
     }
     else
     {
       tft.setTextColor(ST7735_RED, background_color);
-      tft.println("DISABLE");
-      tft.setTextColor(ST7735_WHITE, background_color);
+      tft.print("X ");
     }
+    tft.setTextColor(ST7735_WHITE, background_color);
+  }
+  tft.print(" ");
+  if (battery_voltage < 3.3)
+  {
+    tft.setTextColor(ST7735_RED, background_color);
+  }
+  tft.print(battery_voltage);
+  tft.print("V");
+  tft.setTextColor(ST7735_WHITE, background_color);
+  tft.setTextSize(2);
+  tft.setCursor(0, 32);
+}
 
-    if (selected == 2)
-    {
-      tft.print(">");
-    }
-    else
-    {
-      tft.print(" ");
-    }
-    tft.print("CH2: ");
-    if (use_channel_2)
+float get_battery_voltage()
+{
+  float sensorValue = 0;
+  for (int i = 1; i <= 5; i++)
+  {
+    sensorValue = sensorValue + analogRead(0);
+  }
+  sensorValue = sensorValue / 5;
+  return (sensorValue * 5.8) / 4095;
+}
+
+void draw_menu_header()
+{
+  tft.setTextSize(2);
+  tft.setCursor(0, 0);
+  tft.setTextColor(ST7735_RED, background_color);
+  tft.print("Setup: ");
+  if (setup_error == true)
+  {
+    tft.print("ERROR");
+  }
+  else
+  {
+    tft.print("     ");
+  }
+  tft.setTextColor(ST7735_WHITE, background_color);
+}
+
+// ----- One menu entry per row, starting below the header and the boot status line ----- //
+void draw_menu_line(int item)
+{
+  bool enabled[3] = {use_channel_1, use_channel_2, use_channel_3};
+  const char *avg_text[5] = {"      1", "      4", "     16", "     64", "    128"};
+
+  tft.setTextSize(2);
+  tft.setTextColor(ST7735_WHITE, background_color);
+  tft.setCursor(0, (item + 1) * 16);
+  if (selected == item)
+  {
+    tft.print(">");
+  }
+  else
+  {
+    tft.print(" ");
+  }
+
+  if (item <= 3)
+  {
+    tft.print("CH");
+    tft.print(item);
+    tft.print(": ");
+    if (enabled[item - 1])
     {
-      tft.println(" ENABLE");
+      tft.print(" ENABLE");
     }
     else
     {
       tft.setTextColor(ST7735_RED, background_color);
-      tft.println("DISABLE");
+      tft.print("DISABLE");
       tft.setTextColor(ST7735_WHITE, background_color);
     }
-
-    if (selected == 3)
+  }
+  else if (item == 4)
+  {
+    tft.print("AVG: ");
+    tft.print(avg_text[selected_avg - 1]);
+  }
+  else if (item == 5)
+  {
+    tft.print("PWR: ");
+    if (low_power)
     {
-      tft.print(">");
+      tft.print("    LOW");
     }
     else
     {
-      tft.print(" ");
+      tft.print(" NORMAL");
     }
-    tft.print("CH3: ");
-    if (use_channel_3)
+  }
+  else
+  {
+    tft.print("START");
+  }
+}
+
+void setup_menu()
+{
+  button_event_t event;
+
+  tft.fillScreen(background_color);
+  tft.setTextSize(2);
+  tft.setTextWrap(false);
+
+  setup_error = (use_channel_1 == false && use_channel_2 == false && use_channel_3 == false);
+  draw_menu_header();
+  draw_boot_status();
+  for (int item = 1; item <= MENU_ITEMS; item++)
+  {
+    draw_menu_line(item);
+  }
+
+  // ----- Block on the button queue and redraw only the lines that changed ----- //
+  while (started == false)
+  {
+    boot_status_t wifi_before = wifi_status;
+    boot_status_t time_before = time_status;
+    bool boot_pending = (wifi_status == BOOT_PENDING || time_status == BOOT_PENDING);
+    bool pressed = xQueueReceive(button_queue, &event, boot_pending ? pdMS_TO_TICKS(MENU_POLL_MS) : portMAX_DELAY) == pdTRUE;
+
+    boot_poll();
+    if (wifi_status != wifi_before || time_status != time_before)
     {
-      tft.println(" ENABLE");
+      draw_boot_status();
     }
-    else
+    if (pressed == false)
     {
-      tft.setTextColor(ST7735_RED, background_color);
-      tft.println("DISABLE");
-      tft.setTextColor(ST7735_WHITE, background_color);
+      continue;
     }
 
-    if (selected == 4)
+    if (event == BUTTON_COMMAND)
     {
-      tft.print(">");
-    }
-    else
-    {
-      tft.print(" ");
+      // start and config arrive here while the menu is shown, redraw what they changed
+      handle_control_commands();
+      setup_error = (use_channel_1 == false && use_channel_2 == false && use_channel_3 == false);
+      draw_menu_header();
+      for (int item = 1; item <= MENU_ITEMS; item++)
+      {
+        draw_menu_line(item);
+      }
+      continue;
     }
-    tft.print("AVG: ");
-    if (selected_avg == 1)
+
+    if (event == BUTTON_LEFT)
     {
-      tft.println("      1");
+      int previous = selected;
+      selected = selected % MENU_ITEMS + 1;
+      draw_menu_line(previous);
+      draw_menu_line(selected);
+      continue;
     }
-    else if (selected_avg == 2)
+
+    if (selected == 1)
     {
-      tft.println("      4");
+      use_channel_1 = !use_channel_1;
     }
-    else if (selected_avg == 3)
+    else if (selected == 2)
     {
-      tft.println("     16");
+      use_channel_2 = !use_channel_2;
     }
-    else if (selected_avg == 4)
+    else if (selected == 3)
     {
-      tft.println("     64");
+      use_channel_3 = !use_channel_3;
     }
-    else if (selected_avg == 5)
+    else if (selected == 4)
     {
-      tft.println("    128");
+      selected_avg = selected_avg + 1;
+      if (selected_avg > 5)
+      {
+        selected_avg = 1;
+      }
     }
-
-    tft.println("             ");
-
-    if (selected == 5)
+    else if (selected == 5)
     {
-      tft.print(">");
+      low_power = !low_power;
     }
-    else
+    else if (selected == 6)
     {
-      tft.print(" ");
+      if (setup_error == false)
+      {
+        started = true;
+        metrics_running(true);
+        ignore_input = true;
+      }
     }
-    tft.println("START");
+    draw_menu_line(selected);
 
-    if (use_channel_1 == false && use_channel_2 == false && use_channel_3 == false)
+    bool error = (use_channel_1 == false && use_channel_2 == false && use_channel_3 == false);
+    if (error != setup_error)
     {
-      setup_error = true;
+      setup_error = error;
+      draw_menu_header();
     }
-    else
-    {
-      setup_error = false;
-    }
-    left_button_flag = 0;
-    right_button_flag = 0;
-    delay(200);
   }
+  // ----- Block on the button queue and redraw only the lines that changed ----- //
 
   if (started == true)
   {
@@ -934,71 +1207,69 @@ void setup_menu()
     if (use_channel_1)
     {
       tft.println(" ENABLE");
-      ina3221.setChannelEnable(INA3221_CH1);
     }
     else
     {
       tft.setTextColor(ST7735_RED, background_color);
       tft.println("DISABLE");
-      ina3221.setChannelDisable(INA3221_CH1);
       tft.setTextColor(ST7735_WHITE, background_color);
     }
     tft.print(" CH2: ");
     if (use_channel_2)
     {
       tft.println(" ENABLE");
-      ina3221.setChannelEnable(INA3221_CH2);
     }
     else
     {
       tft.setTextColor(ST7735_RED, background_color);
       tft.println("DISABLE");
-      ina3221.setChannelDisable(INA3221_CH2);
       tft.setTextColor(ST7735_WHITE, background_color);
     }
     tft.print(" CH3: ");
     if (use_channel_3)
     {
       tft.println(" ENABLE");
-      ina3221.setChannelEnable(INA3221_CH3);
     }
     else
     {
       tft.setTextColor(ST7735_RED, background_color);
       tft.println("DISABLE");
-      ina3221.setChannelDisable(INA3221_CH3);
       tft.setTextColor(ST7735_WHITE, background_color);
     }
     tft.print(" AVG: ");
     if (selected_avg == 1)
     {
       tft.println("      1");
-      ina3221.setAveragingMode(INA3221_REG_CONF_AVG_1);
     }
     else if (selected_avg == 2)
     {
       tft.println("      4");
-      ina3221.setAveragingMode(INA3221_REG_CONF_AVG_4);
     }
     else if (selected_avg == 3)
     {
       tft.println("     16");
-      ina3221.setAveragingMode(INA3221_REG_CONF_AVG_16);
     }
     else if (selected_avg == 4)
     {
       tft.println("     64");
-      ina3221.setAveragingMode(INA3221_REG_CONF_AVG_64);
     }
     else if (selected_avg == 5)
     {
       tft.println("    128");
-      ina3221.setAveragingMode(INA3221_REG_CONF_AVG_128);
     }
-    tft.println("             ");
+    tft.print(" PWR: ");
+    if (low_power)
+    {
+      tft.println("    LOW");
+    }
+    else
+    {
+      tft.println(" NORMAL");
+    }
     tft.setTextColor(ST7735_GREEN, background_color);
     tft.println(" STARTING ...");
     tft.setTextColor(ST7735_WHITE, background_color);
+    apply_ina_settings();
     if (use_channel_1 == false)
     {
       channel_number = 2;
@@ -1007,155 +1278,830 @@ void setup_menu()
     {
       channel_number = 3;
     }
-    if (use_sd_card == true)
+    ignore_input = false;
+  }
+}
+
+// ----- Channels, averaging and shunts of the menu/command API into the INA3221 ----- //
+void apply_ina_settings()
+{
+  const ina3221_avg_mode_t avg_mode[5] = {INA3221_REG_CONF_AVG_1, INA3221_REG_CONF_AVG_4, INA3221_REG_CONF_AVG_16,
+                                          INA3221_REG_CONF_AVG_64, INA3221_REG_CONF_AVG_128};
+  bool enabled[3] = {use_channel_1, use_channel_2, use_channel_3};
+  const ina3221_ch_t channel[3] = {INA3221_CH1, INA3221_CH2, INA3221_CH3};
+
+  for (int ch = 0; ch < 3; ch++)
+  {
+    if (enabled[ch])
     {
-      //  if(file_active == false){
-      create_file();
-      //  }
+      ina3221.setChannelEnable(channel[ch]);
+    }
+    else
+    {
+      ina3221.setChannelDisable(channel[ch]);
     }
-    delay(1000);
-    ignore_input = false;
   }
+  ina3221.setAveragingMode(avg_mode[selected_avg - 1]);
+  ina3221.setShuntRes(shunt_mohm[0], shunt_mohm[1], shunt_mohm[2]);
+  ina3221.setFilterRes(filter_ohm[0], filter_ohm[1], filter_ohm[2]);
 }
 
-void handle_left_Interrupt()
+// ----- Right button or stop command: clear the measurement and go back to the setup menu ----- //
+void stop_measurement()
 {
-  display_on_time = millis();
-  interrupt_time = millis();
-  // If interrupts come faster than 200ms, assume it's a bounce and ignore
-  if (interrupt_time - last_interrupt_time > 200 && ignore_input == false)
+  stop_requested = false;
+  started = false;
+  metrics_running(false);
+  selected = 1;
+  stats_page = false;
+  end_session();
+  for (int ch = 0; ch < CHANNELS; ch++)
   {
-    left_button_flag = 1;
+    channels[ch] = channel_state();
+  }
+  sample_count = 0; // The SD writer starts a new file with sample 0
+  udp_stream_flush();
+  setup_menu();
+  draw_data_labels();
+  apply_cpu_frequency();
+}
+
+// ----- Hand the statistics of the session to the SD writer and start new ones ----- //
+void end_session()
+{
+  static session_summary summary; // too large for the stack of loop()
+
+  summary.samples = 0;
+  summary.channel_mask = 0;
+  summary.phase_mask = 0;
+  for (int ch = 0; ch < CHANNELS; ch++)
+  {
+    load_phase phase;
+    if (segment_end(segments[ch], previousMillis + interval, phase)) // the open phase ends with the last sample
+    {
+      send_phase(ch, phase);
+      summary.phase_mask = summary.phase_mask | (1 << ch);
+    }
+    memcpy(summary.phases[ch], segments[ch].totals, sizeof(summary.phases[ch]));
+    segments[ch] = load_segmenter();
+    if (stats[ch].current_mA.count > 0)
+    {
+      summary.samples = stats[ch].current_mA.count;
+      summary.channel_mask = summary.channel_mask | (1 << ch);
+    }
+    summary.stats[ch] = stats[ch];
+    summary.energy[ch] = channels[ch].energy;
+    summary.capacity[ch] = channels[ch].capacity;
+    stats[ch] = channel_stats();
+  }
+  summary.duration_ms = currentMillis - session_start;
+  summary.phases_dropped = phases_dropped;
+  phases_dropped = 0;
+  if (summary.samples > 0 && use_sd_card == true)
+  {
+    xQueueSend(summary_queue, &summary, 0); // the SD writer still has the log file of the session
+  }
+}
+
+void send_phase(int ch, load_phase &phase)
+{
+  phase.session_ms = session_start;
+  phase.channel = ch;
+  if (use_sd_card == true && xQueueSend(phase_queue, &phase, 0) != pdTRUE)
+  {
+    phases_dropped = phases_dropped + 1;
+  }
+}
+
+// ----- Apply /config.json from the SD card, called once before the setup menu ----- //
+void load_config_file()
+{
+  static char json[CONFIG_FILE_SIZE];
+  control_command command;
+  bool autostart;
+  char error[64];
+
+  if (use_sd_card == false || !SD.exists(CONFIG_FILE))
+  {
+    return;
+  }
+  File file = SD.open(CONFIG_FILE, FILE_READ);
+  size_t len = file ? file.read((uint8_t *)json, sizeof(json)) : 0;
+  bool complete = file && file.available() == 0;
+  file.close();
+  if (complete == false)
+  {
+    cdc_console.printf("%s: unreadable or larger than %d bytes\n", CONFIG_FILE, CONFIG_FILE_SIZE);
+    return;
+  }
+
+  if (!control_parse_config(json, len, command, autostart, error, sizeof(error)))
+  {
+    cdc_console.printf("%s: %s, using the defaults\n", CONFIG_FILE, error);
+    return;
+  }
+  execute_command(command);
+  cdc_console.printf("%s loaded%s\n", CONFIG_FILE, autostart ? ", autostart" : "");
+
+  if (autostart == true)
+  {
+    command.action = CONTROL_START;
+    const char *start_error = execute_command(command);
+    if (start_error != NULL)
+    {
+      cdc_console.printf("%s: no autostart, %s\n", CONFIG_FILE, start_error);
+    }
   }
-  last_interrupt_time = interrupt_time;
+}
+
+// ----- Run the waiting JSON API command, called from loop() and the setup menu ----- //
+void handle_control_commands()
+{
+  control_command command;
+  char reply[CONTROL_REPLY_SIZE];
+
+  while (control_next(command))
+  {
+    format_status(reply, sizeof(reply), execute_command(command));
+    control_done(reply);
+  }
+}
+
+// ----- Returns NULL on success or the error for the reply ----- //
+const char *execute_command(const control_command &command)
+{
+  if (command.action == CONTROL_START)
+  {
+    if (started == true)
+    {
+      return "already running";
+    }
+    if (use_channel_1 == false && use_channel_2 == false && use_channel_3 == false)
+    {
+      return "no channel enabled";
+    }
+    started = true; // the setup menu sees it and starts the measurement
+    metrics_running(true);
+    ignore_input = true;
+  }
+  else if (command.action == CONTROL_STOP)
+  {
+    if (started == false)
+    {
+      return "not running";
+    }
+    stop_requested = true; // loop() stops once the reply is out
+  }
+  else if (command.action == CONTROL_RESET)
+  {
+    end_session();
+    for (int ch = 0; ch < CHANNELS; ch++)
+    {
+      channels[ch].energy = 0;
+      channels[ch].capacity = 0;
+    }
+    sample_count = 0; // The SD writer starts a new file with sample 0
+  }
+  else if (command.action == CONTROL_CONFIG)
+  {
+    if (command.fields & CONTROL_SET_CHANNELS)
+    {
+      use_channel_1 = command.channel_mask & 1;
+      use_channel_2 = command.channel_mask & 2;
+      use_channel_3 = command.channel_mask & 4;
+      while ((command.channel_mask & (1 << (channel_number - 1))) == 0)
+      {
+        channel_number = channel_number % 3 + 1; // the displayed channel was switched off
+      }
+      sample_count = 0; // The log file header lists the channels, start a new one
+    }
+    if (command.fields & CONTROL_SET_AVERAGING)
+    {
+      selected_avg = command.averaging;
+    }
+    if (command.fields & CONTROL_SET_SHUNT)
+    {
+      memcpy(shunt_mohm, command.shunt_mohm, sizeof(shunt_mohm));
+    }
+    if (command.fields & CONTROL_SET_FILTER)
+    {
+      memcpy(filter_ohm, command.filter_ohm, sizeof(filter_ohm));
+    }
+    if (command.fields & CONTROL_SET_FORMAT)
+    {
+      log_separator = command.separator;
+      log_decimals = command.decimals;
+      sample_count = 0; // The old file keeps one format
+    }
+    if (command.fields & CONTROL_SET_LOW_POWER)
+    {
+      low_power = command.low_power;
+    }
+    if (command.fields & CONTROL_SET_PHASES)
+    {
+      memcpy(sleep_mA, command.sleep_mA, sizeof(sleep_mA));
+      memcpy(active_mA, command.active_mA, sizeof(active_mA));
+    }
+    if (command.fields & (CONTROL_SET_INTERVAL | CONTROL_SET_LOW_POWER))
+    {
+      interval = command.fields & CONTROL_SET_INTERVAL ? command.interval_ms : interval;
+      apply_cpu_frequency();
+    }
+    if (started == true)
+    {
+      apply_ina_settings();
+    }
+  }
+  else if (command.action == CONTROL_STREAM)
+  {
+    if (command.fields & CONTROL_SET_INTERVAL)
+    {
+      interval = command.interval_ms;
+      apply_cpu_frequency();
+    }
+    if (command.stream_on)
+    {
+      cdc_stream_start();
+    }
+    else
+    {
+      cdc_stream_stop();
+    }
+  }
+  return NULL;
+}
+
+void format_status(char *reply, size_t size, const char *error)
+{
+  StaticJsonDocument<CONTROL_JSON_SIZE> doc;
+
+  doc["ok"] = error == NULL;
+  if (error != NULL)
+  {
+    doc["error"] = error;
+  }
+  doc["running"] = started;
+  JsonArray channels = doc.createNestedArray("channels");
+  bool enabled[3] = {use_channel_1, use_channel_2, use_channel_3};
+  for (int ch = 0; ch < 3; ch++)
+  {
+    if (enabled[ch])
+    {
+      channels.add(ch + 1);
+    }
+  }
+  doc["avg"] = control_averaging_samples[selected_avg - 1];
+  doc["interval"] = interval;
+  JsonArray shunt = doc.createNestedArray("shunt");
+  for (int ch = 0; ch < 3; ch++)
+  {
+    shunt.add(shunt_mohm[ch]);
+  }
+  JsonArray filter = doc.createNestedArray("filter");
+  for (int ch = 0; ch < 3; ch++)
+  {
+    filter.add(filter_ohm[ch]);
+  }
+  char separator[2] = {log_separator, 0};
+  doc["separator"] = separator;
+  doc["decimals"] = log_decimals;
+  doc["low_power"] = low_power;
+  JsonArray sleep = doc.createNestedArray("sleep_mA");
+  JsonArray active = doc.createNestedArray("active_mA");
+  for (int ch = 0; ch < 3; ch++)
+  {
+    sleep.add(sleep_mA[ch]);
+    active.add(active_mA[ch]);
+  }
+  doc["samples"] = sample_count;
+  deadline_misses late = metrics_late();
+  doc["late"] = late.count;
+  doc["late_worst_ms"] = late.worst_ms;
+  doc["heap_min"] = ESP.getMinFreeHeap();
+  doc["stream_dropped"] = cdc_stream_dropped();
+  serializeJson(doc, reply, size);
+}
+
+void handle_left_Interrupt()
+{
+  post_button_event_from_isr(BUTTON_LEFT);
 }
 
 void handle_right_Interrupt()
 {
+  post_button_event_from_isr(BUTTON_RIGHT);
+}
+
+void post_button_event_from_isr(button_event_t event)
+{
+  BaseType_t woken = pdFALSE;
+
   display_on_time = millis();
   interrupt_time = millis();
   // If interrupts come faster than 200ms, assume it's a bounce and ignore
   if (interrupt_time - last_interrupt_time > 200 && ignore_input == false)
   {
-    right_button_flag = 1;
+    xQueueSendFromISR(button_queue, &event, &woken);
   }
   last_interrupt_time = interrupt_time;
+  portYIELD_FROM_ISR(woken);
+}
+
+// ----- Same as the interrupts, for presses detected from a task (light sleep wakeup) ----- //
+void post_button_event(button_event_t event)
+{
+  display_on_time = millis();
+  last_interrupt_time = display_on_time;
+  xQueueSend(button_queue, &event, 0);
 }
 
-void create_file()
+// ----- Log file named after its first sample, held back samples are written later than they were taken ----- //
+void create_file(const log_sample &first)
 {
   if (use_sd_card == true)
   {
 
     // file_name = "/" + String(currentYear) + "-" + String(currentMonth) + "-" + String(monthDay) + "_" + String(timeClient.getHours()) + "-" + String(timeClient.getMinutes()) + "-" + String(timeClient.getSeconds()) + ".txt";
-    file_name = "/" + String(rtc.getTime("%Y-%B-%d_%H-%M-%S")) + ".txt";
-    File Log = SD.open(file_name, FILE_WRITE);
-    if (Log)
-    {
-      Log.print("date");
-      Log.print(",");
-      Log.print("time");
-      if (use_channel_1 == true)
+    time_t start = ntp_epoch_us(first.time_us) / 1000000;
+    struct tm t;
+    gmtime_r(&start, &t);
+    strftime(file_name, sizeof(file_name), "/%Y-%B-%d_%H-%M-%S.txt", &t);
+    if (log_file)
+    {
+      log_file.close();
+    }
+    file_separator = first.separator;
+    file_decimals = first.decimals;
+    file_channel_mask = first.channel_mask;
+    log_file = SD.open(file_name, FILE_WRITE);
+    if (log_file)
+    {
+      char time_source[128];
+      peer_sync_header(time_source, sizeof(time_source));
+      log_file.println(time_source);
+      log_file.print("date");
+      log_file.print(file_separator);
+      log_file.print("time");
+      if (file_channel_mask & 1)
       {
-        Log.print(",");
-        Log.print("load voltage 1");
-        Log.print(",");
-        Log.print("current mA 1");
-        Log.print(",");
-        Log.print("power mW 1");
-        Log.print(",");
-        Log.print("energy mWh 1");
-        Log.print(",");
-        Log.print("capacity mAh 1");
+        log_file.print(file_separator);
+        log_file.print("load voltage 1");
+        log_file.print(file_separator);
+        log_file.print("current mA 1");
+        log_file.print(file_separator);
+        log_file.print("power mW 1");
+        log_file.print(file_separator);
+        log_file.print("energy mWh 1");
+        log_file.print(file_separator);
+        log_file.print("capacity mAh 1");
       }
-      if (use_channel_2 == true)
+      if (file_channel_mask & 2)
       {
-        Log.print(",");
-        Log.print("load voltage 2");
-        Log.print(",");
-        Log.print("current mA 2");
-        Log.print(",");
-        Log.print("power mW 2");
-        Log.print(",");
-        Log.print("energy mWh 2");
-        Log.print(",");
-        Log.print("capacity mAh 2");
+        log_file.print(file_separator);
+        log_file.print("load voltage 2");
+        log_file.print(file_separator);
+        log_file.print("current mA 2");
+        log_file.print(file_separator);
+        log_file.print("power mW 2");
+        log_file.print(file_separator);
+        log_file.print("energy mWh 2");
+        log_file.print(file_separator);
+        log_file.print("capacity mAh 2");
       }
-      if (use_channel_3 == true)
+      if (file_channel_mask & 4)
       {
-        Log.print(",");
-        Log.print("load voltage 3");
-        Log.print(",");
-        Log.print("current mA 3");
-        Log.print(",");
-        Log.print("power mW 3");
-        Log.print(",");
-        Log.print("energy mWh 3");
-        Log.print(",");
-        Log.print("capacity mAh 3");
+        log_file.print(file_separator);
+        log_file.print("load voltage 3");
+        log_file.print(file_separator);
+        log_file.print("current mA 3");
+        log_file.print(file_separator);
+        log_file.print("power mW 3");
+        log_file.print(file_separator);
+        log_file.print("energy mWh 3");
+        log_file.print(file_separator);
+        log_file.print("capacity mAh 3");
       }
+      log_file.print(file_separator);
+      log_file.print("sample");
 
-      Log.println();
-      Log.close();
+      log_file.println();
+      log_file.flush();
     }
 
     file_active = true;
   }
 }
 
-void write_file()
+// ----- SD writer task: owns the log file, loop() only hands over samples ----- //
+void log_task(void *parameter)
+{
+  log_sample sample;
+
+  if (use_sd_card == true && SD.exists(PENDING_FILE))
+  {
+    SD.remove(PENDING_FILE); // left over from a power loss before the time was known
+  }
+  for (;;)
+  {
+    bool received = xQueueReceive(log_queue, &sample, pdMS_TO_TICKS(LOG_FLUSH_MS)) == pdTRUE;
+    log_busy = true;
+    if (received)
+    {
+      log_values(sample);
+    }
+    else if (time_status != BOOT_PENDING)
+    {
+      release_samples(); // the time came while no samples arrive
+    }
+    write_summary();
+    if (log_dirty == true && millis() - log_flush_time >= LOG_FLUSH_MS)
+    {
+      uint32_t flush_start = micros();
+      log_file.flush();
+      if (phase_file)
+      {
+        phase_file.flush();
+      }
+      metrics_sd_flush(micros() - flush_start);
+      log_dirty = false;
+      log_flush_time = millis();
+    }
+    log_busy = false;
+    xSemaphoreGive(log_idle);
+  }
+}
+
+// ----- Statistics of an ended session, in a file named after its log file ----- //
+void write_summary()
+{
+  static session_summary summary;
+  static const char *quantity[3] = {"load voltage", "current mA", "power mW"};
+  char name[64];
+
+  if (file_active == false || xQueueReceive(summary_queue, &summary, 0) != pdTRUE)
+  {
+    return; // a session held back until the time is known keeps its summary queued
+  }
+  write_phases(); // the last phases of the session were sent before the summary
+  if (phase_file)
+  {
+    phase_file.close();
+  }
+  snprintf(name, sizeof(name), "%.*s_summary.txt", (int)strlen(file_name) - 4, file_name);
+  File file = SD.open(name, FILE_WRITE);
+  if (!file)
+  {
+    return;
+  }
+  file.print("# session summary of ");
+  file.println(file_name);
+  file.print("samples");
+  file.print(file_separator);
+  file.println(summary.samples);
+  file.print("duration s");
+  file.print(file_separator);
+  file.println(summary.duration_ms / 1000.0, 3);
+  file.print("channel");
+  const char *columns[] = {"quantity", "count", "min", "max", "mean", "rms", "sd", "p50", "p90", "p99"};
+  for (int i = 0; i < 10; i++)
+  {
+    file.print(file_separator);
+    file.print(columns[i]);
+  }
+  file.println();
+
+  for (int ch = 0; ch < CHANNELS; ch++)
+  {
+    if (!(summary.channel_mask & (1 << ch)))
+    {
+      continue;
+    }
+    const channel_stats &s = summary.stats[ch];
+    const running_stats *quantities[3] = {&s.load_voltage, &s.current_mA, &s.power_mW};
+    for (int q = 0; q < 3; q++)
+    {
+      float values[5] = {quantities[q]->min, quantities[q]->max, stats_mean(*quantities[q]),
+                         stats_rms(*quantities[q]), stats_stddev(*quantities[q])};
+      file.print(ch + 1);
+      file.print(file_separator);
+      file.print(quantity[q]);
+      file.print(file_separator);
+      file.print(quantities[q]->count);
+      for (int i = 0; i < 5; i++)
+      {
+        file.print(file_separator);
+        file.print(values[i], file_decimals);
+      }
+      for (int i = 0; i < STATS_QUANTILES && q == 1; i++) // percentiles are kept for the current
+      {
+        file.print(file_separator);
+        file.print(stats_quantile(s, i), file_decimals);
+      }
+      file.println();
+    }
+    file.print(ch + 1);
+    file.print(file_separator);
+    file.print("energy mWh");
+    file.print(file_separator);
+    file.println(summary.energy[ch], file_decimals);
+    file.print(ch + 1);
+    file.print(file_separator);
+    file.print("capacity mAh");
+    file.print(file_separator);
+    file.println(summary.capacity[ch], file_decimals);
+  }
+
+  if (summary.phase_mask != 0)
+  {
+    file.print("channel");
+    const char *phase_columns[] = {"state", "phases", "time s", "charge mAh", "energy mWh"};
+    for (int i = 0; i < 5; i++)
+    {
+      file.print(file_separator);
+      file.print(phase_columns[i]);
+    }
+    file.println();
+  }
+  for (int ch = 0; ch < CHANNELS; ch++)
+  {
+    for (int state = 0; state < LOAD_STATES && (summary.phase_mask & (1 << ch)); state++)
+    {
+      const phase_totals &totals = summary.phases[ch][state];
+      file.print(ch + 1);
+      file.print(file_separator);
+      file.print(load_state_names[state]);
+      file.print(file_separator);
+      file.print(totals.phases);
+      file.print(file_separator);
+      file.print(totals.time_ms / 1000.0, 3);
+      file.print(file_separator);
+      file.print(totals.charge, file_decimals);
+      file.print(file_separator);
+      file.println(totals.energy, file_decimals);
+    }
+  }
+  if (summary.phases_dropped > 0)
+  {
+    file.print("phases dropped");
+    file.print(file_separator);
+    file.println(summary.phases_dropped);
+  }
+  char health[METRICS_HEALTH_SIZE];
+  metrics_health(health, sizeof(health));
+  file.print("# since boot: ");
+  file.println(health);
+  file.close();
+}
+
+// ----- Ended load phases of the session of the log file, one line each in <log name>_phases.txt ----- //
+void write_phases()
+{
+  load_phase phase;
+  char name[64];
+
+  while (file_active == true && xQueuePeek(phase_queue, &phase, 0) == pdTRUE && phase.session_ms == log_session_ms)
+  {
+    xQueueReceive(phase_queue, &phase, 0);
+    if (!phase_file)
+    {
+      snprintf(name, sizeof(name), "%.*s_phases.txt", (int)strlen(file_name) - 4, file_name);
+      phase_file = SD.open(name, FILE_WRITE);
+      if (!phase_file)
+      {
+        continue;
+      }
+      phase_file.print("channel");
+      const char *columns[] = {"state", "start s", "duration s", "charge mAh", "energy mWh", "mean mA", "peak mA"};
+      for (int i = 0; i < 7; i++)
+      {
+        phase_file.print(file_separator);
+        phase_file.print(columns[i]);
+      }
+      phase_file.println();
+    }
+    float values[5] = {phase.duration_ms / 1000.0f, phase.charge, phase.energy,
+                       phase.duration_ms > 0 ? phase.charge * 3600000 / phase.duration_ms : 0, phase.peak_mA};
+    phase_file.print(phase.channel + 1);
+    phase_file.print(file_separator);
+    phase_file.print(load_state_names[phase.state]);
+    phase_file.print(file_separator);
+    phase_file.print((phase.start_ms - phase.session_ms) / 1000.0, 3);
+    for (int i = 0; i < 5; i++)
+    {
+      phase_file.print(file_separator);
+      phase_file.print(values[i], i == 0 ? 3 : file_decimals);
+    }
+    phase_file.println();
+    log_dirty = true;
+  }
+}
+
+// ----- Log a sample, holding it back while the NTP time is still pending ----- //
+void log_values(const log_sample &sample)
+{
+  if (time_status == BOOT_PENDING)
+  {
+    hold_sample(sample);
+    return;
+  }
+  // Samples taken before the time sync get their timestamps from the synced clock now
+  release_samples();
+  log_record(sample);
+}
+
+void log_record(const log_sample &sample)
+{
+  // A new measurement was started, begin a new file. Its first samples may have been dropped from a full queue.
+  if (sample.seq == 0 || sample.session_ms != log_session_ms || sample.seq < log_next_seq)
+  {
+    write_phases();
+    write_summary(); // of the previous file, sent before this sample
+    if (phase_file)
+    {
+      phase_file.close();
+    }
+    load_phase phase;
+    while (xQueuePeek(phase_queue, &phase, 0) == pdTRUE && (long)(phase.session_ms - sample.session_ms) < 0)
+    {
+      xQueueReceive(phase_queue, &phase, 0); // of a session that got no log file
+    }
+    log_session_ms = sample.session_ms;
+    log_next_seq = 0;
+    log_last_time_ms = sample.time_ms;
+    file_active = false;
+  }
+  // The columns changed within the session, continue in a new file
+  if (file_active && (sample.separator != file_separator || sample.decimals != file_decimals ||
+                      sample.channel_mask != file_channel_mask))
+  {
+    file_active = false;
+  }
+  if (file_active == false)
+  {
+    create_file(sample);
+  }
+  write_file(sample);
+  write_phases();
+}
+
+// ----- The first PENDING_SAMPLES are kept in RAM, every further block is appended to PENDING_FILE ----- //
+void hold_sample(const log_sample &sample)
+{
+  pending_samples[pending_count] = sample;
+  pending_count = pending_count + 1;
+  if (pending_count < PENDING_SAMPLES)
+  {
+    return;
+  }
+  if (!pending_file)
+  {
+    pending_file = SD.open(PENDING_FILE, FILE_WRITE);
+  }
+  if (pending_file)
+  {
+    pending_file.write((const uint8_t *)pending_samples, sizeof(pending_samples));
+  }
+  else
+  {
+    cdc_console.println("no room for the samples before the time sync"); // they show up as a gap
+  }
+  pending_count = 0;
+}
+
+// ----- Write the held samples in the order they were taken, new sessions start their files as usual ----- //
+void release_samples()
+{
+  if (pending_file)
+  {
+    pending_file.write((const uint8_t *)pending_samples, pending_count * sizeof(log_sample));
+    pending_count = 0;
+    pending_file.close();
+    File file = SD.open(PENDING_FILE, FILE_READ);
+    size_t len;
+    while (file && (len = file.read((uint8_t *)pending_samples, sizeof(pending_samples))) >= sizeof(log_sample))
+    {
+      for (size_t i = 0; i < len / sizeof(log_sample); i++)
+      {
+        log_record(pending_samples[i]);
+      }
+    }
+    file.close();
+    SD.remove(PENDING_FILE);
+  }
+  for (int i = 0; i < pending_count; i++)
+  {
+    log_record(pending_samples[i]);
+  }
+  pending_count = 0;
+}
+
+void capture_sample(log_sample &sample)
+{
+  sample.seq = sample_count;
+  sample_count = sample_count + 1;
+  sample.time_ms = currentMillis;
+  sample.session_ms = session_start;
+  sample.interval_ms = interval;
+  sample.time_us = ntp_mono_us();
+  sample.channel_mask = (use_channel_1 ? 1 : 0) | (use_channel_2 ? 2 : 0) | (use_channel_3 ? 4 : 0);
+  sample.separator = log_separator;
+  sample.decimals = log_decimals;
+  for (int ch = 0; ch < CHANNELS; ch++)
+  {
+    sample.load_voltage[ch] = channels[ch].load_voltage;
+    sample.current_mA[ch] = channels[ch].current_mA;
+    sample.energy[ch] = channels[ch].energy;
+    sample.capacity[ch] = channels[ch].capacity;
+  }
+}
+
+// ----- Date and time of a timebase stamp, both parts taken from the same instant ----- //
+void format_log_time(uint64_t time_us, char *date, char *clock)
+{
+  uint64_t epoch_ms = ntp_epoch_us(time_us) / 1000;
+  time_t epoch = epoch_ms / 1000;
+  struct tm t;
+
+  gmtime_r(&epoch, &t);
+  strftime(date, 9, "%y/%m/%d", &t);
+  sprintf(clock, "%02d:%02d:%02d:%03d", t.tm_hour, t.tm_min, t.tm_sec, (int)(epoch_ms % 1000));
+}
+
+void write_file(const log_sample &sample)
+{
+  char date[9];
+  char clock[13];
+
+  if (log_file)
+  {
+    alloc_watch_begin();
+    uint32_t write_start = micros();
+    uint32_t bench_write = bench_begin();
+    write_gap(sample);
+    format_log_time(sample.time_us, date, clock);
+    log_file.print(date);
+    log_file.print(file_separator);
+    log_file.print(clock);
+
+    for (int ch = 0; ch < 3; ch++)
+    {
+      if (file_channel_mask & (1 << ch))
+      {
+        log_file.print(file_separator);
+        log_file.print(sample.load_voltage[ch], file_decimals);
+        log_file.print(file_separator);
+        log_file.print(sample.current_mA[ch], file_decimals);
+        log_file.print(file_separator);
+        log_file.print(sample.load_voltage[ch] * sample.current_mA[ch], file_decimals);
+        log_file.print(file_separator);
+        log_file.print(sample.energy[ch], file_decimals);
+        log_file.print(file_separator);
+        log_file.print(sample.capacity[ch], file_decimals);
+      }
+    }
+    log_file.print(file_separator);
+    log_file.print(sample.seq);
+
+    log_file.println();
+    log_dirty = true;
+    bench_end(BENCH_SD_WRITE, bench_write);
+    metrics_sd_write(micros() - write_start);
+    alloc_watch_end();
+  }
+}
+
+// ----- "# gap" record before a sample that does not follow the last record ----- //
+void write_gap(const log_sample &sample)
 {
-  File Log = SD.open(file_name, FILE_APPEND);
-  if (Log)
-  {
-    // Serial.println(String(rtc.getTime("%Y/%B/%D %H:%M:%S:")) + String((currentMillis-rtcOffset)%1000));
-    Log.print(String(rtc.getTime("%y/%m/%d")));
-    Log.print(",");
-    Log.print(String(rtc.getTime("%H:%M:%S:")) + String((currentMillis - rtcOffset) % 1000));
-
-    if (use_channel_1 == true)
-    {
-      Log.print(",");
-      Log.print(load_voltage_1);
-      Log.print(",");
-      Log.print(current_mA_1);
-      Log.print(",");
-      Log.print(load_voltage_1 * current_mA_1);
-      Log.print(",");
-      Log.print(energy_1);
-      Log.print(",");
-      Log.print(capacity_1);
-    }
-    if (use_channel_2 == true)
-    {
-      Log.print(",");
-      Log.print(load_voltage_2);
-      Log.print(",");
-      Log.print(current_mA_2);
-      Log.print(",");
-      Log.print(load_voltage_2 * current_mA_2);
-      Log.print(",");
-      Log.print(energy_2);
-      Log.print(",");
-      Log.print(capacity_2);
-    }
-    if (use_channel_3 == true)
-    {
-      Log.print(",");
-      Log.print(load_voltage_3);
-      Log.print(",");
-      Log.print(current_mA_3);
-      Log.print(",");
-      Log.print(load_voltage_3 * current_mA_3);
-      Log.print(",");
-      Log.print(energy_3);
-      Log.print(",");
-      Log.print(capacity_3);
-    }
-
-    Log.println();
-    Log.close();
+  char gap[80]; // printf() of Print allocates for more than 64 characters
+  gap[0] = 0;
+  if (sample.seq != log_next_seq)
+  {
+    // Samples are only lost when loop() finds the SD writer queue full. log_record() starts a new file for an
+    // older sample number, so the first records of a file are the only ones that can be missing before it.
+    if (log_next_seq == 0)
+    {
+      snprintf(gap, sizeof(gap), "# gap after=none missed=%lu reason=sd_queue_full", (unsigned long)sample.seq);
+    }
+    else
+    {
+      snprintf(gap, sizeof(gap), "# gap after=%lu missed=%lu reason=sd_queue_full", (unsigned long)(log_next_seq - 1),
+               (unsigned long)(sample.seq - log_next_seq));
+    }
+  }
+  else if (sample.seq > 0 && sample.time_ms - log_last_time_ms >= 2 * sample.interval_ms)
+  {
+    // Sampling itself was held up, no sample was taken for an interval or more
+    unsigned long delay_ms = sample.time_ms - log_last_time_ms - sample.interval_ms;
+    snprintf(gap, sizeof(gap), "# gap after=%lu missed=%lu reason=late delay_ms=%lu", (unsigned long)(sample.seq - 1),
+             delay_ms / sample.interval_ms, delay_ms);
+  }
+  if (gap[0] != 0)
+  {
+    log_file.println(gap);
   }
+  log_next_seq = sample.seq + 1;
+  log_last_time_ms = sample.time_ms;
 }
 
 void extractIpAddress(char *sourceString, short *ipAddress)
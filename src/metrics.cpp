@@ -0,0 +1,273 @@
+#include "metrics.h"
+#include "alloc_watch.h"
+
+static logger_metrics metrics;
+static portMUX_TYPE metrics_lock = portMUX_INITIALIZER_UNLOCKED;
+
+struct metrics_task_entry
+{
+  const char *name;
+  TaskHandle_t task;
+};
+static metrics_task_entry metrics_tasks[METRICS_TASKS];
+static int metrics_task_count = 0;
+
+// ----- Templates of the exposition, filled in with snprintf ----- //
+static const char metrics_channel_help[] =
+    "# HELP powerlogger_voltage_volts Load voltage of the channel.\n"
+    "# TYPE powerlogger_voltage_volts gauge\n"
+    "# HELP powerlogger_current_amperes Current through the shunt.\n"
+    "# TYPE powerlogger_current_amperes gauge\n"
+    "# HELP powerlogger_power_watts Power delivered to the load.\n"
+    "# TYPE powerlogger_power_watts gauge\n"
+    "# HELP powerlogger_energy_watt_hours Energy since the measurement was started.\n"
+    "# TYPE powerlogger_energy_watt_hours gauge\n"
+    "# HELP powerlogger_charge_amp_hours Charge since the measurement was started.\n"
+    "# TYPE powerlogger_charge_amp_hours gauge\n";
+
+static const char metrics_channel_template[] =
+    "powerlogger_voltage_volts{channel=\"%d\"} %.4f\n"
+    "powerlogger_current_amperes{channel=\"%d\"} %.6f\n"
+    "powerlogger_power_watts{channel=\"%d\"} %.6f\n"
+    "powerlogger_energy_watt_hours{channel=\"%d\"} %.7f\n"
+    "powerlogger_charge_amp_hours{channel=\"%d\"} %.7f\n";
+
+static const char metrics_device_template[] =
+    "# HELP powerlogger_running 1 while a measurement is in progress.\n"
+    "# TYPE powerlogger_running gauge\n"
+    "powerlogger_running %d\n"
+    "# HELP powerlogger_battery_volts Voltage of the logger battery.\n"
+    "# TYPE powerlogger_battery_volts gauge\n"
+    "powerlogger_battery_volts %.2f\n"
+    "# HELP powerlogger_uptime_seconds Time since boot.\n"
+    "# TYPE powerlogger_uptime_seconds gauge\n"
+    "powerlogger_uptime_seconds %.3f\n"
+    "# HELP powerlogger_samples_total Samples taken since boot.\n"
+    "# TYPE powerlogger_samples_total counter\n"
+    "powerlogger_samples_total %lu\n"
+    "# HELP powerlogger_log_dropped_total Samples lost because the SD writer was behind.\n"
+    "# TYPE powerlogger_log_dropped_total counter\n"
+    "powerlogger_log_dropped_total %lu\n"
+    "# HELP powerlogger_late_samples_total Samples taken more than %dms after their deadline.\n"
+    "# TYPE powerlogger_late_samples_total counter\n"
+    "powerlogger_late_samples_total %lu\n"
+    "# HELP powerlogger_late_worst_seconds Largest delay of a sample since boot.\n"
+    "# TYPE powerlogger_late_worst_seconds gauge\n"
+    "powerlogger_late_worst_seconds %.3f\n"
+    "# HELP powerlogger_late_slip_seconds_total Delays of the late samples, the schedule slipped by this much.\n"
+    "# TYPE powerlogger_late_slip_seconds_total counter\n"
+    "powerlogger_late_slip_seconds_total %.3f\n"
+    "# HELP powerlogger_heap_free_min_bytes Low-water mark of the free heap since boot.\n"
+    "# TYPE powerlogger_heap_free_min_bytes gauge\n"
+    "powerlogger_heap_free_min_bytes %lu\n"
+    "# HELP powerlogger_stack_free_min_bytes High-water mark of a task stack, the least that was ever free.\n"
+    "# TYPE powerlogger_stack_free_min_bytes gauge\n";
+
+static const char metrics_stack_template[] = "powerlogger_stack_free_min_bytes{task=\"%s\"} %lu\n";
+
+static const char metrics_timing_template[] =
+    "# HELP powerlogger_%s_seconds %s\n"
+    "# TYPE powerlogger_%s_seconds summary\n"
+    "powerlogger_%s_seconds_sum %.6f\n"
+    "powerlogger_%s_seconds_count %lu\n"
+    "# HELP powerlogger_%s_max_seconds Longest %s since boot.\n"
+    "# TYPE powerlogger_%s_max_seconds gauge\n"
+    "powerlogger_%s_max_seconds %.6f\n";
+
+static void metrics_add_timing(stage_timing &timing, uint32_t us)
+{
+  timing.count++;
+  timing.sum_us += us;
+  if (us > timing.max_us)
+  {
+    timing.max_us = us;
+  }
+}
+
+void metrics_sample(const log_sample &sample, float battery_voltage, uint32_t loop_us)
+{
+  portENTER_CRITICAL(&metrics_lock);
+  metrics.last = sample;
+  metrics.battery_voltage = battery_voltage;
+  metrics.samples++;
+  metrics_add_timing(metrics.loop, loop_us);
+  portEXIT_CRITICAL(&metrics_lock);
+}
+
+void metrics_running(bool running)
+{
+  metrics.running = running;
+}
+
+void metrics_log_dropped()
+{
+  portENTER_CRITICAL(&metrics_lock);
+  metrics.log_dropped++;
+  portEXIT_CRITICAL(&metrics_lock);
+}
+
+void metrics_sd_write(uint32_t us)
+{
+  portENTER_CRITICAL(&metrics_lock);
+  metrics_add_timing(metrics.sd_write, us);
+  portEXIT_CRITICAL(&metrics_lock);
+}
+
+void metrics_sd_flush(uint32_t us)
+{
+  portENTER_CRITICAL(&metrics_lock);
+  metrics_add_timing(metrics.sd_flush, us);
+  portEXIT_CRITICAL(&metrics_lock);
+}
+
+void metrics_measure(uint32_t us)
+{
+  portENTER_CRITICAL(&metrics_lock);
+  metrics_add_timing(metrics.measure, us);
+  portEXIT_CRITICAL(&metrics_lock);
+}
+
+void metrics_display(uint32_t us)
+{
+  portENTER_CRITICAL(&metrics_lock);
+  metrics_add_timing(metrics.display, us);
+  portEXIT_CRITICAL(&metrics_lock);
+}
+
+void metrics_deadline(uint32_t late_ms)
+{
+  if (late_ms <= METRICS_DEADLINE_SLACK_MS)
+  {
+    return;
+  }
+  portENTER_CRITICAL(&metrics_lock);
+  metrics.late.count++;
+  metrics.late.slip_ms += late_ms;
+  if (late_ms > metrics.late.worst_ms)
+  {
+    metrics.late.worst_ms = late_ms;
+  }
+  portEXIT_CRITICAL(&metrics_lock);
+}
+
+deadline_misses metrics_late()
+{
+  deadline_misses late;
+
+  portENTER_CRITICAL(&metrics_lock);
+  late = metrics.late;
+  portEXIT_CRITICAL(&metrics_lock);
+  return late;
+}
+
+void metrics_task(const char *name, TaskHandle_t task)
+{
+  portENTER_CRITICAL(&metrics_lock);
+  if (metrics_task_count < METRICS_TASKS && task != NULL)
+  {
+    metrics_tasks[metrics_task_count].name = name;
+    metrics_tasks[metrics_task_count].task = task;
+    metrics_task_count++;
+  }
+  portEXIT_CRITICAL(&metrics_lock);
+}
+
+size_t metrics_health(char *buffer, size_t size)
+{
+  deadline_misses late = metrics_late();
+  int n = snprintf(buffer, size, "late %lu worst %lums slip %lums heap min %lu stack", (unsigned long)late.count,
+                   (unsigned long)late.worst_ms, (unsigned long)late.slip_ms, (unsigned long)ESP.getMinFreeHeap());
+  size_t len = n < 0 ? size : n;
+  for (int i = 0; i < metrics_task_count && len < size; i++)
+  {
+    n = snprintf(buffer + len, size - len, " %s:%lu", metrics_tasks[i].name,
+                 (unsigned long)uxTaskGetStackHighWaterMark(metrics_tasks[i].task));
+    len += n < 0 ? size : n;
+  }
+  alloc_watch_stats allocs = alloc_watch_read();
+  if (ALLOC_WATCH && allocs.count > 0 && len < size)
+  {
+    n = snprintf(buffer + len, size - len, " allocs %lu first %luB from %p since setup %lu", (unsigned long)allocs.count,
+                 (unsigned long)allocs.first_size, allocs.first_caller, (unsigned long)allocs.after_setup);
+    len += n < 0 ? size : n;
+  }
+  else if (ALLOC_WATCH && len < size)
+  {
+    n = snprintf(buffer + len, size - len, " allocs 0 since setup %lu", (unsigned long)allocs.after_setup);
+    len += n < 0 ? size : n;
+  }
+  return len < size ? len : size - 1;
+}
+
+static size_t metrics_timing(char *buffer, size_t size, const char *name, const char *help, const char *what,
+                             const stage_timing &timing)
+{
+  int n = snprintf(buffer, size, metrics_timing_template, name, help, name, name, timing.sum_us / 1e6, name,
+                   (unsigned long)timing.count, name, what, name, name, timing.max_us / 1e6);
+  return n < 0 ? size : n;
+}
+
+size_t metrics_format(char *buffer, size_t size)
+{
+  logger_metrics snapshot;
+  size_t len = 0;
+  int n;
+
+  portENTER_CRITICAL(&metrics_lock);
+  snapshot = metrics;
+  portEXIT_CRITICAL(&metrics_lock);
+
+  n = snprintf(buffer, size, "%s", metrics_channel_help);
+  len += n < 0 ? size : n;
+  for (int ch = 0; ch < CHANNELS && len < size; ch++)
+  {
+    if (snapshot.samples == 0 || !(snapshot.last.channel_mask & (1 << ch)))
+    {
+      continue;
+    }
+    float volts = snapshot.last.load_voltage[ch];
+    float amps = snapshot.last.current_mA[ch] / 1000;
+    n = snprintf(buffer + len, size - len, metrics_channel_template, ch + 1, volts, ch + 1, amps, ch + 1,
+                 volts * amps, ch + 1, snapshot.last.energy[ch] / 1000, ch + 1, snapshot.last.capacity[ch] / 1000);
+    len += n < 0 ? size : n;
+  }
+  if (len < size)
+  {
+    n = snprintf(buffer + len, size - len, metrics_device_template, snapshot.running ? 1 : 0,
+                 snapshot.battery_voltage, millis() / 1000.0, (unsigned long)snapshot.samples,
+                 (unsigned long)snapshot.log_dropped, METRICS_DEADLINE_SLACK_MS, (unsigned long)snapshot.late.count,
+                 snapshot.late.worst_ms / 1e3, snapshot.late.slip_ms / 1e3, (unsigned long)ESP.getMinFreeHeap());
+    len += n < 0 ? size : n;
+  }
+  for (int i = 0; i < metrics_task_count && len < size; i++)
+  {
+    n = snprintf(buffer + len, size - len, metrics_stack_template, metrics_tasks[i].name,
+                 (unsigned long)uxTaskGetStackHighWaterMark(metrics_tasks[i].task));
+    len += n < 0 ? size : n;
+  }
+  if (len < size)
+  {
+    len += metrics_timing(buffer + len, size - len, "loop", "Sample stage of loop().", "sample stage",
+                          snapshot.loop);
+  }
+  if (len < size)
+  {
+    len += metrics_timing(buffer + len, size - len, "measure", "INA3221 reads of a sample.", "measurement",
+                          snapshot.measure);
+  }
+  if (len < size)
+  {
+    len += metrics_timing(buffer + len, size - len, "display", "Display refresh.", "refresh", snapshot.display);
+  }
+  if (len < size)
+  {
+    len += metrics_timing(buffer + len, size - len, "sd_write", "Writing one record to the log file.",
+                          "record write", snapshot.sd_write);
+  }
+  if (len < size)
+  {
+    len += metrics_timing(buffer + len, size - len, "sd_flush", "Flushing the log file to the card.", "flush",
+                          snapshot.sd_flush);
+  }
+  return len < size ? len : 0;
+}
@@ -0,0 +1,304 @@
+#include "mqtt_publisher.h"
+#include "ntp_sync.h"
+#include "metrics.h"
+#include "cdc_stream.h"
+#include <WiFi.h>
+#include <PubSubClient.h>
+#include <stdarg.h>
+
+#define MQTT_QUEUE_LENGTH 16
+#define MQTT_TASK_STACK 6144
+#define MQTT_TASK_PRIORITY 1
+#define MQTT_RECONNECT_MS 5000
+#define MQTT_BUFFER_SIZE 1024
+
+mqtt_settings mqtt_config = {MQTT_HOST, MQTT_PORT, MQTT_TOPIC, MQTT_INTERVAL_MS, MQTT_BATCH};
+
+struct mqtt_point
+{
+  unsigned long time_ms; // millis() of the first sample of the point
+  uint8_t channel_mask;
+  float voltage[CHANNELS];
+  float current[CHANNELS];
+  float power[CHANNELS];
+  float energy[CHANNELS];
+  float capacity[CHANNELS];
+};
+
+static WiFiClient mqtt_net;
+static PubSubClient mqtt_client(mqtt_net);
+static QueueHandle_t mqtt_queue = NULL;
+static TaskHandle_t mqtt_task_handle = NULL;
+static char mqtt_id[16];
+
+// ----- Offline queue, a ring of points not yet published ----- //
+static mqtt_point mqtt_ring[MQTT_OFFLINE_POINTS];
+static int mqtt_ring_head = 0; // oldest point
+static int mqtt_ring_count = 0;
+static uint32_t mqtt_dropped = 0;
+static volatile uint32_t mqtt_lost = 0; // samples mqtt_queue had no room for, counted by loop()
+static uint8_t mqtt_sent_mask = 0;      // channels of the oldest batch already published
+static int mqtt_flush_points = 0;       // oldest points of a stopped measurement, sent without waiting for a full batch
+
+// ----- Running average of the point being built ----- //
+static mqtt_point mqtt_acc;
+static uint32_t mqtt_acc_count = 0;
+
+static void mqtt_push_point(const mqtt_point &point)
+{
+  if (mqtt_ring_count == MQTT_OFFLINE_POINTS)
+  {
+    mqtt_ring_head = (mqtt_ring_head + 1) % MQTT_OFFLINE_POINTS;
+    mqtt_ring_count--;
+    mqtt_dropped++;
+    mqtt_flush_points = mqtt_flush_points > 0 ? mqtt_flush_points - 1 : 0;
+  }
+  mqtt_ring[(mqtt_ring_head + mqtt_ring_count) % MQTT_OFFLINE_POINTS] = point;
+  mqtt_ring_count++;
+}
+
+static void mqtt_close_point()
+{
+  if (mqtt_acc_count == 0)
+  {
+    return;
+  }
+  for (int ch = 0; ch < CHANNELS; ch++)
+  {
+    mqtt_acc.voltage[ch] /= mqtt_acc_count;
+    mqtt_acc.current[ch] /= mqtt_acc_count;
+    mqtt_acc.power[ch] /= mqtt_acc_count;
+  }
+  mqtt_push_point(mqtt_acc);
+  mqtt_acc_count = 0;
+}
+
+// ----- The measurement stopped or restarted, its last points go out as a shorter batch ----- //
+static void mqtt_flush()
+{
+  mqtt_close_point();
+  mqtt_flush_points = mqtt_ring_count;
+}
+
+static void mqtt_add_sample(const log_sample &sample)
+{
+  // a point never spans two measurements or channel selections
+  if (sample.seq == 0)
+  {
+    mqtt_flush();
+  }
+  else if (mqtt_acc_count > 0 && (sample.channel_mask != mqtt_acc.channel_mask ||
+                                  sample.time_ms - mqtt_acc.time_ms >= mqtt_config.interval_ms))
+  {
+    mqtt_close_point();
+  }
+  if (mqtt_acc_count == 0)
+  {
+    memset(&mqtt_acc, 0, sizeof(mqtt_acc));
+    mqtt_acc.time_ms = sample.time_ms;
+    mqtt_acc.channel_mask = sample.channel_mask;
+  }
+  for (int ch = 0; ch < CHANNELS; ch++)
+  {
+    mqtt_acc.voltage[ch] += sample.load_voltage[ch];
+    mqtt_acc.current[ch] += sample.current_mA[ch];
+    mqtt_acc.power[ch] += sample.load_voltage[ch] * sample.current_mA[ch];
+    mqtt_acc.energy[ch] = sample.energy[ch];
+    mqtt_acc.capacity[ch] = sample.capacity[ch];
+  }
+  mqtt_acc_count++;
+}
+
+static void mqtt_make_topic(char *topic, size_t size, int ch)
+{
+  size_t len = 0;
+  for (const char *p = mqtt_config.topic; *p != '\0' && len < size - 1;)
+  {
+    if (strncmp(p, "{id}", 4) == 0)
+    {
+      len += snprintf(topic + len, size - len, "%s", mqtt_id);
+      p += 4;
+    }
+    else if (strncmp(p, "{ch}", 4) == 0)
+    {
+      len += snprintf(topic + len, size - len, "%d", ch + 1);
+      p += 4;
+    }
+    else
+    {
+      topic[len++] = *p++;
+    }
+  }
+  topic[len < size ? len : size - 1] = '\0';
+}
+
+// ----- snprintf that appends at len, len ends up >= size if the text did not fit ----- //
+static void mqtt_append(char *out, size_t size, size_t &len, const char *format, ...)
+{
+  if (len >= size)
+  {
+    return;
+  }
+  va_list args;
+  va_start(args, format);
+  int n = vsnprintf(out + len, size - len, format, args);
+  va_end(args);
+  len = n < 0 ? size : len + n;
+}
+
+// ----- Appends ,"key":[a,b,...] for one value of the points ----- //
+static void mqtt_put_array(char *out, size_t size, size_t &len, const char *key, const float *values, int count, int decimals)
+{
+  mqtt_append(out, size, len, ",\"%s\":[", key);
+  for (int i = 0; i < count; i++)
+  {
+    const float *value = (const float *)((const uint8_t *)values + i * sizeof(mqtt_point));
+    mqtt_append(out, size, len, "%s%.*f", i ? "," : "", decimals, *value);
+  }
+  mqtt_append(out, size, len, "]");
+}
+
+// ----- Publishes the oldest `count` points, one message per channel ----- //
+static bool mqtt_send_batch(int count)
+{
+  static char payload[MQTT_BUFFER_SIZE - 128];
+  static mqtt_point batch[MQTT_MAX_BATCH];
+  char topic[96];
+
+  for (int i = 0; i < count; i++)
+  {
+    batch[i] = mqtt_ring[(mqtt_ring_head + i) % MQTT_OFFLINE_POINTS];
+  }
+
+  size_t len = 0;
+  for (int ch = 0; ch < CHANNELS; ch++)
+  {
+    if ((batch[0].channel_mask & ~mqtt_sent_mask & (1 << ch)) == 0)
+    {
+      continue;
+    }
+    len = 0;
+    mqtt_append(payload, sizeof(payload), len, "{\"t\":[");
+    for (int i = 0; i < count; i++)
+    {
+      mqtt_append(payload, sizeof(payload), len, "%s%llu", i ? "," : "", (unsigned long long)ntp_epoch_ms(batch[i].time_ms));
+    }
+    mqtt_append(payload, sizeof(payload), len, "]");
+    mqtt_put_array(payload, sizeof(payload), len, "v", &batch[0].voltage[ch], count, 3);
+    mqtt_put_array(payload, sizeof(payload), len, "i", &batch[0].current[ch], count, 2);
+    mqtt_put_array(payload, sizeof(payload), len, "p", &batch[0].power[ch], count, 2);
+    mqtt_put_array(payload, sizeof(payload), len, "e", &batch[0].energy[ch], count, 3);
+    mqtt_put_array(payload, sizeof(payload), len, "c", &batch[0].capacity[ch], count, 3);
+    mqtt_append(payload, sizeof(payload), len, ",\"dropped\":%lu,\"lost\":%lu}", (unsigned long)mqtt_dropped, (unsigned long)mqtt_lost);
+    if (len >= sizeof(payload))
+    {
+      break; // cannot ever be sent, drop the points below instead of retrying forever
+    }
+
+    mqtt_make_topic(topic, sizeof(topic), ch);
+    if (!mqtt_client.publish(topic, (const uint8_t *)payload, len))
+    {
+      return false; // the retry resumes with this channel
+    }
+    mqtt_sent_mask |= 1 << ch;
+  }
+
+  if (len >= sizeof(payload))
+  {
+    mqtt_dropped += count;
+  }
+  mqtt_ring_head = (mqtt_ring_head + count) % MQTT_OFFLINE_POINTS;
+  mqtt_ring_count -= count;
+  mqtt_flush_points = mqtt_flush_points > count ? mqtt_flush_points - count : 0;
+  mqtt_sent_mask = 0;
+  return true;
+}
+
+// ----- Number of points of the next message: a full batch of one channel selection or the rest of a measurement ----- //
+static int mqtt_next_batch()
+{
+  int batch = mqtt_config.batch < 1 ? 1 : (mqtt_config.batch > MQTT_MAX_BATCH ? MQTT_MAX_BATCH : mqtt_config.batch);
+  uint8_t mask = mqtt_ring[mqtt_ring_head].channel_mask;
+  int count = 0;
+
+  while (count < batch && count < mqtt_ring_count && mqtt_ring[(mqtt_ring_head + count) % MQTT_OFFLINE_POINTS].channel_mask == mask)
+  {
+    count++;
+  }
+  if (count == batch || count < mqtt_ring_count || count <= mqtt_flush_points)
+  {
+    return count; // full batch, the channel selection changed after `count` points or the measurement ended
+  }
+  return 0;
+}
+
+static void mqtt_task(void *parameter)
+{
+  log_sample sample;
+  unsigned long last_attempt = 0;
+  bool attempted = false;
+
+  for (;;)
+  {
+    if (xQueueReceive(mqtt_queue, &sample, pdMS_TO_TICKS(100)) == pdTRUE)
+    {
+      mqtt_add_sample(sample);
+    }
+    if (mqtt_acc_count > 0 && millis() - mqtt_acc.time_ms >= mqtt_config.interval_ms + 1000)
+    {
+      mqtt_flush(); // sampling stopped, do not hold back the last points
+    }
+
+    if (!mqtt_client.connected())
+    {
+      if (WiFi.status() == WL_CONNECTED && (!attempted || millis() - last_attempt >= MQTT_RECONNECT_MS))
+      {
+        attempted = true;
+        last_attempt = millis();
+        mqtt_client.setServer(mqtt_config.host, mqtt_config.port);
+        if (mqtt_client.connect(mqtt_id))
+        {
+          cdc_console.printf("mqtt connected to %s\n", mqtt_config.host);
+        }
+      }
+      continue;
+    }
+
+    mqtt_client.loop();
+    for (int sent = 0; sent < 4; sent++) // catch up on a backlog a few messages per pass
+    {
+      int count = mqtt_next_batch();
+      if (count == 0 || !mqtt_send_batch(count))
+      {
+        break;
+      }
+    }
+  }
+}
+
+void mqtt_begin()
+{
+  if (mqtt_task_handle != NULL || mqtt_config.host[0] == '\0')
+  {
+    return;
+  }
+
+  uint64_t mac = ESP.getEfuseMac();
+  snprintf(mqtt_id, sizeof(mqtt_id), "pl-%02x%02x%02x", (uint8_t)(mac >> 24), (uint8_t)(mac >> 32), (uint8_t)(mac >> 40));
+  mqtt_client.setBufferSize(MQTT_BUFFER_SIZE);
+
+  mqtt_queue = xQueueCreate(MQTT_QUEUE_LENGTH, sizeof(log_sample));
+  xTaskCreate(mqtt_task, "mqtt", MQTT_TASK_STACK, NULL, MQTT_TASK_PRIORITY, &mqtt_task_handle);
+  metrics_task("mqtt", mqtt_task_handle);
+}
+
+void mqtt_publish(const log_sample &sample)
+{
+  if (mqtt_queue != NULL)
+  {
+    if (xQueueSend(mqtt_queue, &sample, 0) != pdTRUE)
+    {
+      mqtt_lost++;
+    }
+  }
+}
@@ -0,0 +1,216 @@
+#include "ntp_sync.h"
+#include <WiFi.h>
+#include <esp_timer.h>
+#include <lwip/sockets.h>
+#include "clock_model.h"
+#include "metrics.h"
+
+#define NTP_PORT 123
+#define NTP_LOCAL_PORT 2390
+#define NTP_PACKET_SIZE 48
+#define NTP_RETRY_MS 2000            // resend the request if no (usable) answer came back
+#define NTP_UNIX_OFFSET 2208988800UL // seconds between 1900 and 1970
+#define NTP_MAX_RTT_US 250000        // answers with a longer network round trip are too inaccurate
+#define NTP_TASK_STACK 3072
+#define NTP_TASK_PRIORITY 3 // above loop(), answers are stamped right when they arrive
+#define NTP_RECEIVE_MS 100
+
+static int ntp_socket = -1;
+static const char *ntp_server = "pool.ntp.org";
+static long ntp_utc_offset = 0;
+static bool ntp_waiting = false;
+static uint64_t ntp_request_us = 0;
+static uint64_t ntp_last_sync_us = 0;
+static uint32_t ntp_syncs = 0;
+static volatile bool ntp_answered = false; // set by the task, reported by ntp_sync_poll()
+
+static portMUX_TYPE ntp_lock = portMUX_INITIALIZER_UNLOCKED;
+static clock_model ntp_clock;
+
+uint64_t ntp_mono_us()
+{
+  return esp_timer_get_time();
+}
+
+// ----- The request carries its send time as transmit timestamp, the server echoes it as originate timestamp ----- //
+static void ntp_send_request(uint64_t now_us)
+{
+  uint8_t packet[NTP_PACKET_SIZE] = {0};
+  packet[0] = 0b11100011; // LI unsynchronised, version 4, client mode
+  packet[2] = 6;          // polling interval
+  packet[3] = 0xEC;       // clock precision
+  memcpy(packet + 40, &now_us, sizeof(now_us));
+
+  ntp_request_us = now_us;
+  ntp_waiting = true; // also when the name does not resolve, retried after NTP_RETRY_MS
+  IPAddress ip;
+  if (WiFi.hostByName(ntp_server, ip) != 1)
+  {
+    return;
+  }
+  sockaddr_in server = {};
+  server.sin_family = AF_INET;
+  server.sin_port = htons(NTP_PORT);
+  server.sin_addr.s_addr = (uint32_t)ip;
+  sendto(ntp_socket, packet, NTP_PACKET_SIZE, 0, (sockaddr *)&server, sizeof(server));
+}
+
+// ----- NTP timestamp at packet[index] as local time in us since 1970, 0 if invalid ----- //
+static int64_t ntp_read_timestamp(const uint8_t *packet, int index)
+{
+  uint32_t seconds = ((uint32_t)packet[index] << 24) | ((uint32_t)packet[index + 1] << 16) | ((uint32_t)packet[index + 2] << 8) | packet[index + 3];
+  uint32_t fraction = ((uint32_t)packet[index + 4] << 24) | ((uint32_t)packet[index + 5] << 16) | ((uint32_t)packet[index + 6] << 8) | packet[index + 7];
+  if (seconds < NTP_UNIX_OFFSET)
+  {
+    return 0; // kiss-o-death or garbage
+  }
+  return (int64_t)(seconds - NTP_UNIX_OFFSET + ntp_utc_offset) * 1000000 + (((uint64_t)fraction * 1000000) >> 32);
+}
+
+// ----- The NTP task and the peer sync task apply, loop() asks whether a resync is due ----- //
+static void ntp_apply(uint64_t mono_us, int64_t wall_us)
+{
+  portENTER_CRITICAL(&ntp_lock);
+  clock_model_apply(ntp_clock, mono_us, wall_us);
+  ntp_last_sync_us = mono_us; // peers resync on the NTP schedule in low power mode
+  ntp_syncs++;
+  portEXIT_CRITICAL(&ntp_lock);
+}
+
+// ----- A reference time from elsewhere (the master logger), instead of or besides NTP ----- //
+void ntp_sync_reference(uint64_t mono_us, int64_t wall_us)
+{
+  ntp_apply(mono_us, wall_us);
+}
+
+// ----- 64s after the first answer, doubled with every answer up to NTP_RESYNC_MS ----- //
+static uint64_t ntp_resync_us()
+{
+  uint64_t resync = (uint64_t)NTP_FIRST_RESYNC_MS << (ntp_syncs == 0 ? 0 : (ntp_syncs < 5 ? ntp_syncs - 1 : 4));
+  return (resync > NTP_RESYNC_MS ? NTP_RESYNC_MS : resync) * 1000;
+}
+
+bool ntp_sync_due()
+{
+  portENTER_CRITICAL(&ntp_lock);
+  bool due = !ntp_clock.valid || ntp_mono_us() - ntp_last_sync_us >= ntp_resync_us();
+  portEXIT_CRITICAL(&ntp_lock);
+  return due;
+}
+
+// ----- An answer to the outstanding request, arrived_us taken right after recv() returned ----- //
+static void ntp_handle_answer(const uint8_t *packet, uint64_t arrived_us)
+{
+  if (!ntp_waiting || memcmp(packet + 24, &ntp_request_us, sizeof(ntp_request_us)) != 0)
+  {
+    return; // late answer of an earlier request
+  }
+  int64_t received = ntp_read_timestamp(packet, 32);
+  int64_t transmitted = ntp_read_timestamp(packet, 40);
+  if (received == 0 || transmitted == 0)
+  {
+    return; // keep waiting, the request is repeated after NTP_RETRY_MS
+  }
+
+  // Round trip without the time the server held the packet
+  int64_t round_trip = (int64_t)(arrived_us - ntp_request_us) - (transmitted - received);
+  if (round_trip < 0)
+  {
+    round_trip = 0;
+  }
+  if (round_trip > NTP_MAX_RTT_US)
+  {
+    return;
+  }
+
+  ntp_waiting = false;
+  ntp_apply(arrived_us, transmitted + round_trip / 2);
+  ntp_answered = true;
+}
+
+static void ntp_sync_task(void *parameter)
+{
+  uint8_t packet[NTP_PACKET_SIZE];
+
+  for (;;)
+  {
+    int len = recv(ntp_socket, packet, sizeof(packet), 0);
+    uint64_t now_us = ntp_mono_us();
+    if (len >= NTP_PACKET_SIZE)
+    {
+      ntp_handle_answer(packet, now_us);
+    }
+
+    if (WiFi.status() == WL_CONNECTED &&
+        (ntp_waiting ? now_us - ntp_request_us >= NTP_RETRY_MS * 1000ULL : ntp_sync_due()))
+    {
+      ntp_send_request(ntp_mono_us());
+    }
+  }
+}
+
+void ntp_sync_begin(const char *server, long utc_offset_seconds)
+{
+  ntp_server = server;
+  ntp_utc_offset = utc_offset_seconds;
+  if (ntp_socket >= 0)
+  {
+    return;
+  }
+
+  ntp_socket = socket(AF_INET, SOCK_DGRAM, 0);
+  timeval timeout = {0, NTP_RECEIVE_MS * 1000};
+  setsockopt(ntp_socket, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+  sockaddr_in local = {};
+  local.sin_family = AF_INET;
+  local.sin_port = htons(NTP_LOCAL_PORT);
+  local.sin_addr.s_addr = htonl(INADDR_ANY);
+  bind(ntp_socket, (sockaddr *)&local, sizeof(local));
+
+  TaskHandle_t task = NULL;
+  xTaskCreate(ntp_sync_task, "ntp sync", NTP_TASK_STACK, NULL, NTP_TASK_PRIORITY, &task);
+  metrics_task("ntp_sync", task);
+}
+
+bool ntp_sync_poll()
+{
+  if (!ntp_answered)
+  {
+    return false;
+  }
+  ntp_answered = false;
+  return true;
+}
+
+bool ntp_sync_valid()
+{
+  return ntp_clock.valid;
+}
+
+uint64_t ntp_epoch_us(uint64_t mono_us)
+{
+  int64_t wall;
+  portENTER_CRITICAL(&ntp_lock);
+  wall = clock_model_at(ntp_clock, mono_us);
+  portEXIT_CRITICAL(&ntp_lock);
+  return wall;
+}
+
+uint64_t ntp_epoch_ms(unsigned long at_ms)
+{
+  // millis() wraps after 49 days, go back from now on the 64 bit timebase
+  uint64_t now_us = ntp_mono_us();
+  uint64_t age_us = (uint64_t)(uint32_t)(millis() - at_ms) * 1000;
+  return ntp_epoch_us(now_us > age_us ? now_us - age_us : 0) / 1000;
+}
+
+int32_t ntp_offset_us()
+{
+  return ntp_clock.offset_us;
+}
+
+int32_t ntp_drift_ppb()
+{
+  return ntp_clock.current.rate_ppb;
+}
@@ -0,0 +1,111 @@
+#include "numeric_blit.h"
+
+// ----- 5x7 glyphs from the classic GFX font, one byte per column, LSB is the top row ----- //
+static const char num_glyph_chars[] = "0123456789.-: ";
+static const uint8_t num_glyph_font[][5] PROGMEM = {
+    {0x3E, 0x51, 0x49, 0x45, 0x3E}, // 0
+    {0x00, 0x42, 0x7F, 0x40, 0x00}, // 1
+    {0x72, 0x49, 0x49, 0x49, 0x46}, // 2
+    {0x21, 0x41, 0x49, 0x4D, 0x33}, // 3
+    {0x18, 0x14, 0x12, 0x7F, 0x10}, // 4
+    {0x27, 0x45, 0x45, 0x45, 0x39}, // 5
+    {0x3C, 0x4A, 0x49, 0x49, 0x31}, // 6
+    {0x41, 0x21, 0x11, 0x09, 0x07}, // 7
+    {0x36, 0x49, 0x49, 0x49, 0x36}, // 8
+    {0x46, 0x49, 0x49, 0x29, 0x1E}, // 9
+    {0x00, 0x60, 0x60, 0x00, 0x00}, // .
+    {0x08, 0x08, 0x08, 0x08, 0x08}, // -
+    {0x00, 0x36, 0x36, 0x00, 0x00}, // :
+    {0x00, 0x00, 0x00, 0x00, 0x00}, // space
+};
+#define NUM_GLYPHS (sizeof(num_glyph_font) / sizeof(num_glyph_font[0]))
+#define NUM_BLANK (NUM_GLYPHS - 1)
+
+// ----- Pre-scaled atlas: one 12 bit row mask per pixel row, bit 11 is the left pixel ----- //
+static uint16_t num_atlas[NUM_GLYPHS][NUM_GLYPH_HEIGHT];
+static uint8_t num_glyph_index[128];
+static uint16_t num_line[NUM_MAX_CHARS * NUM_GLYPH_WIDTH];
+
+void num_blit_init()
+{
+  for (int c = 0; c < 128; c++)
+  {
+    num_glyph_index[c] = NUM_BLANK;
+  }
+  for (uint8_t g = 0; g < NUM_GLYPHS; g++)
+  {
+    num_glyph_index[(uint8_t)num_glyph_chars[g]] = g;
+    for (int row = 0; row < NUM_GLYPH_HEIGHT; row++)
+    {
+      uint16_t mask = 0;
+      for (int col = 0; col < 5; col++)
+      {
+        if (pgm_read_byte(&num_glyph_font[g][col]) & (1 << (row / 2)))
+        {
+          mask |= 0x3 << (10 - 2 * col); // every font pixel becomes 2x2, the 6th column is spacing
+        }
+      }
+      num_atlas[g][row] = mask;
+    }
+  }
+}
+
+void num_blit_text(Adafruit_SPITFT &tft, int16_t x, int16_t y, const char *text, uint8_t chars, uint16_t fg, uint16_t bg)
+{
+  uint8_t glyphs[NUM_MAX_CHARS];
+  size_t len = strlen(text);
+
+  if (chars > NUM_MAX_CHARS)
+  {
+    chars = NUM_MAX_CHARS;
+  }
+  for (uint8_t i = 0; i < chars; i++)
+  {
+    // right align, keep the rightmost characters if the text is longer than the field
+    int src = (int)len - chars + i;
+    glyphs[i] = (src < 0 || (uint8_t)text[src] >= 128) ? NUM_BLANK : num_glyph_index[(uint8_t)text[src]];
+  }
+
+  tft.startWrite();
+  tft.setAddrWindow(x, y, chars * NUM_GLYPH_WIDTH, NUM_GLYPH_HEIGHT);
+  for (int row = 0; row < NUM_GLYPH_HEIGHT; row++)
+  {
+    uint16_t *out = num_line;
+    for (uint8_t i = 0; i < chars; i++)
+    {
+      uint16_t mask = num_atlas[glyphs[i]][row];
+      for (int bit = NUM_GLYPH_WIDTH - 1; bit >= 0; bit--)
+      {
+        *out++ = (mask >> bit) & 1 ? fg : bg;
+      }
+    }
+    tft.writePixels(num_line, chars * NUM_GLYPH_WIDTH);
+  }
+  tft.endWrite();
+}
+
+void num_blit_float(Adafruit_SPITFT &tft, int16_t x, int16_t y, float value, uint8_t chars, uint8_t decimals, uint16_t fg, uint16_t bg)
+{
+  char text[24];
+  int len = 0;
+
+  if (chars > NUM_MAX_CHARS)
+  {
+    chars = NUM_MAX_CHARS;
+  }
+  // 12345.67 does not fit into 7 cells, 12345.7 does
+  for (int d = decimals; d >= 0; d--)
+  {
+    len = snprintf(text, sizeof(text), "%.*f", d, value);
+    if (len <= chars)
+    {
+      break;
+    }
+  }
+  if (len > chars || len < 0)
+  {
+    memset(text, '-', chars); // out of range, never show a truncated number
+    text[chars] = '\0';
+  }
+  num_blit_text(tft, x, y, text, chars, fg, bg);
+}
@@ -0,0 +1,139 @@
+#include "peer_sync.h"
+#include "peer_sync_protocol.h"
+#include "ntp_sync.h"
+#include "metrics.h"
+#include "cdc_stream.h"
+#include <WiFi.h>
+#include <lwip/sockets.h>
+
+#define PEER_SYNC_TASK_STACK 3072
+#define PEER_SYNC_TASK_PRIORITY 3 // above loop(), packets are stamped right when they arrive
+#define PEER_SYNC_RECEIVE_MS 100
+
+static int peer_socket = -1;
+static sockaddr_in peer_broadcast;
+static uint32_t peer_id = 0;
+static uint32_t peer_master_id = 0; // master the peer follows, the first one that answered
+static uint64_t peer_request_t1 = 0;
+static peer_sync_filter peer_filter;
+static int32_t peer_offset_us = 0; // master minus own clock at the last applied exchange
+static int32_t peer_round_trip_us = 0;
+static uint32_t peer_exchanges = 0;
+
+static void peer_send(const peer_sync_packet &packet)
+{
+  uint8_t buffer[PEER_SYNC_PACKET_SIZE];
+  size_t len = peer_sync_encode(packet, buffer);
+  sendto(peer_socket, buffer, len, 0, (sockaddr *)&peer_broadcast, sizeof(peer_broadcast));
+}
+
+static void peer_handle_packet(const peer_sync_packet &packet, uint64_t arrived_us)
+{
+  if (PEER_SYNC_ROLE == PEER_SYNC_MASTER && packet.type == PEER_SYNC_REQUEST)
+  {
+    if (ntp_sync_valid() == false)
+    {
+      return; // the clock is still the uptime, peers would lock to 1970
+    }
+    peer_sync_packet response = packet;
+    response.type = PEER_SYNC_RESPONSE;
+    response.master_id = peer_id;
+    response.t2 = ntp_epoch_us(arrived_us);
+    response.t3 = ntp_epoch_us(ntp_mono_us());
+    peer_send(response);
+    peer_exchanges++;
+    return;
+  }
+
+  if (PEER_SYNC_ROLE != PEER_SYNC_PEER || packet.type != PEER_SYNC_RESPONSE || packet.peer_id != peer_id ||
+      packet.t1 != peer_request_t1 || (peer_master_id != 0 && packet.master_id != peer_master_id))
+  {
+    return;
+  }
+  peer_master_id = packet.master_id;
+  peer_exchanges++;
+
+  // The first exchange sets the clock right away, later ones are filtered
+  if (peer_sync_filter_add(peer_filter, packet, arrived_us) || ntp_sync_valid() == false)
+  {
+    uint64_t now_us = ntp_mono_us();
+    int64_t master_us = peer_sync_filter_master_at(peer_filter, now_us, ntp_drift_ppb());
+    int64_t offset = master_us - (int64_t)ntp_epoch_us(now_us);
+    peer_offset_us = offset > INT32_MAX ? INT32_MAX : (offset < INT32_MIN ? INT32_MIN : offset);
+    peer_round_trip_us = peer_filter.round_trip_us;
+    ntp_sync_reference(now_us, master_us);
+    peer_filter.count = 0;
+  }
+}
+
+static void peer_sync_task(void *parameter)
+{
+  uint8_t buffer[64];
+  uint64_t last_request_us = 0;
+
+  for (;;)
+  {
+    int len = recv(peer_socket, buffer, sizeof(buffer), 0);
+    uint64_t now_us = ntp_mono_us();
+    peer_sync_packet packet;
+    if (len > 0 && peer_sync_decode(buffer, len, packet))
+    {
+      peer_handle_packet(packet, now_us);
+    }
+
+    if (PEER_SYNC_ROLE == PEER_SYNC_PEER && now_us - last_request_us >= PEER_SYNC_INTERVAL_MS * 1000ULL)
+    {
+      peer_sync_packet request = {PEER_SYNC_REQUEST, peer_id, 0, 0, 0, 0};
+      request.t1 = ntp_mono_us();
+      peer_request_t1 = request.t1;
+      peer_send(request);
+      last_request_us = now_us;
+    }
+  }
+}
+
+void peer_sync_begin()
+{
+  if (PEER_SYNC_ROLE == PEER_SYNC_OFF || peer_socket >= 0)
+  {
+    return;
+  }
+
+  peer_id = (uint32_t)(ESP.getEfuseMac() >> 16); // the three device bytes of the MAC and one vendor byte
+  peer_socket = socket(AF_INET, SOCK_DGRAM, 0);
+  int one = 1;
+  setsockopt(peer_socket, SOL_SOCKET, SO_BROADCAST, &one, sizeof(one));
+  timeval timeout = {0, PEER_SYNC_RECEIVE_MS * 1000};
+  setsockopt(peer_socket, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+  sockaddr_in local = {};
+  local.sin_family = AF_INET;
+  local.sin_port = htons(PEER_SYNC_PORT);
+  local.sin_addr.s_addr = htonl(INADDR_ANY);
+  bind(peer_socket, (sockaddr *)&local, sizeof(local));
+
+  peer_broadcast = {};
+  peer_broadcast.sin_family = AF_INET;
+  peer_broadcast.sin_port = htons(PEER_SYNC_PORT);
+  peer_broadcast.sin_addr.s_addr = (uint32_t)WiFi.broadcastIP();
+
+  TaskHandle_t task = NULL;
+  xTaskCreate(peer_sync_task, "peer sync", PEER_SYNC_TASK_STACK, NULL, PEER_SYNC_TASK_PRIORITY, &task);
+  metrics_task("peer_sync", task);
+  cdc_console.printf("peer sync as %s, id %08lx\n", PEER_SYNC_ROLE == PEER_SYNC_MASTER ? "master" : "peer", (unsigned long)peer_id);
+}
+
+void peer_sync_header(char *text, size_t size)
+{
+  if (PEER_SYNC_ROLE == PEER_SYNC_PEER)
+  {
+    snprintf(text, size, "# time=peer master=%08lx offset_us=%ld round_trip_us=%ld drift_ppb=%ld exchanges=%lu",
+             (unsigned long)peer_master_id, (long)peer_offset_us, (long)peer_round_trip_us, (long)ntp_drift_ppb(),
+             (unsigned long)peer_exchanges);
+  }
+  else
+  {
+    snprintf(text, size, "# time=%s offset_us=%ld drift_ppb=%ld%s", ntp_sync_valid() ? "ntp" : "none",
+             (long)ntp_offset_us(), (long)ntp_drift_ppb(), PEER_SYNC_ROLE == PEER_SYNC_MASTER ? " role=master" : "");
+  }
+}
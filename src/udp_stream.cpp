@@ -0,0 +1,123 @@
+#include "udp_stream.h"
+#include "cdc_stream.h"
+#include <WiFi.h>
+#include <WiFiUdp.h>
+
+#define UDP_HEADER 10
+#define UDP_MAX_RECORD (9 + CHANNELS * 16)
+
+static WiFiUDP udp_stream;
+static IPAddress udp_host;
+static bool udp_active = false;
+static uint16_t udp_session = 0;
+static uint32_t udp_datagram = 0;
+static uint32_t udp_errors = 0;
+
+static uint8_t udp_buffer[UDP_HEADER + UDP_STREAM_BATCH * UDP_MAX_RECORD];
+static size_t udp_length = UDP_HEADER;
+static uint8_t udp_count = 0;
+static unsigned long udp_first_ms = 0; // millis() of the oldest buffered sample
+
+void udp_stream_begin()
+{
+  if (strlen(UDP_STREAM_HOST) == 0 || !udp_host.fromString(UDP_STREAM_HOST))
+  {
+    return;
+  }
+  udp_stream.begin(UDP_STREAM_PORT);
+  udp_active = true;
+  cdc_console.printf("UDP stream to %s:%d\n", UDP_STREAM_HOST, UDP_STREAM_PORT);
+}
+
+uint32_t udp_stream_errors()
+{
+  return udp_errors;
+}
+
+static void udp_send()
+{
+  udp_buffer[0] = 'P';
+  udp_buffer[1] = 'L';
+  udp_buffer[2] = UDP_STREAM_VERSION;
+  udp_buffer[3] = udp_count;
+  memcpy(udp_buffer + 4, &udp_session, 2);
+  memcpy(udp_buffer + 6, &udp_datagram, 4);
+  udp_datagram++;
+
+  // UDP never waits for the receiver, a full lwIP buffer only costs this datagram
+  if (!udp_stream.beginPacket(udp_host, UDP_STREAM_PORT) ||
+      udp_stream.write(udp_buffer, udp_length) != udp_length || !udp_stream.endPacket())
+  {
+    udp_errors++;
+  }
+  udp_length = UDP_HEADER;
+  udp_count = 0;
+}
+
+long udp_stream_poll()
+{
+  if (udp_count == 0)
+  {
+    return -1;
+  }
+  long due = (long)(udp_first_ms + UDP_STREAM_MAX_DELAY - millis());
+  if (due <= 0)
+  {
+    udp_send();
+    return -1;
+  }
+  return due;
+}
+
+void udp_stream_flush()
+{
+  if (udp_count > 0)
+  {
+    udp_send();
+  }
+}
+
+void udp_stream_sample(const log_sample &sample)
+{
+  if (!udp_active)
+  {
+    return;
+  }
+  if (sample.seq == 0)
+  {
+    if (udp_count > 0)
+    {
+      udp_send();
+    }
+    udp_session++;
+  }
+  if (udp_count == 0)
+  {
+    udp_first_ms = sample.time_ms;
+  }
+
+  uint8_t *p = udp_buffer + udp_length;
+  memcpy(p, &sample.seq, 4);
+  uint32_t time_us = sample.time_us;
+  memcpy(p + 4, &time_us, 4);
+  p[8] = sample.channel_mask;
+  p += 9;
+  for (int ch = 0; ch < CHANNELS; ch++)
+  {
+    if (sample.channel_mask & (1 << ch))
+    {
+      memcpy(p, &sample.load_voltage[ch], 4);
+      memcpy(p + 4, &sample.current_mA[ch], 4);
+      memcpy(p + 8, &sample.energy[ch], 4);
+      memcpy(p + 12, &sample.capacity[ch], 4);
+      p += 16;
+    }
+  }
+  udp_length = p - udp_buffer;
+  udp_count++;
+
+  if (udp_count == UDP_STREAM_BATCH || sample.time_ms - udp_first_ms >= UDP_STREAM_MAX_DELAY)
+  {
+    udp_send();
+  }
+}
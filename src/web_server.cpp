@@ -0,0 +1,394 @@
+#include "web_server.h"
+#include "web_dashboard.h"
+#include "metrics.h"
+#include "cdc_stream.h"
+#include "control_api.h"
+#include <WiFi.h>
+#include <WebServer.h>
+#include <WebSocketsServer.h>
+#include <ESPmDNS.h>
+#include <SD.h>
+
+#define WEB_QUEUE_LENGTH 32     // samples buffered between loop() and the web task
+#define WEB_BATCH_SAMPLES 16    // samples per WebSocket frame at most
+#define WEB_BATCH_MS 500        // send a partial batch after this time
+#define WEB_TASK_STACK 6144
+#define WEB_TASK_PRIORITY 1     // loop() runs at 2, see setup()
+#define WEB_FRAME_HEADER 4
+#define WEB_SAMPLE_HEADER 8
+#define WEB_CHANNEL_VALUES 5
+#define WEB_FILE_CHUNK 2048     // bytes read from the SD card per write to the socket
+
+static WebServer web_http(WEB_HTTP_PORT);
+static WebSocketsServer web_ws(WEB_WS_PORT);
+static QueueHandle_t web_queue = NULL;
+static TaskHandle_t web_task_handle = NULL;
+static uint8_t web_frame[WEB_FRAME_HEADER + WEB_BATCH_SAMPLES * (WEB_SAMPLE_HEADER + CHANNELS * WEB_CHANNEL_VALUES * 4)];
+static size_t web_frame_len = 0;
+static uint16_t web_frame_count = 0;
+static uint8_t web_frame_mask = 0;
+static unsigned long web_frame_start = 0;
+static uint8_t web_file_buffer[WEB_FILE_CHUNK];
+static char web_metrics_buffer[METRICS_BUFFER_SIZE];
+
+static void web_put(const void *value, size_t len)
+{
+  memcpy(web_frame + web_frame_len, value, len); // ESP32 is little endian like the frame
+  web_frame_len += len;
+}
+
+static void web_flush_frame()
+{
+  if (web_frame_count > 0 && web_ws.connectedClients() > 0)
+  {
+    web_frame[0] = 1;
+    web_frame[1] = web_frame_mask;
+    memcpy(web_frame + 2, &web_frame_count, 2);
+    web_ws.broadcastBIN(web_frame, web_frame_len);
+  }
+  web_frame_len = WEB_FRAME_HEADER;
+  web_frame_count = 0;
+}
+
+static void web_add_sample(const log_sample &sample)
+{
+  // a frame only holds samples of one channel selection
+  if (web_frame_count > 0 && sample.channel_mask != web_frame_mask)
+  {
+    web_flush_frame();
+  }
+  if (web_frame_count == 0)
+  {
+    web_frame_mask = sample.channel_mask;
+    web_frame_start = millis();
+  }
+
+  uint32_t time_ms = sample.time_ms;
+  web_put(&sample.seq, 4);
+  web_put(&time_ms, 4);
+  for (int ch = 0; ch < CHANNELS; ch++)
+  {
+    if (sample.channel_mask & (1 << ch))
+    {
+      float power = sample.load_voltage[ch] * sample.current_mA[ch];
+      web_put(&sample.load_voltage[ch], 4);
+      web_put(&sample.current_mA[ch], 4);
+      web_put(&power, 4);
+      web_put(&sample.energy[ch], 4);
+      web_put(&sample.capacity[ch], 4);
+    }
+  }
+  web_frame_count++;
+
+  if (web_frame_count >= WEB_BATCH_SAMPLES)
+  {
+    web_flush_frame();
+  }
+}
+
+static void web_handle_root()
+{
+  web_http.send_P(200, "text/html", web_dashboard_html);
+}
+
+// ----- GET /metrics: Prometheus text format, written straight to the socket without String headers ----- //
+static void web_handle_metrics()
+{
+  static const char header[] = "HTTP/1.1 200 OK\r\n"
+                               "Content-Type: text/plain; version=0.0.4\r\n"
+                               "Connection: close\r\n"
+                               "Content-Length: %u\r\n\r\n";
+  char head[sizeof(header) + 8];
+  size_t len = metrics_format(web_metrics_buffer, sizeof(web_metrics_buffer));
+  if (len == 0)
+  {
+    web_http.send(500, "text/plain", "metrics buffer too small");
+    return;
+  }
+
+  WiFiClient client = web_http.client();
+  client.write((const uint8_t *)head, snprintf(head, sizeof(head), header, (unsigned)len));
+  client.write((const uint8_t *)web_metrics_buffer, len);
+}
+
+// ----- GET /api: status, POST /api: a JSON command (see control_api.h) ----- //
+static void web_handle_api()
+{
+  control_command command;
+  char reply[CONTROL_REPLY_SIZE];
+
+  if (web_http.method() == HTTP_GET)
+  {
+    command.action = CONTROL_STATUS;
+    command.fields = 0;
+  }
+  else
+  {
+    const String &body = web_http.arg("plain");
+    char error[64];
+    if (!control_parse(body.c_str(), body.length(), command, error, sizeof(error)))
+    {
+      snprintf(reply, sizeof(reply), "{\"ok\":false,\"error\":\"%s\"}", error);
+      web_http.send(400, "application/json", reply);
+      return;
+    }
+  }
+
+  // On a timeout or a second client the reply holds the error
+  bool answered = control_submit(command, reply, sizeof(reply));
+  web_http.send(answered ? 200 : 503, "application/json", reply);
+}
+
+// ----- Copies text into a JSON string, escaping quotes, backslashes and control characters ----- //
+static void web_json_escape(char *out, size_t size, const char *text)
+{
+  size_t len = 0;
+  for (; *text != '\0' && len + 7 < size; text++)
+  {
+    if (*text == '"' || *text == '\\')
+    {
+      out[len++] = '\\';
+      out[len++] = *text;
+    }
+    else if ((uint8_t)*text < 0x20)
+    {
+      len += snprintf(out + len, size - len, "\\u%04x", (uint8_t)*text);
+    }
+    else
+    {
+      out[len++] = *text;
+    }
+  }
+  out[len] = '\0';
+}
+
+// ----- GET /files: JSON list of the files in the root of the SD card ----- //
+static void web_handle_file_list()
+{
+  File root = SD.open("/");
+  if (!root || !root.isDirectory())
+  {
+    web_http.send(503, "text/plain", "no SD card");
+    return;
+  }
+
+  web_http.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  web_http.send(200, "application/json", "");
+  web_http.sendContent("[");
+  bool first = true;
+  for (File entry = root.openNextFile(); entry; entry = root.openNextFile())
+  {
+    if (!entry.isDirectory())
+    {
+      char name[128];
+      char line[160];
+      const char *base = strrchr(entry.name(), '/');
+      web_json_escape(name, sizeof(name), base ? base + 1 : entry.name());
+      snprintf(line, sizeof(line), "%s{\"name\":\"%s\",\"size\":%u}", first ? "" : ",", name, (unsigned)entry.size());
+      web_http.sendContent(line);
+      first = false;
+    }
+    entry.close();
+  }
+  web_http.sendContent("]");
+  web_http.sendContent("");
+  root.close();
+}
+
+// ----- Parses "bytes=first-last", "bytes=first-" and "bytes=-suffix" ----- //
+static bool web_parse_range(const String &range, size_t size, size_t &first, size_t &last)
+{
+  const char *text = range.c_str();
+  if (strncmp(text, "bytes=", 6) != 0 || size == 0)
+  {
+    return false;
+  }
+  text += 6;
+
+  char *end;
+  if (*text == '-')
+  {
+    size_t suffix = strtoul(text + 1, &end, 10);
+    if (suffix == 0)
+    {
+      return false;
+    }
+    first = suffix >= size ? 0 : size - suffix;
+    last = size - 1;
+    return true;
+  }
+
+  first = strtoul(text, &end, 10);
+  if (*end != '-' || first >= size)
+  {
+    return false;
+  }
+  last = end[1] == '\0' ? size - 1 : strtoul(end + 1, NULL, 10);
+  if (last >= size)
+  {
+    last = size - 1;
+  }
+  return last >= first;
+}
+
+// ----- Content type of a download by the extension of the file ----- //
+static const char *web_content_type(const char *name)
+{
+  const char *extension = strrchr(name, '.');
+  if (extension == NULL)
+  {
+    return "application/octet-stream";
+  }
+  if (strcasecmp(extension, ".txt") == 0)
+  {
+    return "text/plain";
+  }
+  if (strcasecmp(extension, ".csv") == 0)
+  {
+    return "text/csv";
+  }
+  if (strcasecmp(extension, ".json") == 0)
+  {
+    return "application/json";
+  }
+  return "application/octet-stream"; // /pending.bin and anything else
+}
+
+// ----- GET /files/<name>: streams the file in chunks, honours Range for resumed downloads ----- //
+static void web_handle_file_download()
+{
+  String uri = web_http.uri();
+  const char *name = uri.c_str() + strlen("/files/");
+
+  if (*name == '\0' || strchr(name, '/') != NULL || strstr(name, "..") != NULL)
+  {
+    web_http.send(400, "text/plain", "bad file name");
+    return;
+  }
+
+  char path[64];
+  snprintf(path, sizeof(path), "/%s", name);
+  File file = SD.open(path, FILE_READ);
+  if (!file || file.isDirectory())
+  {
+    web_http.send(404, "text/plain", "not found");
+    return;
+  }
+
+  size_t size = file.size();
+  size_t first = 0;
+  size_t last = size == 0 ? 0 : size - 1;
+  int status = 200;
+  if (web_http.hasHeader("Range"))
+  {
+    if (!web_parse_range(web_http.header("Range"), size, first, last))
+    {
+      char content_range[32];
+      snprintf(content_range, sizeof(content_range), "bytes */%u", (unsigned)size);
+      web_http.sendHeader("Content-Range", content_range);
+      web_http.send(416, "text/plain", "range not satisfiable");
+      file.close();
+      return;
+    }
+    char content_range[48];
+    snprintf(content_range, sizeof(content_range), "bytes %u-%u/%u", (unsigned)first, (unsigned)last, (unsigned)size);
+    web_http.sendHeader("Content-Range", content_range);
+    status = 206;
+  }
+
+  size_t remaining = size == 0 ? 0 : last - first + 1;
+  web_http.sendHeader("Accept-Ranges", "bytes");
+  char disposition[96];
+  snprintf(disposition, sizeof(disposition), "attachment; filename=\"%s\"", name);
+  web_http.sendHeader("Content-Disposition", disposition);
+  web_http.setContentLength(remaining);
+  web_http.send(status, web_content_type(name), "");
+
+  // Read chunk by chunk, the SD writer task only waits for one chunk at a time
+  WiFiClient client = web_http.client();
+  file.seek(first);
+  while (remaining > 0 && client.connected())
+  {
+    size_t n = file.read(web_file_buffer, remaining < WEB_FILE_CHUNK ? remaining : WEB_FILE_CHUNK);
+    if (n == 0 || client.write(web_file_buffer, n) != n)
+    {
+      break;
+    }
+    remaining -= n;
+  }
+  file.close();
+}
+
+static void web_handle_not_found()
+{
+  if (web_http.uri().startsWith("/files/"))
+  {
+    web_handle_file_download();
+    return;
+  }
+  web_http.send(404, "text/plain", "not found");
+}
+
+static void web_task(void *parameter)
+{
+  log_sample sample;
+
+  for (;;)
+  {
+    web_http.handleClient();
+    web_ws.loop();
+
+    // Waiting on the queue doubles as the idle time of this task
+    while (xQueueReceive(web_queue, &sample, pdMS_TO_TICKS(10)) == pdTRUE)
+    {
+      web_add_sample(sample);
+      if (uxQueueMessagesWaiting(web_queue) == 0)
+      {
+        break;
+      }
+    }
+    if (web_frame_count > 0 && millis() - web_frame_start >= WEB_BATCH_MS)
+    {
+      web_flush_frame();
+    }
+  }
+}
+
+void web_begin()
+{
+  if (web_task_handle != NULL)
+  {
+    return;
+  }
+
+  if (MDNS.begin(WEB_HOSTNAME))
+  {
+    MDNS.addService("http", "tcp", WEB_HTTP_PORT);
+    MDNS.addService("ws", "tcp", WEB_WS_PORT);
+  }
+
+  const char *headers[] = {"Range"};
+  web_http.on("/", HTTP_GET, web_handle_root);
+  web_http.on("/files", HTTP_GET, web_handle_file_list);
+  web_http.on("/metrics", HTTP_GET, web_handle_metrics);
+  web_http.on("/api", HTTP_GET, web_handle_api);
+  web_http.on("/api", HTTP_POST, web_handle_api);
+  web_http.onNotFound(web_handle_not_found);
+  web_http.collectHeaders(headers, 1);
+  web_http.begin();
+  web_ws.begin();
+  web_frame_len = WEB_FRAME_HEADER;
+
+  web_queue = xQueueCreate(WEB_QUEUE_LENGTH, sizeof(log_sample));
+  xTaskCreate(web_task, "web", WEB_TASK_STACK, NULL, WEB_TASK_PRIORITY, &web_task_handle);
+  metrics_task("web", web_task_handle);
+  cdc_console.println("web dashboard at http://" WEB_HOSTNAME ".local/");
+}
+
+void web_publish(const log_sample &sample)
+{
+  if (web_queue != NULL)
+  {
+    xQueueSend(web_queue, &sample, 0);
+  }
+}
@@ -0,0 +1,163 @@
+/*--------------------------------------------------------------------------------
+Host tests of the wall clock model (include/clock_model.h)
+
+  pio test -e native
+
+A simulated crystal runs fast or slow against the true time, references are
+applied the way the NTP client and the peer sync do, and the model is read
+back at 1ms steps like the log timestamps.
+--------------------------------------------------------------------------------*/
+
+#include <unity.h>
+#include "clock_model.h"
+
+#define EPOCH_US 1700000000000000LL // some wall clock in 2023
+#define HOUR_US 3600000000LL
+
+// ----- True wall clock at a timebase stamp of a crystal that is drift_ppm off ----- //
+static int64_t true_wall(int64_t start_wall, uint64_t mono_us, double drift_ppm)
+{
+  return start_wall + (int64_t)(mono_us / (1 + drift_ppm / 1e6));
+}
+
+// ----- Applies references every period_us and checks the model at 1ms steps in between ----- //
+struct run_result
+{
+  bool monotonic;
+  int64_t worst_us; // largest error after the settle time
+};
+
+static run_result run(clock_model &model, uint64_t from_us, uint64_t to_us, uint64_t period_us, int64_t start_wall,
+                      double drift_ppm, uint64_t settle_us)
+{
+  run_result result = {true, 0};
+  int64_t last = clock_model_at(model, from_us);
+  for (uint64_t mono = from_us; mono <= to_us; mono += 1000)
+  {
+    if ((mono - from_us) % period_us == 0)
+    {
+      clock_model_apply(model, mono, true_wall(start_wall, mono, drift_ppm));
+    }
+    int64_t wall = clock_model_at(model, mono);
+    result.monotonic = result.monotonic && wall >= last;
+    last = wall;
+    int64_t error = wall - true_wall(start_wall, mono, drift_ppm);
+    error = error < 0 ? -error : error;
+    if (mono - from_us >= settle_us && error > result.worst_us)
+    {
+      result.worst_us = error;
+    }
+  }
+  return result;
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void test_first_reference_sets_the_clock()
+{
+  clock_model model = {};
+  TEST_ASSERT_EQUAL_INT64(5000, clock_model_at(model, 5000)); // the timebase until then
+  clock_model_apply(model, 5000, EPOCH_US);
+  TEST_ASSERT_TRUE(model.valid);
+  TEST_ASSERT_EQUAL_INT64(EPOCH_US + 1000, clock_model_at(model, 6000));
+}
+
+// ----- A 40ppm crystal with an NTP answer every 64s stays within a millisecond ----- //
+void test_drift_is_corrected()
+{
+  clock_model model = {};
+  run_result result = run(model, 0, 6 * HOUR_US, 64000000, EPOCH_US, 40, 10 * 60000000LL);
+  TEST_ASSERT_TRUE(result.monotonic);
+  TEST_ASSERT_LESS_THAN_INT64(1000, result.worst_us);
+  TEST_ASSERT_INT32_WITHIN(2000, -40000, model.current.rate_ppb);
+}
+
+// ----- An error is slewed out at CLOCK_MAX_SLEW_PPM, forward and backward, without a jump ----- //
+void test_offset_is_slewed()
+{
+  const int64_t errors[2] = {20000, -20000};
+  for (int i = 0; i < 2; i++)
+  {
+    clock_model model = {};
+    clock_model_apply(model, 0, EPOCH_US);
+    clock_model_apply(model, 10000000, EPOCH_US + 10000000 + errors[i]);
+    TEST_ASSERT_EQUAL_INT32(errors[i], model.offset_us);
+    TEST_ASSERT_EQUAL_INT64(EPOCH_US + 10000000, clock_model_at(model, 10000000)); // no jump
+
+    int64_t last = clock_model_at(model, 10000000);
+    for (uint64_t mono = 11000000; mono <= 60000000; mono += 1000000)
+    {
+      int64_t wall = clock_model_at(model, mono);
+      TEST_ASSERT_INT32_WITHIN(CLOCK_MAX_SLEW_PPM + 1, 1000000, wall - last); // per second
+      last = wall;
+    }
+    // 20ms at 0.5ms/s are out after 40s
+    TEST_ASSERT_EQUAL_INT64(EPOCH_US + 60000000 + errors[i], clock_model_at(model, 60000000));
+  }
+}
+
+// ----- Stamps taken before a reference still read the segment they were taken in ----- //
+void test_earlier_stamps_use_the_previous_segment()
+{
+  clock_model model = {};
+  clock_model_apply(model, 0, EPOCH_US);
+  clock_model_apply(model, 10000000, EPOCH_US + 10005000);
+  TEST_ASSERT_EQUAL_INT64(EPOCH_US + 9000000, clock_model_at(model, 9000000));
+}
+
+// ----- A forward error above CLOCK_STEP_US is stepped and the drift measurement starts over ----- //
+void test_step_restarts_the_drift_measurement()
+{
+  clock_model model = {};
+  // locked to a clock that started at 1970 (a master without NTP) for two hours
+  run_result before = run(model, 0, 2 * HOUR_US, 1000000, 0, 20, 0);
+  TEST_ASSERT_TRUE(before.monotonic);
+
+  // then 56 years forward, the references keep coming every second
+  int64_t start = 56LL * 365 * 24 * HOUR_US;
+  uint64_t step_at = 2 * HOUR_US + 1000000;
+  clock_model_apply(model, step_at, true_wall(start, step_at, 20));
+  TEST_ASSERT_EQUAL_INT64(true_wall(start, step_at, 20), clock_model_at(model, step_at));
+  TEST_ASSERT_FALSE(model.drift_settled);
+  TEST_ASSERT_EQUAL_UINT64(step_at, model.base_mono);
+
+  run_result after = run(model, step_at, step_at + 5 * HOUR_US, 1000000, start, 20, 0);
+  TEST_ASSERT_TRUE(after.monotonic);
+  TEST_ASSERT_LESS_THAN_INT64(1000, after.worst_us);
+  TEST_ASSERT_INT32_WITHIN(1000, -20000, model.current.rate_ppb);
+}
+
+// ----- Backward errors are never stepped, the clock keeps increasing ----- //
+void test_backward_error_is_not_stepped()
+{
+  clock_model model = {};
+  clock_model_apply(model, 0, EPOCH_US);
+  clock_model_apply(model, 120000000, EPOCH_US + 120000000 - 3 * HOUR_US);
+  TEST_ASSERT_EQUAL_INT64(EPOCH_US + 120000000, clock_model_at(model, 120000000));
+
+  int64_t last = clock_model_at(model, 120000000);
+  for (uint64_t mono = 120000000; mono <= 120000000 + HOUR_US; mono += 1000000)
+  {
+    int64_t wall = clock_model_at(model, mono);
+    TEST_ASSERT_TRUE(wall >= last);
+    last = wall;
+  }
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_first_reference_sets_the_clock);
+  RUN_TEST(test_drift_is_corrected);
+  RUN_TEST(test_offset_is_slewed);
+  RUN_TEST(test_earlier_stamps_use_the_previous_segment);
+  RUN_TEST(test_step_restarts_the_drift_measurement);
+  RUN_TEST(test_backward_error_is_not_stepped);
+  return UNITY_END();
+}
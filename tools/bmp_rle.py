@@ -0,0 +1,164 @@
+# --------------------------------------------------------------------------------
+# Boot image converter
+#
+# Reads a raw RGB565 C array (as produced by ImageConverter 565) and writes a
+# header holding a 32 colour palette plus a run length encoded index stream.
+#
+# Every byte of the stream is one run: the upper 3 bits hold (run length - 1),
+# the lower 5 bits the palette index. Runs continue across row boundaries, the
+# firmware decodes them row by row into a single line buffer (see
+# draw_rle_bitmap() in src/main.cpp).
+#
+# Runs automatically as a PlatformIO pre script (see extra_scripts in
+# platformio.ini) and only regenerates the header if the source is newer.
+# It can also be called by hand:
+#
+#   python tools/bmp_rle.py assets/powerlogger_bmp.h include/powerlogger_rle.h powerLogger
+# --------------------------------------------------------------------------------
+
+import os
+import re
+import sys
+
+PALETTE_SIZE = 32
+INDEX_BITS = 5
+MAX_RUN = 1 << (8 - INDEX_BITS)
+
+# ----- Images converted on every build (source, header, symbol, width, height) ----- //
+IMAGES = [
+    ("assets/powerlogger_bmp.h", "include/powerlogger_rle.h", "powerLogger", 160, 128),
+]
+
+
+def read_pixels(path):
+    pixels = []
+    with open(path) as f:
+        body = f.read().split("{", 1)[1]
+    for line in body.splitlines():
+        line = line.split("//")[0]
+        pixels += [int(x, 16) for x in re.findall(r"0x[0-9a-fA-F]{4}", line)]
+    return pixels
+
+
+def split565(c):
+    return ((c >> 11) & 0x1F, (c >> 5) & 0x3F, c & 0x1F)
+
+
+def join565(p):
+    return (p[0] << 11) | (p[1] << 5) | p[2]
+
+
+def weight(p):
+    # green has one bit more, scale all channels to the same range
+    return (p[0] << 1, p[1], p[2] << 1)
+
+
+def average(box):
+    return tuple((sum(p[k] for p in box) + len(box) // 2) // len(box) for k in range(3))
+
+
+def median_cut(pixels, n):
+    # Boxes can round to the same colour, split on until n distinct colours are left
+    boxes = [pixels]
+    while len(set(average(box) for box in boxes)) < n:
+        best = None
+        for i, box in enumerate(boxes):
+            if len(box) < 2:
+                continue
+            ranges = [max(weight(p)[k] for p in box) - min(weight(p)[k] for p in box) for k in range(3)]
+            score = max(ranges) * len(box) ** 0.5
+            if score > 0 and (best is None or score > best[0]):
+                best = (score, i, ranges.index(max(ranges)))
+        if best is None:
+            break
+        _, i, k = best
+        box = sorted(boxes.pop(i), key=lambda p: p[k])
+        half = len(box) // 2
+        boxes += [box[:half], box[half:]]
+    palette = []
+    for box in boxes:
+        colour = average(box)
+        if colour not in palette:
+            palette.append(colour)
+    return palette
+
+
+def quantize(pixels):
+    rgb = [split565(c) for c in pixels]
+    palette = median_cut(rgb, PALETTE_SIZE)
+    nearest = {}
+    indices = []
+    for p in rgb:
+        if p not in nearest:
+            wp = weight(p)
+            nearest[p] = min(range(len(palette)),
+                             key=lambda i: sum((weight(palette[i])[k] - wp[k]) ** 2 for k in range(3)))
+        indices.append(nearest[p])
+    return [join565(p) for p in palette], indices
+
+
+def encode(indices):
+    stream = []
+    i = 0
+    while i < len(indices):
+        run = 1
+        while i + run < len(indices) and indices[i + run] == indices[i] and run < MAX_RUN:
+            run += 1
+        stream.append(((run - 1) << INDEX_BITS) | indices[i])
+        i += run
+    return stream
+
+
+def write_header(path, source, symbol, width, height, palette, stream):
+    with open(path, "w") as f:
+        f.write("// Generated by  : tools/bmp_rle.py, do not edit\n")
+        f.write("// Generated from: %s\n" % source)
+        f.write("// Dimensions    : %dx%d pixels\n" % (width, height))
+        f.write("// Size          : %d Bytes (raw %d Bytes)\n\n" % (len(stream) + 2 * len(palette), 2 * width * height))
+        f.write("#include <pgmspace.h>\n\n")
+        f.write("#define %s_width %d\n" % (symbol, width))
+        f.write("#define %s_height %d\n\n" % (symbol, height))
+        f.write("const uint16_t %s_palette[%d] PROGMEM = {\n" % (symbol, len(palette)))
+        for i in range(0, len(palette), 8):
+            f.write("    " + ", ".join("0x%04x" % c for c in palette[i:i + 8]) + ",\n")
+        f.write("};\n\n")
+        f.write("const uint8_t %s_rle[%d] PROGMEM = {\n" % (symbol, len(stream)))
+        for i in range(0, len(stream), 16):
+            f.write("    " + ", ".join("0x%02x" % b for b in stream[i:i + 16]) + ",\n")
+        f.write("};\n")
+
+
+def convert(source, header, symbol, width, height, name=None):
+    pixels = read_pixels(source)
+    if len(pixels) != width * height:
+        raise ValueError("%s: expected %d pixels, found %d" % (source, width * height, len(pixels)))
+    palette, indices = quantize(pixels)
+    write_header(header, name or source, symbol, width, height, palette, encode(indices))
+
+
+def convert_all(project_dir):
+    for source, header, symbol, width, height in IMAGES:
+        src = os.path.join(project_dir, source)
+        dst = os.path.join(project_dir, header)
+        if os.path.exists(dst) and os.path.getmtime(dst) >= os.path.getmtime(src):
+            continue
+        print("bmp_rle: %s -> %s" % (source, header))
+        convert(src, dst, symbol, width, height, source)
+
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO/SCons
+except NameError:
+    env = None
+
+if env is not None:
+    convert_all(env.subst("$PROJECT_DIR"))
+elif __name__ == "__main__":
+    if len(sys.argv) == 1:
+        convert_all(os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."))
+    elif len(sys.argv) in (4, 6):
+        size = (int(sys.argv[4]), int(sys.argv[5])) if len(sys.argv) == 6 else (160, 128)
+        convert(sys.argv[1], sys.argv[2], sys.argv[3], *size)
+    else:
+        print("usage: bmp_rle.py [source header symbol [width height]]")
+        sys.exit(1)
@@ -0,0 +1,244 @@
+/*--------------------------------------------------------------------------------
+Host receiver for the binary USB CDC stream (see include/cdc_stream.h)
+
+Opens the serial port raw, optionally sends "stream on <interval>", decodes the
+frames and writes one CSV line per sample. Frames with a bad CRC are skipped by
+searching for the next sync word, gaps in the sequence number are counted as
+lost samples. Text frames (console output, command replies) and a summary
+every second are printed to stderr.
+
+Build and run on Linux:
+
+  g++ -O2 -std=c++17 -Iinclude -o cdc_receiver tools/cdc_receiver.cpp
+  ./cdc_receiver /dev/ttyACM0 samples.csv 2      (2 ms interval)
+
+Stop with Ctrl+C, the logger is switched back with "stream off".
+--------------------------------------------------------------------------------*/
+
+#include <cerrno>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "cdc_frame.h"
+
+#define CHANNELS 3
+
+static volatile sig_atomic_t running = 1;
+
+static void on_signal(int)
+{
+  running = 0;
+}
+
+static uint32_t get_u32(const uint8_t *p)
+{
+  return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static float get_f32(const uint8_t *p)
+{
+  float f;
+  memcpy(&f, p, 4);
+  return f;
+}
+
+static int open_port(const char *path)
+{
+  int fd = open(path, O_RDWR | O_NOCTTY);
+  if (fd < 0)
+  {
+    return -1;
+  }
+  termios tio;
+  tcgetattr(fd, &tio);
+  cfmakeraw(&tio);
+  tio.c_cc[VMIN] = 0;
+  tio.c_cc[VTIME] = 1; // read() returns after 100 ms without data
+  tcsetattr(fd, TCSANOW, &tio);
+  tcflush(fd, TCIFLUSH);
+  return fd;
+}
+
+static double now_s()
+{
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+struct stream_stats
+{
+  uint64_t frames = 0;
+  uint64_t lost = 0;
+  uint64_t crc_errors = 0;
+  uint64_t skipped_bytes = 0;
+  bool have_seq = false;
+  uint32_t last_seq = 0;
+};
+
+// Returns the number of bytes consumed from buf, 0 if more data is needed
+static size_t decode_frame(const uint8_t *buf, size_t len, FILE *csv, stream_stats &stats)
+{
+  if (len < 2)
+  {
+    return 0;
+  }
+  if (buf[0] != CDC_SYNC_1 || buf[1] != CDC_SYNC_2)
+  {
+    stats.skipped_bytes++;
+    return 1;
+  }
+  if (len < CDC_HEADER)
+  {
+    return 0;
+  }
+  size_t payload = buf[3];
+  size_t total = CDC_HEADER + payload + CDC_CRC;
+  if (len < total)
+  {
+    return 0;
+  }
+  uint16_t crc = buf[CDC_HEADER + payload] | buf[CDC_HEADER + payload + 1] << 8;
+  if (crc == cdc_crc16(buf + 2, payload + 2) && buf[2] == CDC_TYPE_TEXT)
+  {
+    fwrite(buf + CDC_HEADER, 1, payload, stderr); // console output and command replies of the logger
+    return total;
+  }
+  if (crc != cdc_crc16(buf + 2, payload + 2) || buf[2] != CDC_TYPE_SAMPLE || payload < CDC_SAMPLE_PAYLOAD)
+  {
+    // Not a valid frame, the sync word was part of the data: resync one byte later
+    stats.crc_errors++;
+    return 1;
+  }
+
+  const uint8_t *p = buf + CDC_HEADER;
+  uint32_t seq = get_u32(p);
+  uint32_t time_us = get_u32(p + 4);
+  uint8_t mask = p[8];
+  p += CDC_SAMPLE_PAYLOAD;
+
+  if (stats.have_seq && seq > stats.last_seq + 1)
+  {
+    stats.lost += seq - stats.last_seq - 1;
+  }
+  stats.have_seq = true;
+  stats.last_seq = seq;
+  stats.frames++;
+
+  fprintf(csv, "%u,%u", seq, time_us);
+  for (int ch = 0; ch < CHANNELS; ch++)
+  {
+    if (mask & (1 << ch) && p + CDC_CHANNEL_PAYLOAD <= buf + CDC_HEADER + payload)
+    {
+      fprintf(csv, ",%.4f,%.3f,%.4f,%.4f", get_f32(p), get_f32(p + 4), get_f32(p + 8), get_f32(p + 12));
+      p += CDC_CHANNEL_PAYLOAD;
+    }
+    else
+    {
+      fprintf(csv, ",,,,");
+    }
+  }
+  fputc('\n', csv);
+  return total;
+}
+
+int main(int argc, char **argv)
+{
+  if (argc < 3)
+  {
+    fprintf(stderr, "usage: %s <port> <csv file> [interval ms]\n", argv[0]);
+    return 1;
+  }
+
+  int fd = open_port(argv[1]);
+  if (fd < 0)
+  {
+    fprintf(stderr, "%s: %s\n", argv[1], strerror(errno));
+    return 1;
+  }
+  FILE *csv = strcmp(argv[2], "-") == 0 ? stdout : fopen(argv[2], "w");
+  if (!csv)
+  {
+    fprintf(stderr, "%s: %s\n", argv[2], strerror(errno));
+    return 1;
+  }
+  fprintf(csv, "seq,time_us");
+  for (int ch = 1; ch <= CHANNELS; ch++)
+  {
+    fprintf(csv, ",V%d,mA%d,mWh%d,mAh%d", ch, ch, ch, ch);
+  }
+  fputc('\n', csv);
+
+  signal(SIGINT, on_signal);
+  signal(SIGTERM, on_signal);
+
+  char command[32];
+  snprintf(command, sizeof(command), "stream on %s\n", argc > 3 ? argv[3] : "");
+  if (write(fd, command, strlen(command)) < 0)
+  {
+    fprintf(stderr, "write: %s\n", strerror(errno));
+  }
+
+  static uint8_t buf[1 << 16];
+  size_t fill = 0;
+  stream_stats stats;
+  double start = now_s();
+  double report = start + 1.0;
+  uint64_t frames_at_report = 0;
+
+  while (running)
+  {
+    ssize_t n = read(fd, buf + fill, sizeof(buf) - fill);
+    if (n < 0 && errno != EINTR)
+    {
+      fprintf(stderr, "read: %s\n", strerror(errno));
+      break;
+    }
+    fill += n > 0 ? n : 0;
+
+    size_t pos = 0;
+    size_t used;
+    while ((used = decode_frame(buf + pos, fill - pos, csv, stats)) > 0)
+    {
+      pos += used;
+    }
+    memmove(buf, buf + pos, fill - pos);
+    fill -= pos;
+
+    double t = now_s();
+    if (t >= report)
+    {
+      fprintf(stderr, "%llu samples, %.0f/s, %llu lost, %llu crc errors\n",
+              (unsigned long long)stats.frames, (stats.frames - frames_at_report) / (t - report + 1.0),
+              (unsigned long long)stats.lost, (unsigned long long)stats.crc_errors);
+      frames_at_report = stats.frames;
+      report = t + 1.0;
+    }
+  }
+
+  const char *stop = "stream off\n";
+  if (write(fd, stop, strlen(stop)) < 0)
+  {
+    fprintf(stderr, "write: %s\n", strerror(errno));
+  }
+  close(fd);
+  fflush(csv);
+  if (csv != stdout)
+  {
+    fclose(csv);
+  }
+
+  double elapsed = now_s() - start;
+  fprintf(stderr, "received %llu samples in %.1f s (%.0f/s), lost %llu (%.3f%%), %llu crc errors, %llu bytes skipped\n",
+          (unsigned long long)stats.frames, elapsed, stats.frames / elapsed, (unsigned long long)stats.lost,
+          stats.frames + stats.lost ? 100.0 * stats.lost / (stats.frames + stats.lost) : 0.0,
+          (unsigned long long)stats.crc_errors, (unsigned long long)stats.skipped_bytes);
+  return 0;
+}
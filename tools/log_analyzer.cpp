@@ -0,0 +1,706 @@
+/*--------------------------------------------------------------------------------
+Statistics of a log file of the SD card, for logs too large for a spreadsheet
+
+Maps the log (the CSV written by create_file() and write_file(), any
+separator) into memory and splits it at line ends into one part per CPU
+core. Every thread finds the separators of a line 16 bytes at a time (SSE2),
+parses the load voltage, current and power with a fixed point parser (the
+log has no exponents) and keeps their min, max, sum and histogram per
+channel, the energy integrated from the power and the timestamps, and the
+time the current was above --above. Energy and capacity columns are only
+parsed in the last line. The parts are merged in file order, the interval
+across two parts is added at the seam. One core parses about 0.7 GB/s.
+
+Percentiles come from the histogram, which has 256 bins per power of two, so
+they are accurate to 0.4%. Pages are dropped from the mapping once they are
+parsed, files larger than the RAM stream through the page cache. A time step
+longer than --gap (60 s) counts as a gap and is not integrated. The "# gap"
+records the logger writes for samples it lost or took late are counted, with
+the samples they say are missing.
+
+  g++ -O3 -std=c++17 -pthread -o log_analyzer tools/log_analyzer.cpp
+  ./log_analyzer field.txt
+  ./log_analyzer --above 50 --threads 4 field.txt
+--------------------------------------------------------------------------------*/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#include <fcntl.h>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#define CHANNELS 3
+#define COLUMNS_PER_CHANNEL 5 // load voltage, current, power, energy, capacity
+#define QUANTITIES 3          // load voltage, current, power get percentiles
+#define HIST_BINS 131072      // sign, exponent and the top 8 mantissa bits of a float
+#define DROP_BYTES (64 << 20) // parsed pages are released in steps of 64 MB
+
+static const char *quantity_name[QUANTITIES] = {"voltage V", "current mA", "power mW"};
+static const double percentiles[] = {1, 50, 90, 99};
+
+struct quantity_stats
+{
+  double min = INFINITY;
+  double max = -INFINITY;
+  double sum = 0;
+  uint64_t count = 0;
+  std::vector<uint32_t> hist = std::vector<uint32_t>(HIST_BINS);
+};
+
+// Statistics of one part of the file
+struct part_stats
+{
+  uint64_t samples = 0;
+  uint64_t bad_lines = 0;
+  uint64_t gaps = 0;
+  uint64_t gap_records = 0; // "# gap" lines of the logger
+  uint64_t missed = 0;      // samples missing according to them
+  bool have_sample = false;
+  int64_t first_ms = 0;
+  int64_t last_ms = 0;
+  double last_power[CHANNELS] = {};
+  double last_current[CHANNELS] = {};
+  double last_energy[CHANNELS] = {}; // as logged
+  double last_capacity[CHANNELS] = {};
+  double covered_ms = 0;             // time between samples, without the gaps
+  double energy_mWh[CHANNELS] = {}; // integrated, each sample holds until the next one
+  double above_ms[CHANNELS] = {};
+  quantity_stats stats[CHANNELS][QUANTITIES];
+};
+
+enum column_use : uint8_t
+{
+  COLUMN_SKIP,
+  COLUMN_VALUE, // load voltage, current and power
+  COLUMN_TOTAL  // energy and capacity
+};
+
+struct log_layout
+{
+  char separator = ',';
+  int columns[CHANNELS]; // first column of a channel, -1 if not logged
+  int column_count = 2;  // columns up to the last one of a channel
+  column_use column_kind[CHANNELS * COLUMNS_PER_CHANNEL + 2] = {};
+  size_t data_start = 0;
+};
+
+struct analyzer_options
+{
+  double above_mA = 100;
+  double gap_ms = 60000;
+};
+
+// ----- Parsing ----- //
+static const double power10[] = {1, 1e-1, 1e-2, 1e-3, 1e-4, 1e-5, 1e-6, 1e-7, 1e-8, 1e-9};
+
+// [-]digits[.digits] as the Arduino Print class writes them, NAN for anything else ("nan", "inf", "ovf")
+static inline double parse_field(const char *p, const char *end)
+{
+  end -= end > p && end[-1] == '\r';
+  bool negative = p < end && *p == '-';
+  p += negative;
+  int length = end - p;
+  if (length == 0 || length > 18)
+  {
+    return NAN;
+  }
+  int64_t mantissa = 0;
+  int decimals = 0;
+  bool point = false;
+  for (; p < end; p++)
+  {
+    unsigned d = (unsigned)(*p - '0');
+    if (d < 10)
+    {
+      mantissa = mantissa * 10 + d;
+      decimals += point;
+    }
+    else if (*p == '.' && !point)
+    {
+      point = true;
+    }
+    else
+    {
+      return NAN;
+    }
+  }
+  if (decimals > 9 || (point && length == 1))
+  {
+    return NAN;
+  }
+  return (negative ? -mantissa : mantissa) * power10[decimals];
+}
+
+// Positions of the separators in [p, eol), 16 bytes at a time where the mapping allows reading ahead
+static inline int find_separators(const char *p, const char *eol, const char *limit, char separator,
+                                  const char **found, int max)
+{
+  int n = 0;
+#if defined(__SSE2__)
+  __m128i pattern = _mm_set1_epi8(separator);
+  for (; p + 16 <= limit && p < eol && n < max; p += 16)
+  {
+    unsigned mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)p), pattern));
+    while (mask != 0 && n < max)
+    {
+      const char *sep = p + __builtin_ctz(mask);
+      if (sep >= eol)
+      {
+        return n;
+      }
+      found[n++] = sep;
+      mask &= mask - 1;
+    }
+  }
+#endif
+  for (; p < eol && n < max; p++)
+  {
+    if (*p == separator)
+    {
+      found[n++] = p;
+    }
+  }
+  return n;
+}
+
+static inline bool parse_2(const char *p, int &value)
+{
+  unsigned a = (unsigned)(p[0] - '0');
+  unsigned b = (unsigned)(p[1] - '0');
+  value = a * 10 + b;
+  return a < 10 && b < 10;
+}
+
+// Days since 1970-01-01 of a proleptic Gregorian date
+static int64_t days_from_civil(int64_t y, unsigned m, unsigned d)
+{
+  y -= m <= 2;
+  int64_t era = (y >= 0 ? y : y - 399) / 400;
+  unsigned yoe = (unsigned)(y - era * 400);
+  unsigned doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+  unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  return era * 146097 + (int64_t)doe - 719468;
+}
+
+// "yy/mm/dd<sep>hh:mm:ss:mmm" as written by format_log_time()
+static inline bool parse_time(const char *p, const char *end, char separator, int64_t &ms)
+{
+  int y, mo, d, h, mi, s, ms_high;
+  if (end - p < 21)
+  {
+    return false;
+  }
+  unsigned ms_low = (unsigned)(p[20] - '0');
+  if (p[2] != '/' || p[5] != '/' || p[8] != separator || p[11] != ':' || p[14] != ':' ||
+      p[17] != ':' || !parse_2(p, y) || !parse_2(p + 3, mo) || !parse_2(p + 6, d) || !parse_2(p + 9, h) ||
+      !parse_2(p + 12, mi) || !parse_2(p + 15, s) || !parse_2(p + 18, ms_high) || ms_low >= 10)
+  {
+    return false;
+  }
+  int64_t days = days_from_civil((y >= 70 ? 1900 : 2000) + y, mo, d); // "70" before the logger knew the time
+  ms = ((days * 24 + h) * 60 + mi) * 60000 + s * 1000 + ms_high * 10 + ms_low;
+  return true;
+}
+
+static inline void add_value(quantity_stats &q, double value)
+{
+  if (std::isnan(value))
+  {
+    return;
+  }
+  q.min = std::min(q.min, value);
+  q.max = std::max(q.max, value);
+  q.sum += value;
+  q.count++;
+  float f = (float)value;
+  uint32_t bits;
+  memcpy(&bits, &f, 4);
+  q.hist[bits >> 15]++;
+}
+
+// ----- The header: "# ..." lines, then the column names ----- //
+static bool parse_layout(const char *data, size_t size, log_layout &layout)
+{
+  size_t pos = 0;
+  while (pos < size)
+  {
+    const char *line = data + pos;
+    const char *eol = (const char *)memchr(line, '\n', size - pos);
+    size_t len = eol ? eol - line : size - pos;
+    pos = pos + len + 1;
+    if (len == 0 || line[0] == '#')
+    {
+      continue;
+    }
+    if (len < 5 || memcmp(line, "date", 4) != 0)
+    {
+      return false;
+    }
+    layout.separator = line[4];
+
+    std::string names(line, len);
+    int column = 0;
+    for (int ch = 0; ch < CHANNELS; ch++)
+    {
+      layout.columns[ch] = -1;
+    }
+    size_t start = 0;
+    for (;;)
+    {
+      size_t next = names.find(layout.separator, start);
+      std::string name = names.substr(start, next == std::string::npos ? std::string::npos : next - start);
+      if (!name.empty() && name.back() == '\r')
+      {
+        name.pop_back();
+      }
+      for (int ch = 0; ch < CHANNELS; ch++)
+      {
+        if (name == "load voltage " + std::to_string(ch + 1))
+        {
+          layout.columns[ch] = column;
+        }
+      }
+      if (next == std::string::npos)
+      {
+        break;
+      }
+      start = next + 1;
+      column++;
+    }
+    for (int ch = 0; ch < CHANNELS; ch++)
+    {
+      int c = layout.columns[ch];
+      if (c < 0)
+      {
+        continue;
+      }
+      if (c + COLUMNS_PER_CHANNEL > CHANNELS * COLUMNS_PER_CHANNEL + 2)
+      {
+        return false;
+      }
+      layout.column_kind[c] = layout.column_kind[c + 1] = layout.column_kind[c + 2] = COLUMN_VALUE;
+      layout.column_kind[c + 3] = layout.column_kind[c + 4] = COLUMN_TOTAL;
+      layout.column_count = std::max(layout.column_count, c + COLUMNS_PER_CHANNEL);
+    }
+    layout.data_start = std::min(pos, size);
+    return true;
+  }
+  return false;
+}
+
+// Columns 2.. of a line hold the values, the date and time are columns 0 and 1.
+// Energy and capacity are skipped unless totals is set.
+static bool parse_values(const char *line, const char *eol, const char *limit, const log_layout &layout, bool totals,
+                         double *values)
+{
+  const char *seps[CHANNELS * COLUMNS_PER_CHANNEL + 2];
+  int found = find_separators(line + 21, eol, limit, layout.separator, seps, layout.column_count - 1);
+  if (found < layout.column_count - 2)
+  {
+    return false;
+  }
+  for (int column = 2; column < layout.column_count; column++)
+  {
+    if (layout.column_kind[column] == COLUMN_VALUE || (totals && layout.column_kind[column] == COLUMN_TOTAL))
+    {
+      const char *end = column - 1 < found ? seps[column - 1] : eol;
+      values[column] = parse_field(seps[column - 2] + 1, end);
+    }
+  }
+  return true;
+}
+
+// ----- One thread: the lines that start in [begin, end) ----- //
+static void analyze_part(const char *data, size_t begin, size_t end, size_t size, const log_layout &layout,
+                         const analyzer_options &options, part_stats &part)
+{
+  const char *p = data + begin;
+  const char *stop = data + end;
+  const char *limit = data + size;
+  const char *dropped = p;
+  const char *last_line = NULL;
+  double values[CHANNELS * COLUMNS_PER_CHANNEL + 2];
+
+  while (p < stop)
+  {
+    const char *eol = (const char *)memchr(p, '\n', limit - p);
+    eol = eol ? eol : limit;
+    int64_t ms;
+    if (eol - p > 6 && memcmp(p, "# gap ", 6) == 0)
+    {
+      const char *missed = (const char *)memmem(p, eol - p, "missed=", 7);
+      part.gap_records++;
+      part.missed += missed ? strtoull(missed + 7, NULL, 10) : 0;
+    }
+    if (*p == '#' || *p == 'd' || !parse_time(p, eol, layout.separator, ms))
+    {
+      part.bad_lines += *p != '#' && *p != 'd' && p != eol && *p != '\r';
+      p = eol + 1;
+      continue;
+    }
+
+    if (!parse_values(p, eol, limit, layout, false, values))
+    {
+      part.bad_lines++;
+      p = eol + 1;
+      continue;
+    }
+
+    if (part.have_sample)
+    {
+      double dt = ms - part.last_ms;
+      if (dt > options.gap_ms || dt < 0)
+      {
+        part.gaps++;
+      }
+      else
+      {
+        part.covered_ms += dt;
+        for (int ch = 0; ch < CHANNELS; ch++)
+        {
+          if (!std::isnan(part.last_power[ch]))
+          {
+            part.energy_mWh[ch] += part.last_power[ch] * dt / 3600000;
+          }
+          part.above_ms[ch] += part.last_current[ch] > options.above_mA ? dt : 0;
+        }
+      }
+    }
+    for (int ch = 0; ch < CHANNELS; ch++)
+    {
+      int c = layout.columns[ch];
+      if (c < 0)
+      {
+        continue;
+      }
+      add_value(part.stats[ch][0], values[c]);
+      add_value(part.stats[ch][1], values[c + 1]);
+      add_value(part.stats[ch][2], values[c + 2]);
+      part.last_power[ch] = values[c + 2];
+      part.last_current[ch] = values[c + 1];
+    }
+    if (!part.have_sample)
+    {
+      part.first_ms = ms;
+      part.have_sample = true;
+    }
+    part.last_ms = ms;
+    part.samples++;
+    last_line = p;
+    p = eol + 1;
+
+    if (p - dropped >= DROP_BYTES)
+    {
+      // Only whole pages below the current line, the page of the line itself is still needed
+      uintptr_t page = sysconf(_SC_PAGESIZE);
+      uintptr_t from = ((uintptr_t)dropped + page - 1) & ~(page - 1);
+      uintptr_t to = (uintptr_t)(p - 1) & ~(page - 1);
+      if (to > from)
+      {
+        madvise((void *)from, to - from, MADV_DONTNEED);
+      }
+      dropped = p;
+    }
+  }
+
+  // The logged totals are only needed from the last sample
+  if (last_line != NULL)
+  {
+    const char *eol = (const char *)memchr(last_line, '\n', limit - last_line);
+    parse_values(last_line, eol ? eol : limit, limit, layout, true, values);
+    for (int ch = 0; ch < CHANNELS; ch++)
+    {
+      int c = layout.columns[ch];
+      if (c >= 0)
+      {
+        part.last_energy[ch] = values[c + 3];
+        part.last_capacity[ch] = values[c + 4];
+      }
+    }
+  }
+}
+
+// Adds the next part of the file to total, including the interval across the seam
+static void merge_part(part_stats &total, const part_stats &next, const analyzer_options &options)
+{
+  if (!next.have_sample)
+  {
+    total.bad_lines += next.bad_lines;
+    return;
+  }
+  if (total.have_sample)
+  {
+    double dt = next.first_ms - total.last_ms;
+    if (dt > options.gap_ms || dt < 0)
+    {
+      total.gaps++;
+    }
+    else
+    {
+      total.covered_ms += dt;
+      for (int ch = 0; ch < CHANNELS; ch++)
+      {
+        if (!std::isnan(total.last_power[ch]))
+        {
+          total.energy_mWh[ch] += total.last_power[ch] * dt / 3600000;
+        }
+        total.above_ms[ch] += total.last_current[ch] > options.above_mA ? dt : 0;
+      }
+    }
+  }
+  else
+  {
+    total.first_ms = next.first_ms;
+    total.have_sample = true;
+  }
+
+  total.samples += next.samples;
+  total.bad_lines += next.bad_lines;
+  total.gaps += next.gaps;
+  total.gap_records += next.gap_records;
+  total.missed += next.missed;
+  total.covered_ms += next.covered_ms;
+  total.last_ms = next.last_ms;
+  for (int ch = 0; ch < CHANNELS; ch++)
+  {
+    total.last_power[ch] = next.last_power[ch];
+    total.last_current[ch] = next.last_current[ch];
+    total.last_energy[ch] = next.last_energy[ch];
+    total.last_capacity[ch] = next.last_capacity[ch];
+    total.energy_mWh[ch] += next.energy_mWh[ch];
+    total.above_ms[ch] += next.above_ms[ch];
+    for (int i = 0; i < QUANTITIES; i++)
+    {
+      quantity_stats &a = total.stats[ch][i];
+      const quantity_stats &b = next.stats[ch][i];
+      a.min = std::min(a.min, b.min);
+      a.max = std::max(a.max, b.max);
+      a.sum += b.sum;
+      a.count += b.count;
+      for (int bin = 0; bin < HIST_BINS; bin++)
+      {
+        a.hist[bin] += b.hist[bin];
+      }
+    }
+  }
+}
+
+// ----- Report ----- //
+static double bin_value(uint32_t bin)
+{
+  uint32_t bits = bin << 15 | 1 << 14; // middle of the bin
+  float f;
+  memcpy(&f, &bits, 4);
+  return f;
+}
+
+static double percentile(const quantity_stats &q, double pct)
+{
+  uint64_t rank = (uint64_t)ceil(pct / 100 * q.count);
+  rank = std::max<uint64_t>(rank, 1);
+  uint64_t seen = 0;
+  // Negative values from the largest magnitude down, then the positive ones up
+  for (uint32_t bin = HIST_BINS - 1; bin >= HIST_BINS / 2; bin--)
+  {
+    seen += q.hist[bin];
+    if (seen >= rank)
+    {
+      return std::max(q.min, bin_value(bin));
+    }
+  }
+  for (uint32_t bin = 0; bin < HIST_BINS / 2; bin++)
+  {
+    seen += q.hist[bin];
+    if (seen >= rank)
+    {
+      return std::min(std::max(q.min, bin_value(bin)), q.max);
+    }
+  }
+  return q.max;
+}
+
+static void format_duration(double ms, char *text, size_t size)
+{
+  uint64_t s = (uint64_t)(ms / 1000);
+  snprintf(text, size, "%lud%02luh%02lum%02lus", (unsigned long)(s / 86400), (unsigned long)(s / 3600 % 24),
+           (unsigned long)(s / 60 % 60), (unsigned long)(s % 60));
+}
+
+static void print_report(const part_stats &total, const log_layout &layout, const analyzer_options &options)
+{
+  char text[32];
+
+  for (int ch = 0; ch < CHANNELS; ch++)
+  {
+    if (layout.columns[ch] < 0)
+    {
+      continue;
+    }
+    printf("\nchannel %d      %12s %12s %12s", ch + 1, "min", "mean", "max");
+    for (double pct : percentiles)
+    {
+      snprintf(text, sizeof(text), "p%g", pct);
+      printf(" %11s", text);
+    }
+    printf("\n");
+    for (int i = 0; i < QUANTITIES; i++)
+    {
+      const quantity_stats &q = total.stats[ch][i];
+      if (q.count == 0)
+      {
+        continue;
+      }
+      printf("  %-12s %12.4f %12.4f %12.4f", quantity_name[i], q.min, q.sum / q.count, q.max);
+      for (double pct : percentiles)
+      {
+        printf(" %11.4f", percentile(q, pct));
+      }
+      printf("\n");
+    }
+    format_duration(total.above_ms[ch], text, sizeof(text));
+    printf("  energy mWh   %12.4f integrated, %.4f logged (capacity %.4f mAh logged)\n", total.energy_mWh[ch],
+           total.last_energy[ch], total.last_capacity[ch]);
+    printf("  above %g mA  %s (%.1f%%)\n", options.above_mA, text, total.covered_ms > 0 ? total.above_ms[ch] * 100 / total.covered_ms : 0);
+  }
+}
+
+static void usage(const char *name)
+{
+  fprintf(stderr,
+          "usage: %s [options] <log file>\n"
+          "  --above <mA>     threshold of the time above (100)\n"
+          "  --gap <s>        longer time steps are gaps and not integrated (60)\n"
+          "  --threads <n>    parser threads (all cores)\n",
+          name);
+}
+
+int main(int argc, char **argv)
+{
+  analyzer_options options;
+  unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+  const char *path = NULL;
+
+  for (int i = 1; i < argc; i++)
+  {
+    const char *value = i + 1 < argc ? argv[i + 1] : NULL;
+    if (argv[i][0] != '-' && path == NULL)
+    {
+      path = argv[i];
+      continue;
+    }
+    if (value == NULL)
+    {
+      usage(argv[0]);
+      return 2;
+    }
+    if (strcmp(argv[i], "--above") == 0)
+    {
+      options.above_mA = atof(value);
+    }
+    else if (strcmp(argv[i], "--gap") == 0)
+    {
+      options.gap_ms = atof(value) * 1000;
+    }
+    else if (strcmp(argv[i], "--threads") == 0)
+    {
+      threads = std::max(1, atoi(value));
+    }
+    else
+    {
+      usage(argv[0]);
+      return 2;
+    }
+    i++;
+  }
+  if (path == NULL)
+  {
+    usage(argv[0]);
+    return 2;
+  }
+
+  int fd = open(path, O_RDONLY);
+  struct stat st;
+  if (fd < 0 || fstat(fd, &st) != 0)
+  {
+    perror(path);
+    return 2;
+  }
+  size_t size = st.st_size;
+  if (size == 0)
+  {
+    fprintf(stderr, "%s: empty\n", path);
+    return 2;
+  }
+  const char *data = (const char *)mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  if (data == MAP_FAILED)
+  {
+    perror(path);
+    return 2;
+  }
+  close(fd);
+  madvise((void *)data, size, MADV_SEQUENTIAL);
+
+  log_layout layout;
+  if (!parse_layout(data, size, layout))
+  {
+    fprintf(stderr, "%s: not a PowerLogger log (no \"date\" header line)\n", path);
+    return 2;
+  }
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+  // Parts start at the first line that begins at or after their share of the file
+  std::vector<size_t> bounds;
+  size_t length = size - layout.data_start;
+  threads = std::max<size_t>(1, std::min<size_t>(threads, length / (1 << 20) + 1));
+  for (unsigned t = 0; t <= threads; t++)
+  {
+    size_t pos = layout.data_start + length * t / threads;
+    if (t > 0 && t < threads)
+    {
+      const char *eol = (const char *)memchr(data + pos - 1, '\n', size - pos + 1);
+      pos = eol ? eol - data + 1 : size;
+    }
+    bounds.push_back(std::max(pos, bounds.empty() ? 0 : bounds.back()));
+  }
+
+  std::vector<part_stats> parts(threads);
+  std::vector<std::thread> workers;
+  for (unsigned t = 0; t < threads; t++)
+  {
+    workers.emplace_back(analyze_part, data, bounds[t], bounds[t + 1], size, std::cref(layout), std::cref(options),
+                         std::ref(parts[t]));
+  }
+  part_stats total;
+  for (unsigned t = 0; t < threads; t++)
+  {
+    workers[t].join();
+    merge_part(total, parts[t], options);
+  }
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+  char text[32];
+  format_duration(total.covered_ms, text, sizeof(text));
+  printf("%s: %.1f MB, %lu samples over %s, %lu gaps, %lu bad lines\n", path, size / 1e6,
+         (unsigned long)total.samples, text, (unsigned long)total.gaps, (unsigned long)total.bad_lines);
+  if (total.gap_records > 0)
+  {
+    printf("%lu samples missing in %lu gap records of the logger\n", (unsigned long)total.missed,
+           (unsigned long)total.gap_records);
+  }
+  printf("parsed in %.3f s with %u threads, %.2f GB/s\n", elapsed.count(), threads, size / 1e9 / elapsed.count());
+  print_report(total, layout, options);
+  return 0;
+}
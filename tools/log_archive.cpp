@@ -0,0 +1,902 @@
+/*--------------------------------------------------------------------------------
+Columnar archive of PowerLogger logs, for queries over months of captures
+
+  log_archive pack <archive> <log>...
+      Merges log files of the SD card into one archive. The files are sorted
+      by their first timestamp, so the files of one session (a new one starts
+      with every start or reset of the measurement) and of several sessions
+      can be given in any order. Rows that are not newer than the last row
+      already packed (overlapping or repeated files) are skipped. The sample
+      numbers and the "# gap" records of the logs are kept.
+
+  log_archive query <archive> [--from <time>] [--to <time>] [--channel <n>]...
+      Writes the rows in the time range as a log file to stdout, with the
+      columns of the selected channels and the gap records, so the output
+      works with the other tools. Only the blocks that overlap the range are read, and of those
+      only the time column and the columns of the selected channels.
+
+  log_archive summary <archive> [--from <time>] [--to <time>] [--channel <n>]...
+      Min and max of every column in the range. Blocks that lie completely in
+      the range are answered from the index, without reading them.
+
+  log_archive info <archive>
+      Blocks, time ranges and the size of the columns.
+
+Times are "YYYY-MM-DD", "YYYY-MM-DD HH:MM[:SS]" (the local time of the
+logger, like the log) or milliseconds since 1970. Logs written before the
+logger knew the time start at "70/01/01" and are archived as 1970.
+
+File format, all integers little endian:
+
+  "PLARC2\0\0"                 magic
+  column chunks                 of all blocks, see below
+  index:
+    uint8_t  channel_mask       bit 0..2 for channel 1..3
+    uint32_t block_count
+    per block:
+      uint32_t rows
+      per column:               time, sample, then for every channel in the
+        uint64_t offset         mask: load voltage, current, power, energy,
+        uint32_t bytes          capacity
+        int64_t  min, max       of the column in the block
+    uint32_t gap_count
+    per gap record:
+      int64_t  time             of the row the record stood before
+      uint16_t length
+      char     text[length]     the "# gap ..." line of the log
+  uint64_t index_offset
+  "PLARCIDX"
+
+Blocks hold up to ARCHIVE_BLOCK_ROWS rows. Values are fixed point integers,
+10^ARCHIVE_DECIMALS units of the logged value (V, mA, mW, mWh, mAh), time is
+in ms since 1970, the sample number is stored as it is. A value the log did
+not have (channel not logged, "nan", "ovf", no sample column) is ARCHIVE_NULL
+and left out of min and max. A column chunk is the zigzag varint of the
+first value, followed by the zigzag varints of the differences to the
+previous value; the time and sample columns store the differences of the
+differences, which are 0 at a steady sample interval.
+
+  g++ -O2 -std=c++17 -o log_archive tools/log_archive.cpp
+  ./log_archive pack may.plarc sd/2024-May-*.txt
+  ./log_archive query may.plarc --from "2024-05-03 08:00" --to "2024-05-03 09:00" --channel 2 > hour.txt
+--------------------------------------------------------------------------------*/
+
+#include <algorithm>
+#include <cinttypes>
+#include <climits>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <vector>
+
+#define CHANNELS 3
+#define COLUMNS_PER_CHANNEL 5 // load voltage, current, power, energy, capacity
+#define ARCHIVE_BLOCK_ROWS 16384
+#define ARCHIVE_DECIMALS 6 // log_decimals is at most 6
+#define ARCHIVE_SCALE 1000000.0
+#define ARCHIVE_NULL INT64_MIN
+#define ARCHIVE_FIXED_COLUMNS 2 // time and sample
+#define ARCHIVE_MAGIC "PLARC2\0\0"
+#define ARCHIVE_FOOTER "PLARCIDX"
+
+static const char *column_name[COLUMNS_PER_CHANNEL] = {"load voltage", "current mA", "power mW", "energy mWh",
+                                                       "capacity mAh"};
+
+struct column_index
+{
+  uint64_t offset;
+  uint32_t bytes;
+  int64_t min;
+  int64_t max;
+};
+
+struct block_index
+{
+  uint32_t rows;
+  std::vector<column_index> columns; // time, sample, then COLUMNS_PER_CHANNEL per channel in the mask
+};
+
+struct archive_gap
+{
+  int64_t time_ms; // of the row the record stood before
+  std::string text;
+};
+
+struct archive
+{
+  uint8_t channel_mask = 0;
+  std::vector<block_index> blocks;
+  std::vector<archive_gap> gaps;
+};
+
+// Column of a channel in a block, -1 if the archive has no such channel
+static int block_column(uint8_t mask, int channel, int column)
+{
+  if (!(mask & (1 << channel)))
+  {
+    return -1;
+  }
+  int before = __builtin_popcount(mask & ((1 << channel) - 1));
+  return ARCHIVE_FIXED_COLUMNS + before * COLUMNS_PER_CHANNEL + column;
+}
+
+// ----- Encoding ----- //
+static void put_varint(std::string &out, uint64_t value)
+{
+  while (value >= 0x80)
+  {
+    out.push_back((char)(value | 0x80));
+    value >>= 7;
+  }
+  out.push_back((char)value);
+}
+
+static bool get_varint(const uint8_t *&p, const uint8_t *end, uint64_t &value)
+{
+  value = 0;
+  for (int shift = 0; p < end && shift < 64; shift += 7)
+  {
+    uint8_t byte = *p++;
+    value |= (uint64_t)(byte & 0x7F) << shift;
+    if (!(byte & 0x80))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+static uint64_t zigzag(int64_t value)
+{
+  return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+}
+
+static int64_t unzigzag(uint64_t value)
+{
+  return (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+}
+
+// Differences wrap around in uint64_t, so ARCHIVE_NULL next to a value round trips
+static std::string encode_column(const std::vector<int64_t> &values, bool second_order)
+{
+  std::string out;
+  uint64_t previous = 0;
+  uint64_t previous_delta = 0;
+  for (int64_t v : values)
+  {
+    uint64_t delta = (uint64_t)v - previous;
+    put_varint(out, zigzag((int64_t)(second_order ? delta - previous_delta : delta)));
+    previous = v;
+    previous_delta = delta;
+  }
+  return out;
+}
+
+static bool decode_column(const std::string &in, uint32_t rows, bool second_order, std::vector<int64_t> &values)
+{
+  const uint8_t *p = (const uint8_t *)in.data();
+  const uint8_t *end = p + in.size();
+  uint64_t previous = 0;
+  uint64_t previous_delta = 0;
+  values.resize(rows);
+  for (uint32_t i = 0; i < rows; i++)
+  {
+    uint64_t code;
+    if (!get_varint(p, end, code))
+    {
+      return false;
+    }
+    uint64_t delta = (uint64_t)unzigzag(code) + (second_order ? previous_delta : 0);
+    previous = previous + delta;
+    previous_delta = delta;
+    values[i] = (int64_t)previous;
+  }
+  return true;
+}
+
+// ----- Archive file ----- //
+static void put_u32(std::string &out, uint32_t v)
+{
+  out.append((const char *)&v, 4); // the tool runs on little endian hosts
+}
+
+static void put_u64(std::string &out, uint64_t v)
+{
+  out.append((const char *)&v, 8);
+}
+
+static void put_u16(std::string &out, uint16_t v)
+{
+  out.append((const char *)&v, 2);
+}
+
+struct archive_writer
+{
+  FILE *file = NULL;
+  uint64_t offset = 0;
+  archive index;
+  std::vector<std::vector<int64_t>> columns;
+  uint64_t rows = 0;
+};
+
+static void flush_block(archive_writer &w)
+{
+  if (w.columns.empty() || w.columns[0].empty())
+  {
+    return;
+  }
+  block_index block;
+  block.rows = w.columns[0].size();
+  for (size_t c = 0; c < w.columns.size(); c++)
+  {
+    std::string chunk = encode_column(w.columns[c], c < ARCHIVE_FIXED_COLUMNS);
+    column_index col = {w.offset, (uint32_t)chunk.size(), INT64_MAX, INT64_MIN};
+    for (int64_t v : w.columns[c])
+    {
+      if (v != ARCHIVE_NULL)
+      {
+        col.min = std::min(col.min, v);
+        col.max = std::max(col.max, v);
+      }
+    }
+    fwrite(chunk.data(), 1, chunk.size(), w.file);
+    w.offset += chunk.size();
+    block.columns.push_back(col);
+    w.columns[c].clear();
+  }
+  w.index.blocks.push_back(block);
+}
+
+static bool finish_archive(archive_writer &w)
+{
+  flush_block(w);
+  std::string index;
+  index.push_back((char)w.index.channel_mask);
+  put_u32(index, w.index.blocks.size());
+  for (const block_index &block : w.index.blocks)
+  {
+    put_u32(index, block.rows);
+    for (const column_index &col : block.columns)
+    {
+      put_u64(index, col.offset);
+      put_u32(index, col.bytes);
+      put_u64(index, col.min);
+      put_u64(index, col.max);
+    }
+  }
+  put_u32(index, w.index.gaps.size());
+  for (const archive_gap &gap : w.index.gaps)
+  {
+    put_u64(index, gap.time_ms);
+    put_u16(index, gap.text.size());
+    index.append(gap.text);
+  }
+  put_u64(index, w.offset);
+  index.append(ARCHIVE_FOOTER, 8);
+  fwrite(index.data(), 1, index.size(), w.file);
+  return fclose(w.file) == 0;
+}
+
+static bool read_at(FILE *f, uint64_t offset, size_t size, std::string &out)
+{
+  out.resize(size);
+  return fseeko(f, offset, SEEK_SET) == 0 && fread(&out[0], 1, size, f) == size;
+}
+
+static bool open_archive(const char *path, FILE *&f, archive &a)
+{
+  f = fopen(path, "rb");
+  std::string magic, footer, index;
+  if (f == NULL || !read_at(f, 0, 8, magic) || memcmp(magic.data(), ARCHIVE_MAGIC, 8) != 0 ||
+      fseeko(f, -16, SEEK_END) != 0)
+  {
+    return false;
+  }
+  uint64_t end = ftello(f) + 16;
+  if (!read_at(f, end - 16, 16, footer) || memcmp(footer.data() + 8, ARCHIVE_FOOTER, 8) != 0)
+  {
+    return false;
+  }
+  uint64_t index_offset;
+  memcpy(&index_offset, footer.data(), 8);
+  if (index_offset < 8 || index_offset + 5 > end - 16 || !read_at(f, index_offset, end - 16 - index_offset, index))
+  {
+    return false;
+  }
+
+  const char *p = index.data();
+  const char *stop = p + index.size();
+  uint32_t count;
+  a.channel_mask = *p++;
+  memcpy(&count, p, 4);
+  p += 4;
+  size_t columns = ARCHIVE_FIXED_COLUMNS + __builtin_popcount(a.channel_mask & 7) * COLUMNS_PER_CHANNEL;
+  for (uint32_t b = 0; b < count; b++)
+  {
+    block_index block;
+    if (stop - p < (ptrdiff_t)(4 + columns * 28))
+    {
+      return false;
+    }
+    memcpy(&block.rows, p, 4);
+    p += 4;
+    block.columns.resize(columns);
+    for (column_index &col : block.columns)
+    {
+      memcpy(&col.offset, p, 8);
+      memcpy(&col.bytes, p + 8, 4);
+      memcpy(&col.min, p + 12, 8);
+      memcpy(&col.max, p + 20, 8);
+      p += 28;
+    }
+    a.blocks.push_back(block);
+  }
+
+  if (stop - p < 4)
+  {
+    return false;
+  }
+  memcpy(&count, p, 4);
+  p += 4;
+  for (uint32_t g = 0; g < count; g++)
+  {
+    archive_gap gap;
+    uint16_t length;
+    if (stop - p < 10)
+    {
+      return false;
+    }
+    memcpy(&gap.time_ms, p, 8);
+    memcpy(&length, p + 8, 2);
+    p += 10;
+    if (stop - p < length)
+    {
+      return false;
+    }
+    gap.text.assign(p, length);
+    p += length;
+    a.gaps.push_back(gap);
+  }
+  return true;
+}
+
+static bool read_column(FILE *f, const block_index &block, int column, std::vector<int64_t> &values,
+                        uint64_t &bytes_read)
+{
+  std::string chunk;
+  const column_index &col = block.columns[column];
+  bytes_read += col.bytes;
+  return read_at(f, col.offset, col.bytes, chunk) && decode_column(chunk, block.rows, column < ARCHIVE_FIXED_COLUMNS, values);
+}
+
+// ----- Log files ----- //
+static int64_t days_from_civil(int64_t y, unsigned m, unsigned d)
+{
+  y -= m <= 2;
+  int64_t era = (y >= 0 ? y : y - 399) / 400;
+  unsigned yoe = (unsigned)(y - era * 400);
+  unsigned doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+  unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  return era * 146097 + (int64_t)doe - 719468;
+}
+
+struct log_reader
+{
+  const char *path;
+  FILE *file = NULL;
+  char separator = ',';
+  int columns[CHANNELS]; // first column of a channel, -1 if not logged
+  int sample_column = -1;
+  uint8_t channel_mask = 0;
+  int64_t first_ms = INT64_MAX;
+};
+
+static bool read_line(FILE *f, std::string &line)
+{
+  line.clear();
+  int c;
+  while ((c = getc(f)) != EOF && c != '\n')
+  {
+    line.push_back((char)c);
+  }
+  if (!line.empty() && line.back() == '\r')
+  {
+    line.pop_back();
+  }
+  return c != EOF || !line.empty();
+}
+
+static void split(const std::string &line, char separator, std::vector<std::string> &fields)
+{
+  fields.clear();
+  size_t start = 0;
+  for (;;)
+  {
+    size_t next = line.find(separator, start);
+    fields.push_back(line.substr(start, next == std::string::npos ? std::string::npos : next - start));
+    if (next == std::string::npos)
+    {
+      return;
+    }
+    start = next + 1;
+  }
+}
+
+// "yy/mm/dd" and "hh:mm:ss:mmm" as written by format_log_time(), "70" is 1970 before the time was known
+static bool parse_log_time(const std::string &date, const std::string &clock, int64_t &ms)
+{
+  unsigned y, mo, d, h, mi, s, milli;
+  if (sscanf(date.c_str(), "%u/%u/%u", &y, &mo, &d) != 3 ||
+      sscanf(clock.c_str(), "%u:%u:%u:%u", &h, &mi, &s, &milli) != 4)
+  {
+    return false;
+  }
+  ms = (((days_from_civil((y >= 70 ? 1900 : 2000) + y, mo, d) * 24 + h) * 60 + mi) * 60 + s) * 1000 + milli;
+  return true;
+}
+
+// Reads the header and the first timestamp, leaves the file at the first sample
+static bool open_log(log_reader &log)
+{
+  std::string line;
+  std::vector<std::string> fields;
+  log.file = fopen(log.path, "r");
+  if (log.file == NULL)
+  {
+    return false;
+  }
+  while (read_line(log.file, line))
+  {
+    if (line.empty() || line[0] == '#')
+    {
+      continue;
+    }
+    if (line.compare(0, 4, "date") != 0 || line.size() < 5)
+    {
+      return false;
+    }
+    log.separator = line[4];
+    split(line, log.separator, fields);
+    for (size_t i = 0; i < fields.size(); i++)
+    {
+      log.sample_column = fields[i] == "sample" ? (int)i : log.sample_column;
+    }
+    for (int ch = 0; ch < CHANNELS; ch++)
+    {
+      log.columns[ch] = -1;
+      for (size_t i = 0; i < fields.size(); i++)
+      {
+        if (fields[i] == "load voltage " + std::to_string(ch + 1))
+        {
+          log.columns[ch] = i;
+          log.channel_mask |= 1 << ch;
+        }
+      }
+    }
+    off_t data = ftello(log.file);
+    while (read_line(log.file, line))
+    {
+      split(line, log.separator, fields);
+      if (fields.size() >= 2 && parse_log_time(fields[0], fields[1], log.first_ms))
+      {
+        break;
+      }
+    }
+    return fseeko(log.file, data, SEEK_SET) == 0;
+  }
+  return false;
+}
+
+static int64_t parse_value(const std::string &field)
+{
+  char *end;
+  double v = strtod(field.c_str(), &end);
+  if (end == field.c_str() || *end != 0 || !std::isfinite(v) || fabs(v) > 9e12)
+  {
+    return ARCHIVE_NULL;
+  }
+  return llround(v * ARCHIVE_SCALE);
+}
+
+static int pack(const char *path, char **logs, int count)
+{
+  std::vector<log_reader> readers(count);
+  uint8_t mask = 0;
+  for (int i = 0; i < count; i++)
+  {
+    readers[i].path = logs[i];
+    if (!open_log(readers[i]))
+    {
+      fprintf(stderr, "%s: not a PowerLogger log\n", logs[i]);
+      return 2;
+    }
+    mask |= readers[i].channel_mask;
+  }
+  std::stable_sort(readers.begin(), readers.end(),
+                   [](const log_reader &a, const log_reader &b) { return a.first_ms < b.first_ms; });
+
+  archive_writer w;
+  w.file = fopen(path, "wb");
+  if (w.file == NULL)
+  {
+    perror(path);
+    return 2;
+  }
+  fwrite(ARCHIVE_MAGIC, 1, 8, w.file);
+  w.offset = 8;
+  w.index.channel_mask = mask;
+  w.columns.resize(ARCHIVE_FIXED_COLUMNS + __builtin_popcount(mask) * COLUMNS_PER_CHANNEL);
+
+  int64_t last_ms = INT64_MIN;
+  uint64_t skipped = 0;
+  uint64_t input_bytes = 0;
+  std::string line;
+  std::vector<std::string> fields;
+  std::vector<std::string> gaps; // records before the next row
+  for (log_reader &log : readers)
+  {
+    while (read_line(log.file, line))
+    {
+      int64_t ms;
+      if (line.compare(0, 5, "# gap") == 0)
+      {
+        gaps.push_back(line);
+        continue;
+      }
+      split(line, log.separator, fields);
+      if (fields.size() < 2 || !parse_log_time(fields[0], fields[1], ms))
+      {
+        continue;
+      }
+      if (ms <= last_ms)
+      {
+        skipped++;
+        gaps.clear(); // the row and its gap are in the archive already
+        continue;
+      }
+      last_ms = ms;
+      for (const std::string &gap : gaps)
+      {
+        w.index.gaps.push_back({ms, gap});
+      }
+      gaps.clear();
+      w.columns[0].push_back(ms);
+      char *end;
+      const char *sample = log.sample_column >= 0 && log.sample_column < (int)fields.size()
+                               ? fields[log.sample_column].c_str()
+                               : "";
+      int64_t seq = strtoll(sample, &end, 10);
+      w.columns[1].push_back(end != sample && *end == 0 ? seq : ARCHIVE_NULL);
+      for (int ch = 0; ch < CHANNELS; ch++)
+      {
+        for (int c = 0; c < COLUMNS_PER_CHANNEL && mask & (1 << ch); c++)
+        {
+          int field = log.columns[ch] < 0 ? -1 : log.columns[ch] + c;
+          int64_t v = field >= 0 && field < (int)fields.size() ? parse_value(fields[field]) : ARCHIVE_NULL;
+          w.columns[block_column(mask, ch, c)].push_back(v);
+        }
+      }
+      w.rows++;
+      if (w.columns[0].size() == ARCHIVE_BLOCK_ROWS)
+      {
+        flush_block(w);
+      }
+    }
+    input_bytes += ftello(log.file);
+    fclose(log.file);
+  }
+  if (!finish_archive(w))
+  {
+    perror(path);
+    return 2;
+  }
+  printf("%s: %" PRIu64 " rows from %d files in %zu blocks, %" PRIu64 " overlapping rows skipped, %.1f MB -> %.1f MB\n",
+         path, w.rows, count, w.index.blocks.size(), skipped, input_bytes / 1e6, w.offset / 1e6);
+  return 0;
+}
+
+// ----- Queries ----- //
+struct query_options
+{
+  int64_t from_ms = INT64_MIN;
+  int64_t to_ms = INT64_MAX;
+  uint8_t channels = 0; // 0: all in the archive
+};
+
+static bool parse_query_time(const char *text, int64_t &ms)
+{
+  unsigned y, mo, d, h = 0, mi = 0, s = 0;
+  char *end;
+  int n = sscanf(text, "%u-%u-%u %u:%u:%u", &y, &mo, &d, &h, &mi, &s);
+  if (n >= 3)
+  {
+    ms = (((days_from_civil(y, mo, d) * 24 + h) * 60 + mi) * 60 + s) * 1000;
+    return true;
+  }
+  ms = strtoll(text, &end, 10);
+  return end != text && *end == 0;
+}
+
+static bool parse_query(int argc, char **argv, const archive &a, query_options &q)
+{
+  for (int i = 0; i + 1 < argc; i += 2)
+  {
+    if (strcmp(argv[i], "--from") == 0 && parse_query_time(argv[i + 1], q.from_ms))
+    {
+      continue;
+    }
+    if (strcmp(argv[i], "--to") == 0 && parse_query_time(argv[i + 1], q.to_ms))
+    {
+      continue;
+    }
+    int ch = atoi(argv[i + 1]);
+    if (strcmp(argv[i], "--channel") == 0 && ch >= 1 && ch <= CHANNELS && a.channel_mask & (1 << (ch - 1)))
+    {
+      q.channels |= 1 << (ch - 1);
+      continue;
+    }
+    fprintf(stderr, "bad option %s %s\n", argv[i], argv[i + 1]);
+    return false;
+  }
+  if (argc % 2 != 0)
+  {
+    fprintf(stderr, "missing value of %s\n", argv[argc - 1]);
+    return false;
+  }
+  q.channels = q.channels ? q.channels : a.channel_mask;
+  return true;
+}
+
+static bool block_in_range(const block_index &block, const query_options &q)
+{
+  return block.columns[0].max >= q.from_ms && block.columns[0].min <= q.to_ms;
+}
+
+static void print_value(int64_t v, char separator)
+{
+  putchar(separator);
+  if (v == ARCHIVE_NULL)
+  {
+    fputs("nan", stdout);
+    return;
+  }
+  uint64_t magnitude = v < 0 ? -(uint64_t)v : v;
+  printf("%s%" PRIu64 ".%06" PRIu64, v < 0 ? "-" : "", magnitude / 1000000, magnitude % 1000000);
+}
+
+static int query(FILE *f, const archive &a, const query_options &q)
+{
+  printf("# archive query\ndate,time");
+  for (int ch = 0; ch < CHANNELS; ch++)
+  {
+    for (int c = 0; c < COLUMNS_PER_CHANNEL && q.channels & (1 << ch); c++)
+    {
+      printf(",%s %d", column_name[c], ch + 1);
+    }
+  }
+  printf(",sample\n");
+
+  size_t blocks = 0;
+  uint64_t rows = 0;
+  uint64_t bytes_read = 0;
+  std::vector<int64_t> time, sample;
+  auto gap = std::lower_bound(a.gaps.begin(), a.gaps.end(), q.from_ms,
+                              [](const archive_gap &g, int64_t ms) { return g.time_ms < ms; });
+  std::vector<std::vector<int64_t>> values(1 + CHANNELS * COLUMNS_PER_CHANNEL);
+  for (const block_index &block : a.blocks)
+  {
+    if (!block_in_range(block, q))
+    {
+      continue;
+    }
+    blocks++;
+    bool ok = read_column(f, block, 0, time, bytes_read) && read_column(f, block, 1, sample, bytes_read);
+    for (int ch = 0; ch < CHANNELS; ch++)
+    {
+      for (int c = 0; c < COLUMNS_PER_CHANNEL && q.channels & (1 << ch); c++)
+      {
+        ok = ok && read_column(f, block, block_column(a.channel_mask, ch, c), values[ch * COLUMNS_PER_CHANNEL + c],
+                               bytes_read);
+      }
+    }
+    if (!ok)
+    {
+      fprintf(stderr, "archive damaged\n");
+      return 2;
+    }
+    for (uint32_t r = 0; r < block.rows; r++)
+    {
+      if (time[r] < q.from_ms || time[r] > q.to_ms)
+      {
+        continue;
+      }
+      for (; gap != a.gaps.end() && gap->time_ms <= time[r]; gap++)
+      {
+        puts(gap->text.c_str());
+      }
+      time_t seconds = time[r] / 1000;
+      struct tm t;
+      gmtime_r(&seconds, &t);
+      printf("%02d/%02d/%02d,%02d:%02d:%02d:%03d", t.tm_year % 100, t.tm_mon + 1, t.tm_mday, t.tm_hour, t.tm_min,
+             t.tm_sec, (int)(time[r] % 1000));
+      for (int ch = 0; ch < CHANNELS; ch++)
+      {
+        for (int c = 0; c < COLUMNS_PER_CHANNEL && q.channels & (1 << ch); c++)
+        {
+          print_value(values[ch * COLUMNS_PER_CHANNEL + c][r], ',');
+        }
+      }
+      if (sample[r] == ARCHIVE_NULL)
+      {
+        fputs(",nan\n", stdout);
+      }
+      else
+      {
+        printf(",%" PRId64 "\n", sample[r]);
+      }
+      rows++;
+    }
+  }
+  fprintf(stderr, "%" PRIu64 " rows, read %zu of %zu blocks, %.1f kB\n", rows, blocks, a.blocks.size(),
+          bytes_read / 1e3);
+  return 0;
+}
+
+static int summary(FILE *f, const archive &a, const query_options &q)
+{
+  int64_t min[CHANNELS][COLUMNS_PER_CHANNEL];
+  int64_t max[CHANNELS][COLUMNS_PER_CHANNEL];
+  std::fill(&min[0][0], &min[0][0] + CHANNELS * COLUMNS_PER_CHANNEL, INT64_MAX);
+  std::fill(&max[0][0], &max[0][0] + CHANNELS * COLUMNS_PER_CHANNEL, INT64_MIN);
+  size_t from_index = 0, decoded = 0;
+  uint64_t rows = 0;
+  uint64_t bytes_read = 0;
+  std::vector<int64_t> time, values;
+
+  for (const block_index &block : a.blocks)
+  {
+    if (!block_in_range(block, q))
+    {
+      continue;
+    }
+    bool inside = block.columns[0].min >= q.from_ms && block.columns[0].max <= q.to_ms;
+    if (!inside && !read_column(f, block, 0, time, bytes_read))
+    {
+      fprintf(stderr, "archive damaged\n");
+      return 2;
+    }
+    from_index += inside;
+    decoded += !inside;
+    for (int ch = 0; ch < CHANNELS; ch++)
+    {
+      for (int c = 0; c < COLUMNS_PER_CHANNEL && q.channels & (1 << ch); c++)
+      {
+        int column = block_column(a.channel_mask, ch, c);
+        if (inside)
+        {
+          min[ch][c] = std::min(min[ch][c], block.columns[column].min);
+          max[ch][c] = std::max(max[ch][c], block.columns[column].max);
+          continue;
+        }
+        if (!read_column(f, block, column, values, bytes_read))
+        {
+          fprintf(stderr, "archive damaged\n");
+          return 2;
+        }
+        for (uint32_t r = 0; r < block.rows; r++)
+        {
+          if (time[r] >= q.from_ms && time[r] <= q.to_ms && values[r] != ARCHIVE_NULL)
+          {
+            min[ch][c] = std::min(min[ch][c], values[r]);
+            max[ch][c] = std::max(max[ch][c], values[r]);
+          }
+        }
+      }
+    }
+    if (inside)
+    {
+      rows += block.rows;
+    }
+    else
+    {
+      rows += std::count_if(time.begin(), time.end(), [&](int64_t t) { return t >= q.from_ms && t <= q.to_ms; });
+    }
+  }
+
+  printf("%" PRIu64 " rows, %zu blocks from the index, %zu decoded (%.1f kB read)\n", rows, from_index, decoded,
+         bytes_read / 1e3);
+  for (int ch = 0; ch < CHANNELS; ch++)
+  {
+    for (int c = 0; c < COLUMNS_PER_CHANNEL && q.channels & (1 << ch); c++)
+    {
+      if (min[ch][c] > max[ch][c])
+      {
+        printf("%-15s %d  no values\n", column_name[c], ch + 1);
+        continue;
+      }
+      printf("%-15s %d  min %14.6f  max %14.6f\n", column_name[c], ch + 1, min[ch][c] / ARCHIVE_SCALE,
+             max[ch][c] / ARCHIVE_SCALE);
+    }
+  }
+  return 0;
+}
+
+static int info(const archive &a)
+{
+  uint64_t rows = 0;
+  uint64_t column_bytes[ARCHIVE_FIXED_COLUMNS + CHANNELS * COLUMNS_PER_CHANNEL] = {};
+  for (const block_index &block : a.blocks)
+  {
+    time_t from = block.columns[0].min / 1000;
+    time_t to = block.columns[0].max / 1000;
+    char from_text[24], to_text[24];
+    strftime(from_text, sizeof(from_text), "%Y-%m-%d %H:%M:%S", gmtime(&from));
+    strftime(to_text, sizeof(to_text), "%Y-%m-%d %H:%M:%S", gmtime(&to));
+    printf("block %5" PRIu64 "  %6u rows  %s .. %s\n", (uint64_t)(&block - &a.blocks[0]), block.rows, from_text,
+           to_text);
+    rows += block.rows;
+    for (size_t c = 0; c < block.columns.size(); c++)
+    {
+      column_bytes[c] += block.columns[c].bytes;
+    }
+  }
+  printf("%" PRIu64 " rows in %zu blocks, %zu gap records, bytes per row: time %.2f, sample %.2f", rows,
+         a.blocks.size(), a.gaps.size(), rows ? (double)column_bytes[0] / rows : 0,
+         rows ? (double)column_bytes[1] / rows : 0);
+  for (int ch = 0; ch < CHANNELS; ch++)
+  {
+    for (int c = 0; c < COLUMNS_PER_CHANNEL && a.channel_mask & (1 << ch); c++)
+    {
+      printf(", %s %d %.2f", column_name[c], ch + 1,
+             rows ? (double)column_bytes[block_column(a.channel_mask, ch, c)] / rows : 0);
+    }
+  }
+  printf("\n");
+  return 0;
+}
+
+static void usage(const char *name)
+{
+  fprintf(stderr,
+          "usage: %s pack <archive> <log>...\n"
+          "       %s query|summary <archive> [--from <time>] [--to <time>] [--channel <n>]...\n"
+          "       %s info <archive>\n",
+          name, name, name);
+}
+
+int main(int argc, char **argv)
+{
+  if (argc >= 4 && strcmp(argv[1], "pack") == 0)
+  {
+    return pack(argv[2], argv + 3, argc - 3);
+  }
+  if (argc < 3 || (strcmp(argv[1], "query") != 0 && strcmp(argv[1], "summary") != 0 && strcmp(argv[1], "info") != 0))
+  {
+    usage(argv[0]);
+    return 2;
+  }
+
+  FILE *f;
+  archive a;
+  if (!open_archive(argv[2], f, a))
+  {
+    fprintf(stderr, "%s: not an archive\n", argv[2]);
+    return 2;
+  }
+  if (strcmp(argv[1], "info") == 0)
+  {
+    return info(a);
+  }
+  query_options q;
+  if (!parse_query(argc - 3, argv + 3, a, q))
+  {
+    usage(argv[0]);
+    return 2;
+  }
+  return strcmp(argv[1], "query") == 0 ? query(f, a, q) : summary(f, a, q);
+}
@@ -0,0 +1,222 @@
+/*--------------------------------------------------------------------------------
+Simulates several loggers running the peer time sync on one Linux host
+
+Instance 0 is the master, the others are peers. Every instance has its own
+crystal (random drift up to +-50 ppm, random boot time) and its own clock
+model, and talks to the others through UDP broadcasts on the loopback
+interface, using the same packets, exchange filter and clock model as the
+firmware (include/peer_sync_protocol.h, include/clock_model.h). Packets are
+held back by a random queueing delay before they are sent.
+
+Every 5 seconds all clocks are read at the same instant and the largest
+difference between a peer and the master is printed. The peers learn their
+drift after a minute (CLOCK_MIN_DRIFT_BASE_US), the exit code is 0 if all of
+them stayed within 1 ms of the master during the last third of the run.
+
+  g++ -O2 -std=c++17 -pthread -Iinclude -o peer_sync_sim tools/peer_sync_sim.cpp
+  ./peer_sync_sim 4 120            (4 loggers, 120 s)
+  ./peer_sync_sim 4 120 2000       (up to 2 ms queueing delay per packet)
+--------------------------------------------------------------------------------*/
+
+#include "clock_model.h"
+#include "peer_sync_protocol.h"
+#include <arpa/inet.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <netinet/in.h>
+#include <random>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#define SIM_MAX_DRIFT_PPM 50
+#define SIM_REPORT_S 5
+
+struct sim_logger
+{
+  uint32_t id;
+  bool master;
+  double drift;       // of the crystal
+  uint64_t boot_us;   // timebase offset, every logger booted at a different time
+  clock_model model;
+  std::mutex lock;
+  int socket_fd;
+  uint64_t request_t1;
+  peer_sync_filter filter;
+  uint32_t exchanges;
+};
+
+static std::atomic<bool> running(true);
+static int max_queue_delay_us = 500;
+
+static uint64_t real_us()
+{
+  using namespace std::chrono;
+  return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+// ----- The timebase of one logger: the real clock seen through its crystal ----- //
+static uint64_t sim_mono_us(const sim_logger &logger)
+{
+  return logger.boot_us + (uint64_t)(real_us() * (1.0 + logger.drift));
+}
+
+static int64_t sim_wall_us(sim_logger &logger, uint64_t mono_us)
+{
+  std::lock_guard<std::mutex> guard(logger.lock);
+  return clock_model_at(logger.model, mono_us);
+}
+
+static void sim_send(sim_logger &logger, const peer_sync_packet &packet, std::mt19937 &random)
+{
+  uint8_t buffer[PEER_SYNC_PACKET_SIZE];
+  size_t len = peer_sync_encode(packet, buffer);
+  sockaddr_in to = {};
+  to.sin_family = AF_INET;
+  to.sin_port = htons(PEER_SYNC_PORT);
+  inet_pton(AF_INET, "127.255.255.255", &to.sin_addr);
+  usleep(std::uniform_int_distribution<int>(0, max_queue_delay_us)(random));
+  sendto(logger.socket_fd, buffer, len, 0, (sockaddr *)&to, sizeof(to));
+}
+
+static void sim_run(sim_logger *logger)
+{
+  std::mt19937 random(logger->id);
+  uint8_t buffer[64];
+  uint64_t last_request_us = 0;
+
+  while (running)
+  {
+    ssize_t len = recv(logger->socket_fd, buffer, sizeof(buffer), 0);
+    uint64_t now_us = sim_mono_us(*logger);
+    peer_sync_packet packet;
+    if (len > 0 && peer_sync_decode(buffer, len, packet))
+    {
+      if (logger->master && packet.type == PEER_SYNC_REQUEST)
+      {
+        // Same as peer_handle_packet() in src/peer_sync.cpp
+        packet.type = PEER_SYNC_RESPONSE;
+        packet.master_id = logger->id;
+        packet.t2 = sim_wall_us(*logger, now_us);
+        packet.t3 = sim_wall_us(*logger, sim_mono_us(*logger));
+        sim_send(*logger, packet, random);
+        logger->exchanges++;
+      }
+      else if (!logger->master && packet.type == PEER_SYNC_RESPONSE && packet.peer_id == logger->id &&
+               packet.t1 == logger->request_t1)
+      {
+        logger->exchanges++;
+        bool valid;
+        {
+          std::lock_guard<std::mutex> guard(logger->lock);
+          valid = logger->model.valid;
+        }
+        if (peer_sync_filter_add(logger->filter, packet, now_us) || !valid)
+        {
+          uint64_t apply_us = sim_mono_us(*logger);
+          std::lock_guard<std::mutex> guard(logger->lock);
+          int64_t master_us = peer_sync_filter_master_at(logger->filter, apply_us, logger->model.current.rate_ppb);
+          clock_model_apply(logger->model, apply_us, master_us);
+          logger->filter.count = 0;
+        }
+      }
+    }
+
+    if (!logger->master && now_us - last_request_us >= PEER_SYNC_INTERVAL_MS * 1000ULL)
+    {
+      peer_sync_packet request = {PEER_SYNC_REQUEST, logger->id, 0, 0, 0, 0};
+      request.t1 = sim_mono_us(*logger);
+      logger->request_t1 = request.t1;
+      sim_send(*logger, request, random);
+      last_request_us = now_us;
+    }
+  }
+}
+
+static int sim_socket()
+{
+  int fd = socket(AF_INET, SOCK_DGRAM, 0);
+  int one = 1;
+  setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+  setsockopt(fd, SOL_SOCKET, SO_BROADCAST, &one, sizeof(one));
+  timeval timeout = {0, 100000};
+  setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+  sockaddr_in local = {};
+  local.sin_family = AF_INET;
+  local.sin_port = htons(PEER_SYNC_PORT);
+  local.sin_addr.s_addr = htonl(INADDR_ANY);
+  if (bind(fd, (sockaddr *)&local, sizeof(local)) < 0)
+  {
+    perror("bind");
+    exit(1);
+  }
+  return fd;
+}
+
+int main(int argc, char **argv)
+{
+  int count = argc > 1 ? atoi(argv[1]) : 4;
+  int seconds = argc > 2 ? atoi(argv[2]) : 120;
+  max_queue_delay_us = argc > 3 ? atoi(argv[3]) : 500;
+  if (count < 2)
+  {
+    fprintf(stderr, "usage: %s [loggers >= 2] [seconds] [max queueing delay us]\n", argv[0]);
+    return 1;
+  }
+
+  std::mt19937 random(12345);
+  std::uniform_real_distribution<double> drift(-SIM_MAX_DRIFT_PPM * 1e-6, SIM_MAX_DRIFT_PPM * 1e-6);
+  std::uniform_int_distribution<uint64_t> boot(0, 3600000000ULL);
+  std::vector<sim_logger *> loggers;
+  for (int i = 0; i < count; i++)
+  {
+    sim_logger *logger = new sim_logger();
+    logger->id = 0x1000 + i;
+    logger->master = i == 0;
+    logger->drift = drift(random);
+    logger->boot_us = boot(random);
+    logger->socket_fd = sim_socket();
+    loggers.push_back(logger);
+    printf("logger %x: %s, drift %+.1f ppm\n", logger->id, logger->master ? "master" : "peer", logger->drift * 1e6);
+  }
+  // the master got its time from NTP
+  clock_model_apply(loggers[0]->model, sim_mono_us(*loggers[0]), 1700000000000000LL);
+
+  std::vector<std::thread> threads;
+  for (sim_logger *logger : loggers)
+  {
+    threads.emplace_back(sim_run, logger);
+  }
+
+  double worst_settled = 0;
+  for (int t = SIM_REPORT_S; t <= seconds; t += SIM_REPORT_S)
+  {
+    sleep(SIM_REPORT_S);
+    int64_t master_us = sim_wall_us(*loggers[0], sim_mono_us(*loggers[0]));
+    double worst = 0;
+    printf("%4ds", t);
+    for (int i = 1; i < count; i++)
+    {
+      int64_t diff = sim_wall_us(*loggers[i], sim_mono_us(*loggers[i])) - master_us;
+      printf("  %x %+8.3fms %+6.1fppm", loggers[i]->id, diff / 1000.0, loggers[i]->model.current.rate_ppb / 1000.0);
+      worst = abs(diff) / 1000.0 > worst ? abs(diff) / 1000.0 : worst;
+    }
+    printf("  worst %.3fms\n", worst);
+    if (t > seconds * 2 / 3 && worst > worst_settled)
+    {
+      worst_settled = worst;
+    }
+  }
+
+  running = false;
+  for (std::thread &thread : threads)
+  {
+    thread.join();
+  }
+  printf("worst difference in the last third: %.3f ms\n", worst_settled);
+  return worst_settled < 1.0 ? 0 : 2;
+}
@@ -0,0 +1,492 @@
+/*--------------------------------------------------------------------------------
+Replays a recorded measurement through the channel integration of the firmware
+
+Reads a log file of the SD card (the CSV written by write_file(), any
+separator and number of decimals) or a raw capture of the binary USB stream
+(include/cdc_stream.h, e.g. "cat /dev/ttyACM0 > capture.bin" while streaming).
+The load voltage and current of every sample are turned back into INA3221
+readings and fed through channel_integrate() (include/channel_state.h), the
+same code measure_values() runs. The replayed energy and capacity totals are
+then compared with golden values:
+
+  - by default the totals the logger itself wrote into the last sample
+  - with --golden <file> the totals saved earlier with --save-golden <file>
+
+A total passes if it is within --tolerance percent (0.5) or --abs units
+(0.01 mWh / mAh) of the golden value. The replay runs over the samples held
+in memory, --repeat times, and reports the throughput in samples per second.
+The sample interval is the median time between two samples unless given with
+--interval. Exit code 0 if all totals pass, 1 if one differs, 2 on errors.
+
+  g++ -O2 -std=c++17 -Iinclude -o trace_replay tools/trace_replay.cpp
+  ./trace_replay sim_sd/2024-January-01_00-00-10.txt
+  ./trace_replay --save-golden field.golden field.txt     (after a checked run)
+  ./trace_replay --golden field.golden --repeat 100 field.txt
+--------------------------------------------------------------------------------*/
+
+#include "cdc_frame.h"
+#include "channel_state.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#define CHANNELS 3
+#define CSV_COLUMNS_PER_CHANNEL 5 // load voltage, current, power, energy, capacity
+#define GAP_FACTOR 1.5            // a time step this much longer than the interval counts as a gap
+
+struct replay_sample
+{
+  uint64_t time_us; // from the start of the recording
+  float load_voltage[CHANNELS];
+  float current_mA[CHANNELS];
+  float energy[CHANNELS]; // as recorded by the logger
+  float capacity[CHANNELS];
+};
+
+struct replay_trace
+{
+  uint8_t channel_mask = 0;
+  std::vector<replay_sample> samples;
+  size_t dropped = 0; // samples the logger integrated but could not write, from its "# gap" records
+};
+
+struct replay_totals
+{
+  double energy[CHANNELS];
+  double capacity[CHANNELS];
+};
+
+// ----- Loading ----- //
+static bool read_file(const char *path, std::string &data)
+{
+  FILE *f = fopen(path, "rb");
+  if (f == NULL)
+  {
+    return false;
+  }
+  char buf[65536];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0)
+  {
+    data.append(buf, n);
+  }
+  fclose(f);
+  return true;
+}
+
+static uint32_t get_u32(const uint8_t *p)
+{
+  return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static float get_f32(const uint8_t *p)
+{
+  float f;
+  memcpy(&f, p, 4);
+  return f;
+}
+
+// Frames of the USB stream, bytes between valid frames are skipped
+static bool parse_capture(const std::string &data, replay_trace &trace)
+{
+  const uint8_t *buf = (const uint8_t *)data.data();
+  size_t len = data.size();
+  uint64_t time_us = 0;
+  uint32_t last_time = 0;
+
+  for (size_t i = 0; i + CDC_HEADER + CDC_CRC <= len;)
+  {
+    size_t payload = buf[i + 3];
+    if (buf[i] != CDC_SYNC_1 || buf[i + 1] != CDC_SYNC_2 || buf[i + 2] != CDC_TYPE_SAMPLE ||
+        payload < CDC_SAMPLE_PAYLOAD || i + CDC_HEADER + payload + CDC_CRC > len ||
+        (buf[i + CDC_HEADER + payload] | buf[i + CDC_HEADER + payload + 1] << 8) != cdc_crc16(buf + i + 2, payload + 2))
+    {
+      i++;
+      continue;
+    }
+
+    const uint8_t *p = buf + i + CDC_HEADER;
+    const uint8_t *end = p + payload;
+    uint32_t time = get_u32(p + 4);
+    uint8_t mask = p[8];
+    p += CDC_SAMPLE_PAYLOAD;
+    if (trace.samples.empty())
+    {
+      trace.channel_mask = mask;
+    }
+    else
+    {
+      time_us = time_us + (uint32_t)(time - last_time); // the stream carries the low 32 bits only
+    }
+    last_time = time;
+
+    replay_sample sample = {};
+    sample.time_us = time_us;
+    for (int ch = 0; ch < CHANNELS; ch++)
+    {
+      if (mask & (1 << ch) && p + CDC_CHANNEL_PAYLOAD <= end)
+      {
+        sample.load_voltage[ch] = get_f32(p);
+        sample.current_mA[ch] = get_f32(p + 4);
+        sample.energy[ch] = get_f32(p + 8);
+        sample.capacity[ch] = get_f32(p + 12);
+        p += CDC_CHANNEL_PAYLOAD;
+      }
+    }
+    trace.samples.push_back(sample);
+    i = i + 6 + payload;
+  }
+  return !trace.samples.empty();
+}
+
+// The log file of the SD card: "# time=..." line, column names, one line per sample
+static bool parse_log(const std::string &data, replay_trace &trace)
+{
+  size_t pos = 0;
+  char separator = 0;
+  int columns[CHANNELS]; // first column of each channel, -1 if not logged
+  uint64_t day_us = 0;
+  uint64_t last_clock_us = 0;
+
+  while (pos < data.size())
+  {
+    size_t end = data.find('\n', pos);
+    end = end == std::string::npos ? data.size() : end;
+    std::string line = data.substr(pos, end - pos);
+    pos = end + 1;
+    if (!line.empty() && line.back() == '\r')
+    {
+      line.pop_back();
+    }
+    if (line.compare(0, 6, "# gap ") == 0 && line.find("reason=sd_queue_full") != std::string::npos)
+    {
+      size_t missed = line.find("missed=");
+      trace.dropped += missed == std::string::npos ? 0 : strtoul(line.c_str() + missed + 7, NULL, 10);
+    }
+    if (line.empty() || line[0] == '#')
+    {
+      continue;
+    }
+
+    std::vector<std::string> fields;
+    if (separator == 0)
+    {
+      if (line.compare(0, 4, "date") != 0 || line.size() < 5)
+      {
+        return false;
+      }
+      separator = line[4];
+    }
+    size_t start = 0;
+    for (;;)
+    {
+      size_t next = line.find(separator, start);
+      fields.push_back(line.substr(start, next == std::string::npos ? std::string::npos : next - start));
+      if (next == std::string::npos)
+      {
+        break;
+      }
+      start = next + 1;
+    }
+
+    if (fields[0] == "date") // column names, repeated if a new file was started
+    {
+      trace.channel_mask = 0;
+      for (int ch = 0; ch < CHANNELS; ch++)
+      {
+        columns[ch] = -1;
+        std::string name = "load voltage " + std::to_string(ch + 1);
+        for (size_t i = 0; i < fields.size(); i++)
+        {
+          if (fields[i] == name)
+          {
+            columns[ch] = i;
+            trace.channel_mask |= 1 << ch;
+          }
+        }
+      }
+      continue;
+    }
+
+    unsigned hours, minutes, seconds, ms;
+    if (fields.size() < 2 || sscanf(fields[1].c_str(), "%u:%u:%u:%u", &hours, &minutes, &seconds, &ms) != 4)
+    {
+      fprintf(stderr, "skipping line: %s\n", line.c_str());
+      continue;
+    }
+    uint64_t clock_us = (((hours * 60 + minutes) * 60 + seconds) * 1000ULL + ms) * 1000;
+    if (!trace.samples.empty() && clock_us < last_clock_us)
+    {
+      day_us = day_us + 86400000000ULL; // past midnight
+    }
+    last_clock_us = clock_us;
+
+    replay_sample sample = {};
+    sample.time_us = day_us + clock_us;
+    for (int ch = 0; ch < CHANNELS; ch++)
+    {
+      int c = columns[ch];
+      if (c >= 0 && c + CSV_COLUMNS_PER_CHANNEL <= (int)fields.size())
+      {
+        sample.load_voltage[ch] = strtof(fields[c].c_str(), NULL);
+        sample.current_mA[ch] = strtof(fields[c + 1].c_str(), NULL);
+        sample.energy[ch] = strtof(fields[c + 3].c_str(), NULL);
+        sample.capacity[ch] = strtof(fields[c + 4].c_str(), NULL);
+      }
+    }
+    trace.samples.push_back(sample);
+  }
+  return !trace.samples.empty();
+}
+
+// ----- Replay ----- //
+static unsigned long median_interval_ms(const replay_trace &trace)
+{
+  std::vector<uint64_t> steps;
+  for (size_t i = 1; i < trace.samples.size(); i++)
+  {
+    steps.push_back(trace.samples[i].time_us - trace.samples[i - 1].time_us);
+  }
+  if (steps.empty())
+  {
+    return 0;
+  }
+  std::nth_element(steps.begin(), steps.begin() + steps.size() / 2, steps.end());
+  return (steps[steps.size() / 2] + 500) / 1000;
+}
+
+static replay_totals replay(const replay_trace &trace, unsigned long interval_ms)
+{
+  channel_state channels[CHANNELS] = {};
+  replay_totals totals;
+
+  for (const replay_sample &sample : trace.samples)
+  {
+    for (int ch = 0; ch < CHANNELS; ch++)
+    {
+      if (trace.channel_mask & (1 << ch))
+      {
+        float shunt_uV, bus_V;
+        channel_readings(sample.load_voltage[ch], sample.current_mA[ch], shunt_uV, bus_V);
+        channel_integrate(channels[ch], shunt_uV, bus_V, CHANNEL_SHUNT_MOHM, interval_ms);
+      }
+    }
+  }
+  for (int ch = 0; ch < CHANNELS; ch++)
+  {
+    totals.energy[ch] = channels[ch].energy;
+    totals.capacity[ch] = channels[ch].capacity;
+  }
+  return totals;
+}
+
+// ----- Golden values: one line "<channel> <energy mWh> <capacity mAh>" per channel ----- //
+static bool load_golden(const char *path, replay_totals &golden, uint8_t &mask)
+{
+  FILE *f = fopen(path, "r");
+  if (f == NULL)
+  {
+    return false;
+  }
+  int ch;
+  double energy, capacity;
+  mask = 0;
+  while (fscanf(f, "%d %lf %lf", &ch, &energy, &capacity) == 3)
+  {
+    if (ch >= 1 && ch <= CHANNELS)
+    {
+      golden.energy[ch - 1] = energy;
+      golden.capacity[ch - 1] = capacity;
+      mask |= 1 << (ch - 1);
+    }
+  }
+  fclose(f);
+  return true;
+}
+
+static bool save_golden(const char *path, const replay_totals &totals, uint8_t mask)
+{
+  FILE *f = fopen(path, "w");
+  if (f == NULL)
+  {
+    return false;
+  }
+  for (int ch = 0; ch < CHANNELS; ch++)
+  {
+    if (mask & (1 << ch))
+    {
+      fprintf(f, "%d %.6f %.6f\n", ch + 1, totals.energy[ch], totals.capacity[ch]);
+    }
+  }
+  return fclose(f) == 0;
+}
+
+static bool within(double value, double golden, double tolerance_pct, double tolerance_abs)
+{
+  double diff = fabs(value - golden);
+  return diff <= tolerance_abs || diff <= fabs(golden) * tolerance_pct / 100;
+}
+
+static void usage(const char *name)
+{
+  fprintf(stderr,
+          "usage: %s [options] <log file or stream capture>\n"
+          "  --interval <ms>        sample interval (median time between samples)\n"
+          "  --golden <file>        compare with saved totals instead of the recorded ones\n"
+          "  --save-golden <file>   save the replayed totals\n"
+          "  --tolerance <percent>  relative tolerance (0.5)\n"
+          "  --abs <units>          absolute tolerance in mWh / mAh (0.01)\n"
+          "  --repeat <n>           replay the samples n times for the throughput (1)\n",
+          name);
+}
+
+int main(int argc, char **argv)
+{
+  unsigned long interval_ms = 0;
+  const char *golden_path = NULL;
+  const char *save_path = NULL;
+  const char *path = NULL;
+  double tolerance_pct = 0.5;
+  double tolerance_abs = 0.01;
+  int repeat = 1;
+
+  for (int i = 1; i < argc; i++)
+  {
+    const char *value = i + 1 < argc ? argv[i + 1] : NULL;
+    if (argv[i][0] != '-' && path == NULL)
+    {
+      path = argv[i];
+      continue;
+    }
+    if (value == NULL)
+    {
+      usage(argv[0]);
+      return 2;
+    }
+    if (strcmp(argv[i], "--interval") == 0)
+    {
+      interval_ms = strtoul(value, NULL, 10);
+    }
+    else if (strcmp(argv[i], "--golden") == 0)
+    {
+      golden_path = value;
+    }
+    else if (strcmp(argv[i], "--save-golden") == 0)
+    {
+      save_path = value;
+    }
+    else if (strcmp(argv[i], "--tolerance") == 0)
+    {
+      tolerance_pct = atof(value);
+    }
+    else if (strcmp(argv[i], "--abs") == 0)
+    {
+      tolerance_abs = atof(value);
+    }
+    else if (strcmp(argv[i], "--repeat") == 0)
+    {
+      repeat = std::max(1, atoi(value));
+    }
+    else
+    {
+      usage(argv[0]);
+      return 2;
+    }
+    i++;
+  }
+  if (path == NULL)
+  {
+    usage(argv[0]);
+    return 2;
+  }
+
+  std::string data;
+  if (!read_file(path, data))
+  {
+    perror(path);
+    return 2;
+  }
+  replay_trace trace;
+  bool binary = data.size() >= 2 && (uint8_t)data[0] == CDC_SYNC_1 && (uint8_t)data[1] == CDC_SYNC_2;
+  if (!(binary ? parse_capture(data, trace) : parse_log(data, trace)) || trace.channel_mask == 0)
+  {
+    fprintf(stderr, "%s: no samples found\n", path);
+    return 2;
+  }
+  if (interval_ms == 0)
+  {
+    interval_ms = median_interval_ms(trace);
+  }
+  if (interval_ms == 0)
+  {
+    fprintf(stderr, "%s: sample interval unknown, use --interval\n", path);
+    return 2;
+  }
+
+  size_t gaps = 0;
+  for (size_t i = 1; i < trace.samples.size(); i++)
+  {
+    gaps += trace.samples[i].time_us - trace.samples[i - 1].time_us > interval_ms * 1000 * GAP_FACTOR;
+  }
+  printf("%s: %s, %zu samples, interval %lu ms, %zu gaps\n", path, binary ? "stream capture" : "log file",
+         trace.samples.size(), interval_ms, gaps);
+  if (trace.dropped > 0)
+  {
+    printf("%zu samples were dropped from the log (\"# gap\" records), its totals include them, the replay not\n",
+           trace.dropped);
+  }
+
+  replay_totals totals = {};
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for (int r = 0; r < repeat; r++)
+  {
+    totals = replay(trace, interval_ms);
+  }
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  printf("replayed %zu samples in %.3f ms, %.0f samples/s\n", trace.samples.size() * repeat, elapsed.count() * 1000,
+         trace.samples.size() * repeat / std::max(elapsed.count(), 1e-9));
+
+  replay_totals golden;
+  uint8_t golden_mask = trace.channel_mask;
+  const replay_sample &last = trace.samples.back();
+  for (int ch = 0; ch < CHANNELS; ch++)
+  {
+    golden.energy[ch] = last.energy[ch];
+    golden.capacity[ch] = last.capacity[ch];
+  }
+  if (golden_path != NULL && !load_golden(golden_path, golden, golden_mask))
+  {
+    perror(golden_path);
+    return 2;
+  }
+
+  bool pass = golden_mask == trace.channel_mask;
+  printf("ch  energy mWh  golden      capacity mAh  golden\n");
+  for (int ch = 0; ch < CHANNELS; ch++)
+  {
+    if (trace.channel_mask & (1 << ch))
+    {
+      bool ok = within(totals.energy[ch], golden.energy[ch], tolerance_pct, tolerance_abs) &&
+                within(totals.capacity[ch], golden.capacity[ch], tolerance_pct, tolerance_abs);
+      printf("%d   %-11.4f %-11.4f %-13.4f %-11.4f %s\n", ch + 1, totals.energy[ch], golden.energy[ch],
+             totals.capacity[ch], golden.capacity[ch], ok ? "ok" : "DIFFERS");
+      pass = pass && ok;
+    }
+  }
+  if (golden_mask != trace.channel_mask)
+  {
+    printf("the golden values are for other channels\n");
+  }
+
+  if (save_path != NULL && !save_golden(save_path, totals, trace.channel_mask))
+  {
+    perror(save_path);
+    return 2;
+  }
+  return pass ? 0 : 1;
+}
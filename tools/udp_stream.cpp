@@ -0,0 +1,368 @@
+/*--------------------------------------------------------------------------------
+Host tool for the UDP sample stream (see include/udp_stream.h)
+
+  udp_stream listen <port> <csv file>
+      Receives the stream, writes one CSV line per sample in arrival order and
+      prints gap and reorder statistics to stderr every second and per session.
+      A sample that arrives after a later one is counted as reordered, a
+      missing sample is counted as lost once REORDER_WINDOW newer samples have
+      arrived (or at the end of the session).
+
+  udp_stream simulate <host> <port> [samples/s] [seconds] [loss %] [reorder %]
+      Acts as a logger: sends a synthetic three channel waveform in the same
+      datagrams as the firmware. Drops and swaps datagrams at the given rates
+      and prints how many samples it dropped, for checking the receiver.
+
+Loopback test:
+
+  g++ -O2 -std=c++17 -o udp_stream tools/udp_stream.cpp
+  ./udp_stream listen 5005 samples.csv &
+  ./udp_stream simulate 127.0.0.1 5005 1000 10 2 5
+--------------------------------------------------------------------------------*/
+
+#include <arpa/inet.h>
+#include <cerrno>
+#include <cmath>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <netinet/in.h>
+#include <set>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#define UDP_STREAM_VERSION 1
+#define UDP_STREAM_BATCH 16
+#define UDP_HEADER 10
+#define CHANNELS 3
+#define REORDER_WINDOW 1024 // samples a late sample may trail the newest one
+
+static volatile sig_atomic_t running = 1;
+
+static void on_signal(int)
+{
+  running = 0;
+}
+
+static double now_s()
+{
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint32_t get_u32(const uint8_t *p)
+{
+  return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static float get_f32(const uint8_t *p)
+{
+  float f;
+  memcpy(&f, p, 4);
+  return f;
+}
+
+// ----- Receiver ----- //
+
+struct session_stats
+{
+  uint64_t received = 0;
+  uint64_t lost = 0;       // missing samples older than the reorder window
+  uint64_t reordered = 0;  // arrived after a newer sample
+  uint64_t duplicates = 0;
+  uint64_t gaps = 0;       // holes in the sequence when they first appeared
+  uint32_t max_reorder = 0;
+  uint32_t next_seq = 0;
+  std::set<uint32_t> missing;
+};
+
+static void account(session_stats &stats, uint32_t seq)
+{
+  stats.received++;
+  if (seq >= stats.next_seq)
+  {
+    if (seq > stats.next_seq)
+    {
+      stats.gaps++;
+      for (uint32_t s = stats.next_seq; s < seq; s++)
+      {
+        if (seq - s > REORDER_WINDOW)
+        {
+          stats.lost++; // can never be reordered into the window any more
+        }
+        else
+        {
+          stats.missing.insert(s);
+        }
+      }
+    }
+    stats.next_seq = seq + 1;
+    while (!stats.missing.empty() && *stats.missing.begin() + REORDER_WINDOW < seq)
+    {
+      stats.missing.erase(stats.missing.begin());
+      stats.lost++;
+    }
+  }
+  else if (stats.missing.erase(seq))
+  {
+    stats.reordered++;
+    if (stats.next_seq - seq > stats.max_reorder)
+    {
+      stats.max_reorder = stats.next_seq - seq;
+    }
+  }
+  else
+  {
+    stats.duplicates++;
+  }
+}
+
+static void print_stats(const char *label, const session_stats &stats, bool final)
+{
+  uint64_t lost = stats.lost + (final ? stats.missing.size() : 0);
+  fprintf(stderr, "%s: %llu received, %llu lost (%.3f%%)%s, %llu gaps, %llu reordered (max %u), %llu duplicates\n",
+          label, (unsigned long long)stats.received, (unsigned long long)lost,
+          stats.received + lost ? 100.0 * lost / (stats.received + lost) : 0.0,
+          final ? "" : " + pending", (unsigned long long)stats.gaps, (unsigned long long)stats.reordered,
+          stats.max_reorder, (unsigned long long)stats.duplicates);
+}
+
+static int listen_stream(int port, const char *csv_path)
+{
+  int fd = socket(AF_INET, SOCK_DGRAM, 0);
+  sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port);
+  addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  if (fd < 0 || bind(fd, (sockaddr *)&addr, sizeof(addr)) < 0)
+  {
+    fprintf(stderr, "bind %d: %s\n", port, strerror(errno));
+    return 1;
+  }
+  timeval timeout = {0, 200000};
+  setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+  int rcvbuf = 1 << 20;
+  setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
+
+  FILE *csv = strcmp(csv_path, "-") == 0 ? stdout : fopen(csv_path, "w");
+  if (!csv)
+  {
+    fprintf(stderr, "%s: %s\n", csv_path, strerror(errno));
+    return 1;
+  }
+  fprintf(csv, "session,seq,time_us");
+  for (int ch = 1; ch <= CHANNELS; ch++)
+  {
+    fprintf(csv, ",V%d,mA%d,mWh%d,mAh%d", ch, ch, ch, ch);
+  }
+  fputc('\n', csv);
+
+  session_stats stats;
+  bool have_session = false;
+  uint16_t session = 0;
+  uint64_t bad_datagrams = 0;
+  double report = now_s() + 1.0;
+  uint8_t buf[2048];
+
+  while (running)
+  {
+    ssize_t n = recv(fd, buf, sizeof(buf), 0);
+    if (n >= UDP_HEADER && buf[0] == 'P' && buf[1] == 'L' && buf[2] == UDP_STREAM_VERSION)
+    {
+      uint16_t datagram_session = buf[4] | buf[5] << 8;
+      if (!have_session || datagram_session != session)
+      {
+        if (have_session)
+        {
+          char label[32];
+          snprintf(label, sizeof(label), "session %u", session);
+          print_stats(label, stats, true);
+        }
+        stats = session_stats();
+        session = datagram_session;
+        have_session = true;
+      }
+
+      const uint8_t *p = buf + UDP_HEADER;
+      const uint8_t *end = buf + n;
+      for (int i = 0; i < buf[3] && p + 9 <= end; i++)
+      {
+        uint32_t seq = get_u32(p);
+        uint8_t mask = p[8];
+        fprintf(csv, "%u,%u,%u", session, seq, get_u32(p + 4));
+        p += 9;
+        for (int ch = 0; ch < CHANNELS; ch++)
+        {
+          if (mask & (1 << ch) && p + 16 <= end)
+          {
+            fprintf(csv, ",%.4f,%.3f,%.4f,%.4f", get_f32(p), get_f32(p + 4), get_f32(p + 8), get_f32(p + 12));
+            p += 16;
+          }
+          else
+          {
+            fprintf(csv, ",,,,");
+          }
+        }
+        fputc('\n', csv);
+        account(stats, seq);
+      }
+    }
+    else if (n >= 0)
+    {
+      bad_datagrams++;
+    }
+
+    double t = now_s();
+    if (t >= report && have_session)
+    {
+      char label[32];
+      snprintf(label, sizeof(label), "session %u", session);
+      print_stats(label, stats, false);
+      report = t + 1.0;
+    }
+  }
+
+  if (have_session)
+  {
+    char label[32];
+    snprintf(label, sizeof(label), "session %u", session);
+    print_stats(label, stats, true);
+  }
+  if (bad_datagrams)
+  {
+    fprintf(stderr, "%llu datagrams ignored\n", (unsigned long long)bad_datagrams);
+  }
+  close(fd);
+  if (csv != stdout)
+  {
+    fclose(csv);
+  }
+  return 0;
+}
+
+// ----- Simulated logger ----- //
+
+static size_t build_datagram(uint8_t *buf, uint16_t session, uint32_t datagram, uint32_t first_seq, int count,
+                             double rate)
+{
+  size_t len = UDP_HEADER;
+  buf[0] = 'P';
+  buf[1] = 'L';
+  buf[2] = UDP_STREAM_VERSION;
+  buf[3] = count;
+  memcpy(buf + 4, &session, 2);
+  memcpy(buf + 6, &datagram, 4);
+  for (int i = 0; i < count; i++)
+  {
+    uint32_t seq = first_seq + i;
+    double t = seq / rate;
+    uint32_t time_us = (uint32_t)(t * 1e6);
+    uint8_t mask = 0x07;
+    memcpy(buf + len, &seq, 4);
+    memcpy(buf + len + 4, &time_us, 4);
+    buf[len + 8] = mask;
+    len += 9;
+    for (int ch = 0; ch < CHANNELS; ch++)
+    {
+      // sleep current with a burst every second, energy integrated from the start
+      float v = 3.3f + ch;
+      float ma = fmod(t, 1.0) < 0.1 ? 80.0f * (ch + 1) : 0.5f * (ch + 1);
+      float mwh = v * ma * t / 3600.0f;
+      float mah = ma * t / 3600.0f;
+      memcpy(buf + len, &v, 4);
+      memcpy(buf + len + 4, &ma, 4);
+      memcpy(buf + len + 8, &mwh, 4);
+      memcpy(buf + len + 12, &mah, 4);
+      len += 16;
+    }
+  }
+  return len;
+}
+
+static int simulate_stream(const char *host, int port, double rate, double seconds, double loss, double reorder)
+{
+  int fd = socket(AF_INET, SOCK_DGRAM, 0);
+  sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port);
+  if (fd < 0 || inet_pton(AF_INET, host, &addr.sin_addr) != 1)
+  {
+    fprintf(stderr, "bad host %s\n", host);
+    return 1;
+  }
+
+  srand(time(NULL));
+  uint16_t session = rand() & 0xFFFF;
+  uint32_t total = (uint32_t)(rate * seconds);
+  uint64_t dropped = 0;
+  uint64_t swapped = 0;
+  uint8_t held[2048];
+  size_t held_len = 0;
+  uint8_t buf[2048];
+  double start = now_s();
+
+  for (uint32_t seq = 0, datagram = 0; seq < total && running; seq += UDP_STREAM_BATCH, datagram++)
+  {
+    int count = total - seq < UDP_STREAM_BATCH ? total - seq : UDP_STREAM_BATCH;
+
+    // a datagram is sent once its last sample has been "measured"
+    double due = start + (seq + count) / rate;
+    double wait = due - now_s();
+    if (wait > 0)
+    {
+      usleep((useconds_t)(wait * 1e6));
+    }
+
+    size_t len = build_datagram(buf, session, datagram, seq, count, rate);
+    if (rand() < loss / 100.0 * RAND_MAX)
+    {
+      dropped += count;
+      continue;
+    }
+    if (held_len == 0 && rand() < reorder / 100.0 * RAND_MAX)
+    {
+      memcpy(held, buf, len); // send after the next datagram
+      held_len = len;
+      swapped++;
+      continue;
+    }
+    sendto(fd, buf, len, 0, (sockaddr *)&addr, sizeof(addr));
+    if (held_len)
+    {
+      sendto(fd, held, held_len, 0, (sockaddr *)&addr, sizeof(addr));
+      held_len = 0;
+    }
+  }
+  if (held_len)
+  {
+    sendto(fd, held, held_len, 0, (sockaddr *)&addr, sizeof(addr));
+  }
+  close(fd);
+  fprintf(stderr, "session %u: sent %u samples in %.1f s, dropped %llu, swapped %llu datagrams\n", session, total,
+          now_s() - start, (unsigned long long)dropped, (unsigned long long)swapped);
+  return 0;
+}
+
+int main(int argc, char **argv)
+{
+  signal(SIGINT, on_signal);
+  signal(SIGTERM, on_signal);
+
+  if (argc == 4 && strcmp(argv[1], "listen") == 0)
+  {
+    return listen_stream(atoi(argv[2]), argv[3]);
+  }
+  if (argc >= 4 && strcmp(argv[1], "simulate") == 0)
+  {
+    return simulate_stream(argv[2], atoi(argv[3]), argc > 4 ? atof(argv[4]) : 1000, argc > 5 ? atof(argv[5]) : 10,
+                           argc > 6 ? atof(argv[6]) : 0, argc > 7 ? atof(argv[7]) : 0);
+  }
+  fprintf(stderr, "usage: %s listen <port> <csv file>\n"
+                  "       %s simulate <host> <port> [samples/s] [seconds] [loss %%] [reorder %%]\n",
+          argv[0], argv[0]);
+  return 1;
+}